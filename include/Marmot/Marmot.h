@@ -30,8 +30,12 @@
 #include "Marmot/MarmotMaterial.h"
 #include <functional>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace MarmotLibrary {
 
@@ -70,6 +74,18 @@ namespace MarmotLibrary {
                                            int           nMaterialProperties,
                                            int           materialNumber );
 
+    /**
+     * @brief Create a material instance of a section, sharing the section data with all materials of the section.
+     * @details Distinct section objects with identical material code and property values share their section data
+     * if they opt in by MarmotMaterialSection::isSharingDataWithEqualSections, as long as any material of the sharing
+     * sections exists. Safe to call concurrently, also for the same section.
+     * @param[in] section Material section; the section data is created with the first material of the section, or
+     * taken from an equal section opting in to sharing.
+     * @param[in] materialNumber Unique identifier for the material instance.
+     * @return Pointer to the created MarmotMaterial instance.
+     */
+    static MarmotMaterial* createMaterial( const MarmotMaterialSection& section, int materialNumber );
+
     /**
      * @brief Register a material with its code and factory function.
      * @param[in] materialCode Unique code for the material.
@@ -81,9 +97,21 @@ namespace MarmotLibrary {
                                   const std::string&      materialName,
                                   materialFactoryFunction factoryFunction );
 
+    /**
+     * @brief Get the names of all registered materials.
+     * @return Names of the registered materials in alphabetical order.
+     */
+    static std::vector< std::string > getRegisteredMaterialNames();
+
   private:
-    static std::unordered_map< std::string, int >             materialNameToCodeAssociation;
-    static std::unordered_map< int, materialFactoryFunction > materialFactoryFunctionByCode;
+    // the registries are function local statics, as materials register themselves during the static initialization of
+    // other translation units, whose order is unspecified (and is reordered by link time optimization)
+    static std::unordered_map< std::string, int >&             materialNameToCodeAssociation();
+    static std::unordered_map< int, materialFactoryFunction >& materialFactoryFunctionByCode();
+
+    using SectionKey = std::pair< int, std::vector< double > >;
+    static std::map< SectionKey, std::weak_ptr< MarmotMaterialSectionData > > sectionDataByCodeAndProperties;
+    static std::mutex                                                          sectionDataMutex;
   };
 
   /**
@@ -124,9 +152,16 @@ namespace MarmotLibrary {
                                  int                    elementCode,
                                  elementFactoryFunction factoryFunction );
 
+    /**
+     * @brief Get the names of all registered elements.
+     * @return Names of the registered elements in alphabetical order.
+     */
+    static std::vector< std::string > getRegisteredElementNames();
+
   private:
-    static std::unordered_map< std::string, int >            elementNameToCodeAssociation;
-    static std::unordered_map< int, elementFactoryFunction > elementFactoryFunctionByCode;
+    // function local statics for the same reason as in MarmotMaterialFactory
+    static std::unordered_map< std::string, int >&            elementNameToCodeAssociation();
+    static std::unordered_map< int, elementFactoryFunction >& elementFactoryFunctionByCode();
   };
 
 } // namespace MarmotLibrary
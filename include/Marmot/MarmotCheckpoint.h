@@ -0,0 +1,190 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ * Magdalena Schreter magdalena.schreter@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+#pragma once
+#include "Marmot/MarmotElement.h"
+#include "Marmot/MarmotElementProperty.h"
+#include "Marmot/MarmotUtils.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace Marmot::Checkpoint
+ * @brief Checkpoint and restart of element and material state in a single memory-mappable file.
+ *
+ * A checkpoint records for each element the element code and label, the material code, the element and material
+ * properties, a descriptor of the layout of the state variables and the state variables themselves. Properties
+ * shared by several elements (e.g., of the same section) are stored once. The state variables of all elements are
+ * stored contiguously in a page aligned section at the end of the file, in the native binary representation.
+ *
+ * For restart, the file is mapped copy-on-write: the state variables are loaded lazily page by page on the first
+ * access, and the element state can be assigned directly to the mapped memory without parsing or copying. Changes to
+ * the state are private to the process and do not modify the checkpoint.
+ */
+namespace Marmot::Checkpoint {
+
+  /** @brief Header at the begin of a checkpoint file; offsets are in bytes from the begin of the file. */
+  struct FileHeader {
+    char         magic[8];
+    std::int32_t version;
+    std::int32_t pageSize;
+    std::int64_t nElements;
+    std::int64_t nLayouts;
+    std::int64_t nLayoutEntries;
+    std::int64_t nProperties;
+    std::int64_t elementsOffset;
+    std::int64_t layoutsOffset;
+    std::int64_t layoutEntriesOffset;
+    std::int64_t propertiesOffset;
+    std::int64_t stateVarsOffset;
+    std::int64_t fileSize;
+  };
+
+  /** @brief Record of an element; property and state offsets are indices into the respective sections. */
+  struct ElementRecord {
+    std::int32_t elementCode;
+    std::int32_t elementLabel;
+    std::int32_t materialCode;
+    std::int32_t layout;
+    std::int64_t elementPropertiesOffset;
+    std::int64_t materialPropertiesOffset;
+    std::int64_t stateVarsOffset;
+    std::int32_t nElementProperties;
+    std::int32_t nMaterialProperties;
+    std::int32_t nStateVars;
+    std::int32_t nQuadraturePoints;
+  };
+
+  /** @brief Layout of the state variables of the quadrature points, shared by elements of the same type. */
+  struct LayoutRecord {
+    std::int64_t firstEntry;
+    std::int32_t nEntries;
+    std::int32_t quadraturePointStride;
+  };
+
+  /** @brief A named state within the state variables of a quadrature point. */
+  struct LayoutEntry {
+    char         name[48];
+    std::int32_t offset;
+    std::int32_t size;
+  };
+
+  /** @brief An element to be written to a checkpoint, with the properties and state assigned by the host. */
+  struct ElementData {
+    MarmotElement*        element;
+    int                   elementLabel;
+    ElementProperties     elementProperties;
+    MarmotMaterialSection materialSection;
+    const double*         stateVars;
+    int                   nStateVars;
+  };
+
+  /**
+   * @brief Write a checkpoint of elements.
+   *
+   * The checkpoint is written to <fileName>.tmp, synchronized to the storage device and renamed to fileName, such
+   * that an existing checkpoint is replaced only by a complete one.
+   * @param fileName Name of the checkpoint file.
+   * @param elements Elements with their properties and state.
+   * @param stateNames Names of the states recorded in the layout descriptors (e.g., "stress", "strain");
+   * states not located in the quadrature point state of an element are not recorded for this element.
+   */
+  void writeCheckpoint( const std::string&                fileName,
+                        const std::vector< ElementData >& elements,
+                        const std::vector< std::string >& stateNames = {} );
+
+  /**
+   * @class CheckpointFile
+   * @brief A checkpoint file mapped into memory for restart.
+   */
+  class CheckpointFile {
+
+  public:
+    /**
+     * @brief Map a checkpoint file copy-on-write.
+     * @details All tables and the ranges of all records are checked against the size of the file, such that a
+     * corrupt checkpoint is rejected with a std::runtime_error instead of causing reads outside the mapping.
+     * @param fileName Name of the checkpoint file.
+     */
+    explicit CheckpointFile( const std::string& fileName );
+
+    CheckpointFile( const CheckpointFile& )            = delete;
+    CheckpointFile& operator=( const CheckpointFile& ) = delete;
+
+    ~CheckpointFile();
+
+    /** @return Number of elements in the checkpoint. */
+    int getNumberOfElements() const { return header->nElements; }
+
+    /** @return Record of an element. */
+    const ElementRecord& getElementRecord( int element ) const;
+
+    /** @return Element properties of an element, valid as long as the file is mapped. */
+    ElementProperties getElementProperties( int element ) const;
+
+    /** @return Material section of an element, valid as long as the file is mapped. */
+    MarmotMaterialSection getMaterialSection( int element ) const;
+
+    /** @return State variables of an element in the mapped memory, loaded on the first access. */
+    double* getStateVars( int element ) const;
+
+    /**
+     * @brief Access a state of an element at a quadrature point by the layout descriptor, without an element instance.
+     * @note Throws if the state was not recorded for the element.
+     */
+    StateView getStateView( int element, const std::string& stateName, int quadraturePoint ) const;
+
+    /**
+     * @brief Create an element with its properties and state variables assigned from the checkpoint.
+     * @details The node coordinates must be assigned by the host, followed by initializeYourself. The properties and
+     * the state variables of the element point into the mapped file, hence the CheckpointFile must outlive the element.
+     * @return New element, owned by the caller.
+     */
+    MarmotElement* createElement( int element ) const;
+
+  private:
+    std::string fileName;
+    char*       data = nullptr;
+    std::size_t size = 0;
+
+    const FileHeader*    header;
+    const ElementRecord* elements;
+    const LayoutRecord*  layouts;
+    const LayoutEntry*   layoutEntries;
+    const double*        properties;
+    double*              stateVars;
+
+    void unmap();
+
+    /* check the tables and all records against the size of the file, and assign the tables; returns a description
+     * of the first defect, or an empty string */
+    std::string assignTables();
+  };
+
+} // namespace Marmot::Checkpoint
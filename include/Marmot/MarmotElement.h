@@ -28,6 +28,9 @@
 #pragma once
 #include "Marmot/MarmotElementProperty.h"
 #include "Marmot/MarmotJournal.h"
+#include "Marmot/MarmotPerformanceCounters.h"
+#include "Marmot/MarmotStatus.h"
+#include "Marmot/MarmotTracing.h"
 #include "Marmot/MarmotUtils.h"
 #include <stdexcept>
 #include <string>
@@ -65,6 +68,41 @@ public:
     SurfaceTraction, ///< Surface traction vector
   };
 
+  /**
+   * @brief Parameters of the Newmark family of implicit time integration schemes.
+   * @details The effective residual and tangent are weighted as in the generalized-alpha method,
+   * \f[
+   *   \mathbf{P}_e = - \mathbf{M} \mathbf{a}_{n+1-\alpha_m} - (1-\alpha_f) \left( \mathbf{f}_{int} + \mathbf{C}
+   *   \mathbf{v}_{n+1} \right), \qquad
+   *   \mathbf{K}_e = (1-\alpha_f) \left( \mathbf{K} + c_1 \mathbf{C} \right) + (1-\alpha_m) c_0 \mathbf{M},
+   * \f]
+   * with \f$c_0 = 1/(\beta \Delta t^2)\f$, \f$c_1 = \gamma/(\beta \Delta t)\f$ and Rayleigh damping
+   * \f$\mathbf{C} = a_M \mathbf{M} + a_K \mathbf{K}\f$. The internal and damping forces of the previous increment,
+   * weighted by \f$\alpha_f\f$, are added by the host. Newmark: \f$\alpha_m = \alpha_f = 0\f$; HHT:
+   * \f$\alpha_m = 0\f$, \f$\alpha_f = \alpha\f$, \f$\beta = (1+\alpha)^2/4\f$, \f$\gamma = 1/2 + \alpha\f$.
+   */
+  struct NewmarkParameters {
+    double beta              = 0.25; ///< Newmark parameter \f$\beta\f$
+    double gamma             = 0.5;  ///< Newmark parameter \f$\gamma\f$
+    double alphaM            = 0.0;  ///< Weight \f$\alpha_m\f$ of the previous accelerations in the inertia forces
+    double alphaF            = 0.0;  ///< Weight \f$\alpha_f\f$ of the previous internal and damping forces
+    double rayleighMass      = 0.0;  ///< Mass proportional Rayleigh damping coefficient \f$a_M\f$
+    double rayleighStiffness = 0.0;  ///< Stiffness proportional Rayleigh damping coefficient \f$a_K\f$
+  };
+
+  /**
+   * @brief A state resolved once by name, for gathering it at all quadrature points, see resolveStateField.
+   * @details An accessor can be reused for all elements of the same type with the same material. If offset is
+   * negative, the state cannot be located by a fixed offset, and it is gathered through getStateView.
+   */
+  struct StateFieldAccessor {
+    std::string name;        ///< Name of the state
+    int         offset = -1; ///< Offset of the state within the state variables of a quadrature point
+    int         size   = 0;  ///< Number of values per quadrature point
+  };
+
+  int elementCode = -1; ///< Code in the MarmotElementFactory, assigned on creation by the factory.
+
   /** @brief Virtual destructor for safe polymorphic cleanup. */
   virtual ~MarmotElement();
 
@@ -102,6 +140,34 @@ public:
    */
   virtual void assignStateVars( double* stateVars, int nStateVars ) = 0;
 
+  /**
+   * @brief Assign a pair of state variable arrays: the working state and the state at the begin of the increment.
+   * @details Each computation computes the working state from the old state, which is never modified by the element.
+   * A cutback discards the working state, and the host accepts an increment by swapStateBuffers, without copying the
+   * state variables.
+   * @param[in,out] stateVars Pointer to the working state variable array.
+   * @param[in] stateVarsOld Pointer to the state variable array at the begin of the increment.
+   * @param[in] nStateVars Number of state variables.
+   * @note Default implementation throws an exception.
+   */
+  virtual void assignStateVarsDoubleBuffered( double* stateVars, const double* stateVarsOld, int nStateVars )
+  {
+    throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << " not yet implemented" );
+  };
+
+  /**
+   * @brief Accept the increment of a pair of state variable arrays by swapping their roles.
+   * @details The working state becomes the state at the begin of the next increment, and the next computation
+   * overwrites the former old state. Unlike assigning the swapped arrays again, the state variable managers of the
+   * element and its materials are rebound in place, without reallocation. Both arrays belong to the host and must be
+   * writable, and the host swaps its own references to the arrays accordingly.
+   * @note Requires arrays assigned by assignStateVarsDoubleBuffered. Default implementation throws an exception.
+   */
+  virtual void swapStateBuffers()
+  {
+    throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << " not yet implemented" );
+  };
+
   /**
    * @brief Assign element property set.
    * @param[in] property Element property object containing material, geometry, etc.
@@ -204,6 +270,34 @@ public:
     throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << " not yet implemented" );
   };
 
+  /**
+   * @brief Compute the effective residual and tangent of an implicit dynamic step, see NewmarkParameters.
+   * @param[in] QTotal Total dof vector.
+   * @param[in] dQ Incremental dof vector.
+   * @param[in] V Nodal velocities at the begin of the increment.
+   * @param[in] A Nodal accelerations at the begin of the increment.
+   * @param[out] P Effective residual vector.
+   * @param[out] K Effective tangent matrix.
+   * @param[in] time Current time.
+   * @param[in] dT Time step size.
+   * @param[out] pNewdT Suggested new time step size.
+   * @param[in] parameters Parameters of the time integration scheme.
+   * @note Default implementation throws an exception.
+   */
+  virtual void computeYourselfDynamic( const double*            QTotal,
+                                       const double*            dQ,
+                                       const double*            V,
+                                       const double*            A,
+                                       double*                  P,
+                                       double*                  K,
+                                       const double*            time,
+                                       double                   dT,
+                                       double&                  pNewdT,
+                                       const NewmarkParameters& parameters )
+  {
+    throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << " not yet implemented" );
+  };
+
   /**
    * @brief Access element state at a quadrature point.
    * @param[in] stateName Name of the state variable.
@@ -226,4 +320,75 @@ public:
 
   /** @return Number of quadrature points used by the element. */
   virtual int getNumberOfQuadraturePoints() = 0;
+
+  /**
+   * @brief Resolve a state by name for gathering it with gatherStateField.
+   * @param[in] stateName Name of the state variable.
+   * @return Accessor of the state; the default implementation always gathers through getStateView.
+   */
+  virtual StateFieldAccessor resolveStateField( const std::string& stateName );
+
+  /**
+   * @brief Gather a state at all quadrature points.
+   * @param[in] accessor Accessor from resolveStateField.
+   * @param[out] values Buffer for getNumberOfQuadraturePoints() x accessor.size values, ordered by quadrature points.
+   */
+  virtual void gatherStateField( const StateFieldAccessor& accessor, double* values );
+
+  /**
+   * @brief Gather the coordinates of all quadrature points.
+   * @param[out] coordinates Buffer for getNumberOfQuadraturePoints() x getNSpatialDimensions() values.
+   */
+  virtual void gatherCoordinatesAtQuadraturePoints( double* coordinates );
+
+  /**
+   * @brief Gather a state at all quadrature points of many elements of the same type and material.
+   * @param[in] elements Array of elements.
+   * @param[in] nElements Number of elements.
+   * @param[in] accessor Accessor from resolveStateField of any of the elements.
+   * @param[out] values Buffer for the values of all elements, ordered by elements and quadrature points.
+   */
+  static void gatherStateField( MarmotElement* const*     elements,
+                                int                       nElements,
+                                const StateFieldAccessor& accessor,
+                                double*                   values );
+
+  /**
+   * @brief Gather the coordinates of all quadrature points of many elements.
+   * @param[in] elements Array of elements.
+   * @param[in] nElements Number of elements.
+   * @param[out] coordinates Buffer for the coordinates of all elements, ordered by elements and quadrature points.
+   */
+  static void gatherCoordinatesAtQuadraturePoints( MarmotElement* const* elements, int nElements, double* coordinates );
+
+  /**
+   * @brief Get the status of the last computation.
+   * @details Besides reducing pNewdT, elements record the reason of a cutback and the failing quadrature point in
+   * the status, which is reset at the begin of each computeYourself.
+   * @return Status of the last computation.
+   */
+  const Marmot::Status& getStatus() const { return status; }
+
+protected:
+  Marmot::Status status; ///< Status of the last computation.
+
+  /**
+   * @brief Record a failed computation, which requires a reduced time increment.
+   * @param[in] qpStatus Status of the failure, see Marmot::Status::atQuadraturePoint.
+   */
+  void requestCutback( const Marmot::Status& qpStatus )
+  {
+    status.merge( qpStatus );
+    countEvent( Marmot::PerformanceCounters::Cutbacks );
+  }
+
+  /**
+   * @brief Count an event of this element, see Marmot::PerformanceCounters.
+   * @param[in] counter Counted event.
+   * @param[in] value Increment.
+   */
+  void countEvent( Marmot::PerformanceCounters::Counter counter, long int value = 1 ) const
+  {
+    Marmot::PerformanceCounters::count( Marmot::PerformanceCounters::Element, elementCode, counter, value );
+  }
 };
@@ -0,0 +1,195 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ * Magdalena Schreter magdalena.schreter@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+#pragma once
+#include "Marmot/MarmotElement.h"
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Marmot::Execution {
+
+  /**
+   * @class ElementExecutor
+   * @brief Shared memory parallel evaluation of MarmotElement::computeYourself for arrays of elements.
+   *
+   * The elements are distributed over a persistent pool of threads with work stealing: each thread starts with a
+   * contiguous range of elements, which it processes in chunks of grainSize elements from the front. Idle threads steal
+   * the back half of the remaining range of another thread. Thus, elements with strongly varying cost (e.g., elastic
+   * vs. substepped plastic material points) are balanced without a static schedule. The calling thread participates
+   * in the computation.
+   *
+   * State variables, properties and coordinates must be assigned to the elements beforehand; the elements must not
+   * share state, as they are computed concurrently.
+   */
+  class ElementExecutor {
+
+  public:
+    /** @brief Buffers of the elements to compute; all arrays have one entry per element. */
+    struct ElementBuffers {
+      MarmotElement* const* elements;
+      int                   nElements;
+      const double* const*  QTotal;
+      const double* const*  dQ;
+      double* const*        Pe;
+      double* const*        Ke;
+    };
+
+    /**
+     * @brief Optional assembly of the internal forces into a global vector.
+     * @details Without deterministic reduction, each thread assembles its elements into a thread-local vector
+     * immediately after computing them, and the thread-local vectors are summed up afterwards. As the assignment of
+     * elements to threads depends on the scheduling, the result may differ in the last bits between runs. With
+     * deterministic reduction, the element vectors are assembled in the order of the elements after the computation,
+     * with each thread assembling a range of global dofs, which yields bitwise reproducible results. For the
+     * deterministic reduction, the contributions of the elements to the global dofs are indexed once per assembly
+     * layout, see prepareAssembly.
+     */
+    struct Assembly {
+      /** Global dof indices of the element vectors, one array of MarmotElement::getNDofPerElement() per element. */
+      const int* const* dofIndices;
+      /** Global internal force vector (accumulated). */
+      double* P;
+      /** Size of the global vector. */
+      int nDofs;
+      /** Reproducible summation independent of the scheduling. */
+      bool isDeterministic = false;
+    };
+
+    /**
+     * @brief Construct the executor and start the thread pool.
+     * @param nThreads Number of threads, including the calling thread.
+     * @param grainSize Number of elements a thread takes at once from its range.
+     */
+    explicit ElementExecutor( int nThreads = std::thread::hardware_concurrency(), int grainSize = 4 );
+
+    ElementExecutor( const ElementExecutor& )            = delete;
+    ElementExecutor& operator=( const ElementExecutor& ) = delete;
+
+    ~ElementExecutor();
+
+    /** @brief Number of threads, including the calling thread. */
+    int getNumberOfThreads() const { return nThreads; }
+
+    /**
+     * @brief Compute all elements, and optionally assemble their internal forces.
+     * @details If an element requests a cutback (pNewDT<1), the elements not yet started are skipped and no assembly
+     * is performed. Exceptions thrown by elements are rethrown in the calling thread after all threads have stopped.
+     * Messages buffered in the MarmotJournal are flushed once all elements are computed.
+     * @param buffers Elements and their dof and output buffers.
+     * @param time Time data forwarded to the elements.
+     * @param dT Time increment.
+     * @param pNewDT Suggested scaling of dT; the minimum of all elements.
+     * @param assembly Optional assembly of the internal forces, or nullptr.
+     */
+    void computeYourself( const ElementBuffers& buffers,
+                          const double*         time,
+                          double                dT,
+                          double&               pNewDT,
+                          const Assembly*       assembly = nullptr );
+
+    /**
+     * @brief Index the contributions of the element vectors to the global dofs for the deterministic reduction.
+     * @details The global dofs are split into one contiguous range per thread with about the same number of
+     * contributions, so that each thread only visits the contributions to its own dofs. computeYourself builds the
+     * index on demand if the elements, the dof index arrays or the sizes differ from the indexed ones; this must be
+     * called explicitly if the contents of the dof index arrays are changed in place.
+     * @param buffers Elements to assemble.
+     * @param assembly Assembly of the internal forces.
+     */
+    void prepareAssembly( const ElementBuffers& buffers, const Assembly& assembly );
+
+  private:
+    /* per thread range of elements and thread-local outputs */
+    struct Worker {
+      std::mutex            mutex;
+      int                   begin = 0;
+      int                   end   = 0;
+      double                pNewDT;
+      std::vector< double > P;
+    };
+
+    const int nThreads;
+    const int grainSize;
+
+    std::vector< std::unique_ptr< Worker > > workers;
+    std::vector< std::thread >               threads;
+
+    /* contribution of an entry of an element vector to a global dof */
+    struct Contribution {
+      int element;
+      int index;
+    };
+
+    /* contributions in compressed row storage over the global dofs, in the order of the elements for each dof */
+    struct ReductionIndex {
+      MarmotElement* const*       elements   = nullptr;
+      const int* const*           dofIndices = nullptr;
+      int                         nElements  = -1;
+      int                         nDofs      = -1;
+      std::vector< int >          dofBegin;
+      std::vector< Contribution > contributions;
+      std::vector< int >          threadDofBegin;
+    };
+
+    ReductionIndex reductionIndex;
+
+    /* dispatch of jobs to the pool */
+    std::mutex                   poolMutex;
+    std::condition_variable      jobAvailable;
+    std::condition_variable      jobFinished;
+    std::function< void( int ) > job;
+    long int                     generation    = 0;
+    int                          nBusyThreads  = 0;
+    bool                         isTerminating = false;
+
+    /* state of the current computation */
+    std::atomic< bool > isCancelled;
+    std::mutex          exceptionMutex;
+    std::exception_ptr  exception;
+
+    /* run a job on all threads, with the id of the thread as argument */
+    void runOnAllThreads( const std::function< void( int ) >& job );
+
+    void runWorker( int id );
+
+    /* take the next chunk of elements from the own range, or steal from another thread */
+    bool takeChunk( int id, int& begin, int& end );
+
+    void computeElements( int                   id,
+                          const ElementBuffers& buffers,
+                          const double*         time,
+                          double                dT,
+                          const Assembly*       assembly );
+  };
+
+} // namespace Marmot::Execution
@@ -26,12 +26,18 @@
  * ---------------------------------------------------------------------
  */
 #pragma once
+#include <memory>
+
+class MarmotMaterialSectionData;
 
 /** @struct MarmotMaterialSection
  * @brief Structure to hold material section properties.
  *
  * This structure is used to define a material section with its code and properties,
  * allowing for flexible material definitions in finite element analysis.
+ * Materials created from the same section object share their section data, see MarmotMaterialSectionData. Distinct
+ * section objects with identical code and property values share their section data only if all of them opt in, as
+ * the data of an increment is computed for the time and increment of the first material accessing it.
  */
 class MarmotMaterialSection {
 public:
@@ -39,6 +45,12 @@ public:
   const double* materialProperties;
   int           nMaterialProperties;
 
+  /// Data shared by the materials of the section, created with the first material or taken from an equal section.
+  mutable std::shared_ptr< MarmotMaterialSectionData > sectionData;
+
+  /// Share the section data with equal sections opting in, e.g., equal sections of a model (default: false).
+  bool isSharingDataWithEqualSections = false;
+
   MarmotMaterialSection( int materialCode, const double* materialProperties, int nMaterialProperties )
     : materialCode( materialCode ),
       materialProperties( materialProperties ),
@@ -0,0 +1,186 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ * Magdalena Schreter magdalena.schreter@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+#pragma once
+#include "Marmot/MarmotElement.h"
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Marmot::Output {
+
+  /**
+   * @class EnsightWriter
+   * @brief Binary Ensight Gold output of nodal and element fields, written on a background thread.
+   *
+   * The mesh is written once as a single part, with the elements grouped by their shape (see
+   * MarmotElement::getElementShape). For each increment, writeIncrement takes a snapshot of all registered fields
+   * and hands it to the background thread, which writes one variable file per field and updates the case file. The
+   * snapshots are double buffered: the solver fills the next snapshot while the previous one is written, and waits
+   * only if the previous snapshot is not yet written when the next one is submitted.
+   *
+   * Element fields are states of the elements (e.g., "stress"), averaged over the quadrature points of each element.
+   * The states are resolved once by MarmotElement::resolveStateField and gathered in bulk. Fields with 1, 3, 6 or 9
+   * components are written as scalars, vectors, symmetric tensors (11, 22, 33, 12, 13, 23) or tensors; nodal fields
+   * with 2 components are written as vectors in the plane. States with 6 components named like strains (i.e.,
+   * containing "strain" in any case) are stored in Voigt notation with engineering shear components, which are halved
+   * to obtain the tensor components.
+   *
+   * The mesh arrays and the elements must remain valid during the lifetime of the writer.
+   */
+  class EnsightWriter {
+
+  public:
+    /** @brief Mesh of the model, written as the geometry. */
+    struct Mesh {
+      /** Coordinates of the nodes, nNodes x nDim. */
+      const double* nodeCoordinates;
+      /** Number of nodes. */
+      int nNodes;
+      /** Number of spatial dimensions of the node coordinates. */
+      int nDim;
+      /** Elements of the mesh. */
+      MarmotElement* const* elements;
+      /** Number of elements. */
+      int nElements;
+      /** Node indices of each element (starting from 0), in the node order of the element. */
+      const int* const* connectivity;
+    };
+
+    /**
+     * @brief Create the output directory and write the geometry.
+     * @param directory Directory of the case, created if it does not exist.
+     * @param caseName Name of the case file and prefix of all other files.
+     * @param mesh Mesh of the model.
+     */
+    EnsightWriter( const std::string& directory, const std::string& caseName, const Mesh& mesh );
+
+    EnsightWriter( const EnsightWriter& )            = delete;
+    EnsightWriter& operator=( const EnsightWriter& ) = delete;
+
+    /** @brief Write the pending snapshot and stop the background thread. */
+    ~EnsightWriter();
+
+    /**
+     * @brief Register a nodal field, which is provided by the host in writeIncrement.
+     * @param name Name of the field.
+     * @param nComponents Number of values per node.
+     * @note Fields must be registered before the first increment is written.
+     */
+    void addNodeField( const std::string& name, int nComponents );
+
+    /**
+     * @brief Register an element field, gathered from a state of the elements.
+     * @param name Name of the field.
+     * @param stateName Name of the state, see MarmotElement::getStateView.
+     * @note Fields must be registered before the first increment is written.
+     */
+    void addElementField( const std::string& name, const std::string& stateName );
+
+    /**
+     * @brief Take a snapshot of all fields and write it on the background thread.
+     * @param time Time of the increment.
+     * @param nodeFields Values of the nodal fields in the order of registration, nNodes x nComponents each.
+     * @note Exceptions of the background thread (e.g., on a full disk) are rethrown by the next call.
+     */
+    void writeIncrement( double time, const double* const* nodeFields = nullptr );
+
+    /**
+     * @brief Wait until all snapshots are written.
+     * @note Exceptions of the background thread are rethrown.
+     */
+    void finish();
+
+  private:
+    struct Field {
+      std::string name;
+      std::string type;
+      int         nComponents;
+      int         nComponentsWritten;
+    };
+
+    /* element field with the accessors of the states of all elements */
+    struct ElementField : Field {
+      std::vector< MarmotElement::StateFieldAccessor > accessors;
+      bool                                             hasEngineeringShear;
+    };
+
+    /* the values of all fields of an increment, in the order of the variable files */
+    struct Snapshot {
+      double                              time;
+      std::vector< std::vector< float > > nodeFields;
+      std::vector< std::vector< float > > elementFields;
+    };
+
+    const std::string directory;
+    const std::string caseName;
+    const Mesh        mesh;
+
+    /* fixed after the first increment, as they are read by the background thread and listed for all steps */
+    std::vector< Field >        nodeFields;
+    std::vector< ElementField > elementFields;
+
+    /* elements grouped by shape: the order of the elements, and the shapes and bounds of the groups */
+    std::vector< int >         elementOrder;
+    std::vector< std::string > groupShapes;
+    std::vector< int >         groupBegin;
+
+    std::vector< double > stateBuffer;
+    std::vector< double > times;
+    bool                  hasWrittenIncrement = false;
+
+    /* snapshot filled by the solver, and snapshot written by the background thread */
+    Snapshot next;
+    Snapshot current;
+
+    std::thread             thread;
+    std::mutex              mutex;
+    std::condition_variable snapshotSubmitted;
+    std::condition_variable snapshotWritten;
+    bool                    hasPendingSnapshot = false;
+    bool                    isTerminating      = false;
+    std::exception_ptr      exception;
+
+    void writeGeometry();
+
+    void writeSnapshot( const Snapshot& snapshot, int step );
+
+    void writeCaseFile();
+
+    void run();
+
+    void checkNoIncrementWritten( const char* function ) const;
+
+    void rethrowException();
+
+    std::string getFileName( const std::string& suffix ) const;
+  };
+
+} // namespace Marmot::Output
@@ -25,9 +25,16 @@
  * ---------------------------------------------------------------------
  */
 #pragma once
+#include <atomic>
+#include <chrono>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 /** @class MakeString
  * @brief Utility class for constructing strings with stream-like syntax.
@@ -54,22 +61,104 @@ public:
  *
  * This class provides a centralized way to handle warning and notification messages,
  * allowing them to be directed to a specified output stream (e.g., console, file).
+ *
+ * The journal is thread safe. Optionally, messages are collected in per-thread buffers, which are written to the
+ * output stream if they exceed a size threshold, after a time interval, or on an explicit call to flush().
+ * Identical messages can be rate limited, i.e., each thread writes a message at most maxRepetitions times per flush
+ * period, and the number of suppressed repetitions is reported on flushing.
+ *
+ * Only the thread owning a buffer writes to it, hence messages are buffered without any locking. A shared lock is
+ * taken once per thread to register its buffer, and the output stream is locked only when a buffer is written to it.
+ * flush() collects the buffers of all threads and must therefore be called at synchronization points, where no other
+ * thread writes messages, e.g., at the end of each increment; Marmot::Execution::ElementExecutor flushes after each
+ * computation, once its worker threads are idle.
  */
 class MarmotJournal {
+public:
+  /**
+   * @brief Severity of a message. Messages below the minimum severity are discarded without any formatting.
+   */
+  enum class Severity { Notification, Warning, Silent };
+
+  /**
+   * @brief Options for buffering and rate limiting.
+   */
+  struct Options {
+    bool                      bufferPerThread = false;   ///< collect messages in per-thread buffers
+    size_t                    flushThreshold  = 1 << 16; ///< buffer size in bytes which triggers a flush
+    std::chrono::milliseconds flushInterval{ 1000 };     ///< time interval which triggers a flush
+    int                       maxRepetitions     = -1;   ///< max. identical messages per thread and flush; -1: unlimited
+    size_t                    maxTrackedMessages = 1024; ///< max. distinct messages counted per thread and flush
+  };
+
 private:
+  struct ThreadBuffer;
+
+  struct StringHash {
+    using is_transparent = void;
+    size_t operator()( std::string_view string ) const { return std::hash< std::string_view >{}( string ); }
+  };
+
+  using MessageCounts = std::unordered_map< std::string, long int, StringHash, std::equal_to<> >;
+
   static MarmotJournal& getInstance();
 
+  static ThreadBuffer& getThreadBuffer();
+
+  static void write( Severity severity, std::string_view message );
+
+  static void writeToOutput( std::string_view content );
+
+  static std::string takeContent( ThreadBuffer& threadBuffer, MessageCounts& suppressedMessages );
+
+  static std::string summarizeSuppressedMessages( const MessageCounts& suppressedMessages );
+
+  inline static std::atomic< int > minimumSeverity{ static_cast< int >( Severity::Notification ) };
+
   std::ostream output;
 
+  std::mutex outputMutex;
+
+  std::mutex registryMutex;
+
+  std::vector< std::shared_ptr< ThreadBuffer > > threadBuffers;
+
+  Options options;
+
   MarmotJournal();
 
 public:
   MarmotJournal( MarmotJournal const& )  = delete;
   void operator=( MarmotJournal const& ) = delete;
 
+  ~MarmotJournal();
+
   static void setMSGOutputDirection( std::ostream& newOutputStream );
 
+  /**
+   * @brief Sets the buffering and rate limiting options.
+   * @note Must not be called concurrently to writing messages.
+   */
+  static void setOptions( const Options& newOptions );
+
+  static void setMinimumSeverity( Severity severity );
+
+  static bool isEnabled( Severity severity )
+  {
+    return static_cast< int >( severity ) >= minimumSeverity.load( std::memory_order_relaxed );
+  }
+
+  /**
+   * @brief Writes the content of all per-thread buffers and the counts of suppressed messages to the output.
+   * @note Must not be called concurrently to writing messages.
+   */
+  static void flush();
+
   static bool warningToMSG( const std::string& message );
 
+  static bool warningToMSG( const char* message );
+
   static bool notificationToMSG( const std::string& message );
+
+  static bool notificationToMSG( const char* message );
 };
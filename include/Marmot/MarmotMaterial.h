@@ -26,8 +26,48 @@
  * ---------------------------------------------------------------------
  */
 #pragma once
+#include "Marmot/MarmotConfig.h"
+#include "Marmot/MarmotPerformanceCounters.h"
+#include "Marmot/MarmotStatus.h"
+#include "Marmot/MarmotTracing.h"
 #include "Marmot/MarmotUtils.h"
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
+
+/**
+ * @class MarmotMaterialSectionData
+ * @brief Base class for data shared by all materials of a section.
+ *
+ * Materials store quantities which are identical for all quadrature points of a section, such as elastic stiffness
+ * tensors or time dependent factors of an increment, in a derived class. The data is created once per section by
+ * MarmotMaterial::createSectionData(), and quantities depending on the increment are computed once per increment by
+ * MarmotMaterial::beginIncrement(). Materials of a section, and optionally of equal sections, share the same section
+ * data, see MarmotLibrary::MarmotMaterialFactory::createMaterial( section, materialNumber ).
+ */
+class MarmotMaterialSectionData {
+public:
+  virtual ~MarmotMaterialSectionData() = default;
+
+private:
+  friend class MarmotMaterial;
+
+  /** @brief Whether the quantities of the given increment are computed; lock free. */
+  bool isPreparedFor( const double* time, double dT ) const
+  {
+    return this->dT.load( std::memory_order_acquire ) == dT &&
+           this->time[0].load( std::memory_order_acquire ) == time[0] &&
+           this->time[1].load( std::memory_order_acquire ) == time[1];
+  }
+
+  std::mutex            mutex; ///< Serializes the precomputation of an increment.
+  std::atomic< double > time[2] = { std::numeric_limits< double >::quiet_NaN(),
+                                    std::numeric_limits< double >::quiet_NaN() };
+  std::atomic< double > dT      = std::numeric_limits< double >::quiet_NaN(); ///< Increment of the last precomputation.
+};
 
 /**
  * @class MarmotMaterial
@@ -43,11 +83,17 @@ protected:
   const double* materialProperties;  ///< Pointer to array of material property values.
   const int     nMaterialProperties; ///< Number of material properties.
 
-  double* stateVars;                 ///< Pointer to array of state variables.
-  int     nStateVars;                ///< Number of assigned state variables.
+  double*       stateVars;           ///< Pointer to array of state variables.
+  int           nStateVars;          ///< Number of assigned state variables.
+  const double* stateVarsOld;        ///< Pointer to state variables at the begin of the increment, if assigned.
+
+  Marmot::Status status; ///< Status of the last computation.
+
+  std::shared_ptr< MarmotMaterialSectionData > sectionData; ///< Data shared with the materials of the section.
 
 public:
-  const int materialNumber; ///< Identifier for material type/implementation.
+  const int materialNumber;    ///< Identifier for material type/implementation.
+  int       materialCode = -1; ///< Code in the MarmotMaterialFactory, assigned on creation by the factory.
 
   /**
    * @brief Construct a material object.
@@ -72,6 +118,26 @@ public:
    */
   virtual void assignStateVars( double* stateVars, int nStateVars );
 
+  /**
+   * @brief Assign a pair of state variable buffers: the working state and the state at the begin of the increment.
+   * @details The old state is never modified by the material. Each computation computes the complete working state
+   * from the old state, so neither the host nor the wrappers restore the working state between iterations. A cutback
+   * simply discards the working state, and the host accepts an increment by swapping the buffers and assigning them
+   * again. Materials updating their state variables in place restore the working state at the begin of each
+   * computation by restoreStateVars(), materials with large states (e.g., Kelvin chains) read the old state through
+   * getStateVarAtBeginOfIncrement() and write the working state without copying.
+   * @param[in,out] stateVars Working state variables, computed by the material.
+   * @param[in] stateVarsOld State variables at the begin of the increment.
+   * @param[in] nStateVars Number of state variables.
+   */
+  void assignStateVarsDoubleBuffered( double* stateVars, const double* stateVarsOld, int nStateVars );
+
+  /**
+   * @brief Reset the working state variables to the state at the begin of the increment.
+   * @details Does nothing if only a single buffer is assigned, which is updated in place.
+   */
+  void restoreStateVars();
+
   /**
    * @brief Access material state variables by name.
    * @param[in] stateName Name of the requested state variable.
@@ -85,12 +151,71 @@ public:
    */
   double* getAssignedStateVars();
 
+  /**
+   * @brief Get pointer to the assigned state variables at the begin of the increment.
+   * @return Pointer to old state variable array, or nullptr if only a single buffer is assigned.
+   */
+  const double* getAssignedStateVarsOld();
+
   /**
    * @brief Get number of assigned state variables.
    * @return Number of assigned state variables.
    */
   int getNumberOfAssignedStateVars();
 
+  /**
+   * @brief Get the status of the last computation.
+   * @details Materials signal a failed computation by requestCutback() instead of throwing an exception. The status
+   * is kept until it is reset by the host with resetStatus().
+   * @return Status of the last computation.
+   */
+  const Marmot::Status& getStatus() const;
+
+  /**
+   * @brief Reset the status and the number of inner Newton iterations before a computation.
+   */
+  void resetStatus();
+
+  /**
+   * @brief Enable or disable warm starting of inner Newton schemes.
+   * @details Materials supporting warm starts begin their inner (return mapping) Newton scheme from the converged
+   * solution of the previous computation of the same increment, i.e., of the previous global iteration, instead of
+   * the cold start. The solution is kept in a scratch slot of the material object, not in the state variables.
+   * Enabled by default if MARMOT_ENABLE_INNER_NEWTON_WARM_START is defined (CMake option
+   * MARMOT_INNER_NEWTON_WARM_START).
+   * @param[in] enable Whether inner Newton schemes are warm started.
+   */
+  void setInnerNewtonWarmStart( bool enable );
+
+  /**
+   * @return Number of inner Newton iterations since the last resetStatus().
+   */
+  int getNumberOfInnerNewtonIterations() const;
+
+  /**
+   * @brief Create the data shared by all materials of a section.
+   * @details Called once per section by MarmotMaterialFactory::createMaterial( section, materialNumber ), and by
+   * materials without assigned section data on their first access.
+   * @return The section data, or nullptr if the material does not share any data (default).
+   */
+  virtual std::shared_ptr< MarmotMaterialSectionData > createSectionData();
+
+  /**
+   * @brief Assign the data shared by all materials of a section.
+   * @param[in] sectionData Section data created by a material with identical code and properties.
+   */
+  void assignSectionData( std::shared_ptr< MarmotMaterialSectionData > sectionData );
+
+  /**
+   * @brief Compute the quantities of the section data depending on the increment ahead of the computations.
+   * @details Optional; a host computing the materials of a section concurrently may call it once per increment on
+   * any material of the section before the computations, which then find the section data prepared and access it
+   * without locking. Materials without section data ignore the call.
+   * @param[in] time Step time and total time, as passed to computeStress.
+   * @param[in] dT Time increment.
+   */
+  void prepareIncrement( const double* time, double dT );
+
   /**
    * @brief Initialize material state (default: no action).
    */
@@ -101,4 +226,133 @@ public:
    * @return Density value (default: 0 if not overridden).
    */
   virtual double getDensity();
+
+protected:
+  /**
+   * @brief Compute the quantities of the section data depending on the increment (default: no action).
+   * @details Called once per section and increment by the first material accessing the section data for the
+   * increment, see getSectionData( time, dT ).
+   * @param[in,out] sectionData Section data created by createSectionData().
+   * @param[in] time Step time and total time, as passed to computeStress.
+   * @param[in] dT Time increment.
+   */
+  virtual void beginIncrement( MarmotMaterialSectionData& sectionData, const double* time, double dT );
+
+  /**
+   * @brief Access the section data for quantities independent of the increment.
+   * @return The section data created by createSectionData() of the concrete material.
+   */
+  template < typename SectionDataType >
+  const SectionDataType& getSectionData()
+  {
+    return static_cast< const SectionDataType& >( prepareSectionData() );
+  }
+
+  /**
+   * @brief Access the section data, with the quantities depending on the increment computed by beginIncrement().
+   * @note All materials of a section are expected to be computed for the same increment at a time; materials may
+   * be computed concurrently. Only the first access of an increment locks the section data, unless the host
+   * prepared it by prepareIncrement().
+   * @param[in] time Step time and total time, as passed to computeStress.
+   * @param[in] dT Time increment.
+   * @return The section data created by createSectionData() of the concrete material.
+   */
+  template < typename SectionDataType >
+  const SectionDataType& getSectionData( const double* time, double dT )
+  {
+    return static_cast< const SectionDataType& >( prepareSectionData( time, dT ) );
+  }
+
+  /**
+   * @brief Initial guess of an inner Newton scheme.
+   * @param[in] time Time identifying the increment.
+   * @param[in] dT Time increment.
+   * @param[in,out] x Cold start of the unknowns, replaced by the stored solution of the same increment if warm
+   * starting is enabled.
+   * @param[in] n Number of unknowns.
+   * @return Whether the unknowns are warm started.
+   */
+  bool warmStartInnerNewton( double time, double dT, double* x, int n ) const;
+
+  /**
+   * @brief Store the converged solution of an inner Newton scheme for warm starting the next computation of the
+   * same increment.
+   * @param[in] time Time identifying the increment.
+   * @param[in] dT Time increment.
+   * @param[in] x Converged unknowns.
+   * @param[in] n Number of unknowns.
+   */
+  void storeInnerNewtonSolution( double time, double dT, const double* x, int n );
+
+  /**
+   * @brief Count an iteration of an inner Newton scheme, see getNumberOfInnerNewtonIterations().
+   */
+  void countInnerNewtonIteration()
+  {
+    innerNewtonScratch.nIterations += 1;
+    countEvent( Marmot::PerformanceCounters::InnerNewtonIterations );
+  }
+
+  /**
+   * @brief State variables at the begin of the increment, for restoring the working state in iterative schemes.
+   * @param[out] backup Copy of the state variables, made only if no old state variables are assigned.
+   * @return Pointer to the assigned old state variables, or to the backup.
+   */
+  const double* getStateVarsAtBeginOfIncrement( std::vector< double >& backup );
+
+  /**
+   * @brief Locate a state variable of the working state in the state at the begin of the increment.
+   * @param[in] stateVar Pointer into the working state variables.
+   * @return Pointer to the same state variable in the old state variables, or stateVar itself if only a single
+   * buffer is assigned.
+   */
+  const double* getStateVarAtBeginOfIncrement( const double* stateVar ) const;
+
+  /**
+   * @brief Back up the state variables for wrappers calling the material repeatedly within an increment.
+   * @details If a pair of buffers is assigned, the material computes from the old state, and no backup is made.
+   * @param[out] backup Copy of the state variables.
+   */
+  void backupStateVars( std::vector< double >& backup ) const;
+
+  /**
+   * @brief Restore the state variables from a backup made by backupStateVars().
+   * @param[in] backup Copy of the state variables, empty if a pair of buffers is assigned.
+   */
+  void restoreStateVarsFromBackup( const std::vector< double >& backup );
+
+  /**
+   * @brief Signal a failed computation, which requires a reduced time increment.
+   * @param[in] reason Reason of the failure.
+   * @param[in] suggestedDTFactor Suggested scaling of the time increment.
+   */
+  void requestCutback( Marmot::Status::Reason reason, double suggestedDTFactor );
+
+  /**
+   * @brief Count an event of this material, see Marmot::PerformanceCounters.
+   * @param[in] counter Counted event.
+   * @param[in] value Increment.
+   */
+  void countEvent( Marmot::PerformanceCounters::Counter counter, long int value = 1 ) const
+  {
+    Marmot::PerformanceCounters::count( Marmot::PerformanceCounters::Material, materialCode, counter, value );
+  }
+
+private:
+  /** @brief Scratch slot for warm starting inner Newton schemes. */
+  struct InnerNewtonScratch {
+#ifdef MARMOT_ENABLE_INNER_NEWTON_WARM_START
+    bool isWarmStartEnabled = true;
+#else
+    bool isWarmStartEnabled = false;
+#endif
+    double                time        = std::numeric_limits< double >::quiet_NaN();
+    double                dT          = std::numeric_limits< double >::quiet_NaN();
+    int                   nIterations = 0;
+    std::vector< double > solution;
+  } innerNewtonScratch;
+
+  MarmotMaterialSectionData& prepareSectionData();
+
+  MarmotMaterialSectionData& prepareSectionData( const double* time, double dT );
 };
@@ -0,0 +1,117 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ * Magdalena Schreter magdalena.schreter@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+#pragma once
+#include "Marmot/MarmotConfig.h"
+#include <array>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace Marmot::PerformanceCounters
+ * @brief Lightweight event counters for materials and elements.
+ *
+ * Counters are collected per thread without locking, separately for each material code and element code as
+ * registered in the MarmotMaterialFactory and MarmotElementFactory, and aggregated over all threads on demand.
+ *
+ * Counting is enabled at compile time by defining MARMOT_ENABLE_PERFORMANCE_COUNTERS (CMake option
+ * MARMOT_PERFORMANCE_COUNTERS). Otherwise, count() compiles to nothing.
+ */
+namespace Marmot::PerformanceCounters {
+
+#ifdef MARMOT_ENABLE_PERFORMANCE_COUNTERS
+  inline constexpr bool enabled = true;
+#else
+  inline constexpr bool enabled = false;
+#endif
+
+  /** @brief Kind of object an event is attributed to. */
+  enum Owner {
+    Material,
+    Element,
+  };
+
+  /** @brief Counted events. */
+  enum Counter {
+    ComputeStressCalls,       ///< calls of a material's computeStress
+    ComputeYourselfCalls,     ///< calls of an element's computeYourself
+    InnerNewtonIterations,    ///< iterations of a material's inner (return mapping) Newton scheme
+    PlaneStressIterations,    ///< iterations of the plane stress wrapper
+    UniaxialStressIterations, ///< iterations of the uniaxial stress wrapper
+    Cutbacks,                 ///< requests for a reduced time increment (pNewDT < 1)
+    BeginIncrementCalls,      ///< per increment precomputations of the data shared by a material section
+    nCounters
+  };
+
+  /** @brief Aggregated counters of a single material code or element code. */
+  struct Record {
+    Owner                             owner;
+    int                               code;   ///< material code or element code, -1 if not created by a factory
+    std::array< long int, nCounters > values; ///< indexed by Counter
+  };
+
+  /**
+   * @brief Add a value to a counter of the calling thread, regardless of the compile-time switch.
+   * @param[in] owner Kind of the object.
+   * @param[in] code Material code or element code of the object.
+   * @param[in] counter Counted event.
+   * @param[in] value Increment.
+   */
+  void add( Owner owner, int code, Counter counter, long int value );
+
+  /**
+   * @brief Add a value to a counter of the calling thread if counters are enabled at compile time.
+   */
+  inline void count( Owner owner, int code, Counter counter, long int value = 1 )
+  {
+    if constexpr ( enabled )
+      add( owner, code, counter, value );
+  }
+
+  /**
+   * @brief Aggregate the counters of all threads.
+   * @return One record per material code and element code, sorted by owner and code.
+   */
+  std::vector< Record > collect();
+
+  /**
+   * @brief Aggregate a single counter over all threads.
+   */
+  long int get( Owner owner, int code, Counter counter );
+
+  /**
+   * @brief Reset all counters. Must not be called concurrently to counted evaluations.
+   */
+  void reset();
+
+  /** @return Name of a counter. */
+  std::string getCounterName( Counter counter );
+
+  /** @return Human readable table of the aggregated counters. */
+  std::string summary();
+
+} // namespace Marmot::PerformanceCounters
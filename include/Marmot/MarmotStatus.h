@@ -0,0 +1,109 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ * Magdalena Schreter magdalena.schreter@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+#pragma once
+#include <algorithm>
+
+namespace Marmot {
+
+  /**
+   * @struct Status
+   * @brief Exception-free result of a material or element computation.
+   *
+   * A failed computation is not an error of the simulation, but a request for a smaller time increment. The status
+   * carries the reason, the suggested scaling of the time increment (the pNewDT convention) and the location of the
+   * failure, and is propagated from the materials via the elements to the host without stack unwinding.
+   */
+  struct Status {
+
+    /** @brief Reason of a failed computation. */
+    enum Reason {
+      Success,                    ///< computation succeeded
+      TimeStepReductionRequested, ///< the material requested a reduced time increment through pNewDT
+      InnerNewtonNotConverged,    ///< the inner (return mapping) Newton scheme of a material did not converge
+      NotConverged,               ///< the global Newton scheme (e.g., of a material point solver) did not converge
+      ExceptionCaught,            ///< an exception thrown by a material was caught and converted
+    };
+
+    Reason reason            = Success;
+    double suggestedDTFactor = 1.0; ///< suggested scaling of the time increment, < 1 for a cutback
+    int    element           = -1;  ///< index of the failing element within a block, if known
+    int    quadraturePoint   = -1;  ///< index of the failing quadrature point within the element, if known
+
+    /** @return Whether the computation succeeded. */
+    bool isSuccess() const { return reason == Success; }
+
+    /**
+     * @brief Create the status of a failed computation.
+     * @param[in] reason Reason of the failure.
+     * @param[in] suggestedDTFactor Suggested scaling of the time increment.
+     */
+    static Status cutback( Reason reason, double suggestedDTFactor )
+    {
+      return { reason, std::min( suggestedDTFactor, 1.0 ), -1, -1 };
+    }
+
+    /**
+     * @brief Create the status of a failed computation at a quadrature point.
+     * @param[in] materialStatus Status of the material, if it signalled the failure itself.
+     * @param[in] pNewDT Suggested scaling of the time increment, as returned by the material.
+     * @param[in] quadraturePoint Index of the quadrature point.
+     */
+    static Status atQuadraturePoint( const Status& materialStatus, double pNewDT, int quadraturePoint )
+    {
+      Status status = materialStatus.isSuccess() ? cutback( TimeStepReductionRequested, pNewDT ) : materialStatus;
+
+      status.suggestedDTFactor = std::min( status.suggestedDTFactor, pNewDT );
+      status.quadraturePoint   = quadraturePoint;
+      return status;
+    }
+
+    /**
+     * @brief Merge with the status of another computation, keeping the most restrictive one.
+     * @param[in] other Status to merge.
+     */
+    void merge( const Status& other )
+    {
+      if ( !other.isSuccess() && ( isSuccess() || other.suggestedDTFactor < suggestedDTFactor ) )
+        *this = other;
+    }
+
+    /** @return Name of a reason, e.g., for log messages. */
+    static const char* getReasonName( Reason reason )
+    {
+      switch ( reason ) {
+      case Success: return "success";
+      case TimeStepReductionRequested: return "time step reduction requested";
+      case InnerNewtonNotConverged: return "inner Newton not converged";
+      case NotConverged: return "not converged";
+      case ExceptionCaught: return "exception caught";
+      }
+      return "unknown";
+    }
+  };
+
+} // namespace Marmot
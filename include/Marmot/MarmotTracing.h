@@ -0,0 +1,204 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ * Magdalena Schreter magdalena.schreter@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+#pragma once
+#include "Marmot/MarmotConfig.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+/**
+ * @namespace Marmot::Tracing
+ * @brief Recording of timed spans, exported in the Chrome trace event format.
+ *
+ * Spans (e.g., element computeYourself, material computeStress, substeps, inner Newton loops) are recorded with the
+ * id of the recording thread into a preallocated ring buffer per thread, which keeps the most recent events. The
+ * recorded events can be written as Chrome trace JSON on demand, which can be inspected with chrome://tracing or
+ * ui.perfetto.dev.
+ *
+ * The buffer of a thread is returned to a free list when the thread exits. It is reused by a new thread once it holds
+ * no events of the current recording. Hence, the thread ids in the trace denote buffers rather than system threads.
+ *
+ * Tracing is enabled at compile time by defining MARMOT_ENABLE_TRACING (CMake option MARMOT_TRACING), and spans
+ * are recorded at run time between start() and stop(). Otherwise, ScopedSpan and SpanSequence compile to nothing.
+ *
+ * Names and categories of spans must be string literals without characters requiring escaping in JSON, as only the
+ * pointers are stored.
+ */
+namespace Marmot::Tracing {
+
+#ifdef MARMOT_ENABLE_TRACING
+  inline constexpr bool enabled = true;
+#else
+  inline constexpr bool enabled = false;
+#endif
+
+  /** @brief Flag for recording at run time, set by start() and reset by stop(). */
+  inline std::atomic< bool > recording = false;
+
+  /** @return Whether spans are currently recorded. */
+  inline bool isRecording()
+  {
+    return enabled && recording.load( std::memory_order_relaxed );
+  }
+
+  /** @return A monotonic timestamp in nanoseconds. */
+  inline long long now()
+  {
+    return std::chrono::duration_cast< std::chrono::nanoseconds >(
+             std::chrono::steady_clock::now().time_since_epoch() )
+      .count();
+  }
+
+  /**
+   * @brief Start recording; all previously recorded events are discarded.
+   * @param[in] eventsPerThread Capacity of the ring buffer of each thread.
+   */
+  void start( size_t eventsPerThread = 1 << 16 );
+
+  /** @brief Stop recording; open span sequences are ended, and the recorded events are kept for writing. */
+  void stop();
+
+  /**
+   * @brief Allocate the buffer of the calling thread, including its events if currently recording.
+   * @details Otherwise, the buffer is allocated on the first recorded span. Threads of a pool should register on
+   * startup to keep the allocation out of the traced computation.
+   */
+  void registerThread();
+
+  /**
+   * @brief Record a span into the ring buffer of the calling thread, regardless of the compile-time switch.
+   * @param[in] name Name of the span.
+   * @param[in] category Category of the span.
+   * @param[in] begin Timestamp of the begin, see now().
+   * @param[in] end Timestamp of the end, see now().
+   * @param[in] argument Optional integer argument (e.g., a material or element code), written if not negative.
+   */
+  void record( const char* name, const char* category, long long begin, long long end, long int argument = -1 );
+
+  /**
+   * @brief Write the recorded events of all threads in the Chrome trace event format.
+   */
+  void writeChromeTrace( std::ostream& output );
+
+  /**
+   * @brief Write the recorded events of all threads in the Chrome trace event format to a file.
+   */
+  void writeChromeTrace( const std::string& fileName );
+
+  /**
+   * @class ScopedSpan
+   * @brief Records a span from its construction until end() is called or it is destructed.
+   */
+  class ScopedSpan {
+  public:
+    ScopedSpan( const char* name, const char* category, long int argument = -1 )
+      : name( name ), category( category ), argument( argument ), begin( isRecording() ? now() : -1 )
+    {
+    }
+
+    ScopedSpan( const ScopedSpan& )            = delete;
+    ScopedSpan& operator=( const ScopedSpan& ) = delete;
+
+    ~ScopedSpan() { end(); }
+
+    /** @brief End the span before the end of the scope. */
+    void end()
+    {
+      if constexpr ( enabled ) {
+        if ( begin >= 0 ) {
+          record( name, category, begin, now(), argument );
+          begin = -1;
+        }
+      }
+    }
+
+  private:
+    const char* const name;
+    const char* const category;
+    const long int    argument;
+    long long         begin;
+  };
+
+  struct ThreadBuffer;
+
+  /**
+   * @class SpanSequence
+   * @brief Records a sequence of adjacent spans, e.g., for substeps. Each span lasts until the next one is begun,
+   * until close() is called, until the sequence is destructed, or until stop() is called.
+   *
+   * A sequence must be used by a single thread, as its open span is linked to the buffer of that thread.
+   */
+  class SpanSequence {
+  public:
+    SpanSequence() = default;
+    SpanSequence( const SpanSequence& ) : SpanSequence() {}
+    SpanSequence& operator=( const SpanSequence& ) { return *this; }
+
+    ~SpanSequence() { close(); }
+
+    /** @brief End the current span and begin the next one. */
+    void next( const char* name_, const char* category_, long int argument_ = -1 )
+    {
+      if constexpr ( enabled ) {
+        close();
+        if ( isRecording() )
+          open( name_, category_, argument_ );
+      }
+    }
+
+    /** @brief End the current span. */
+    void close()
+    {
+      if constexpr ( enabled ) {
+        if ( buffer )
+          closeOpenSpan();
+      }
+    }
+
+  private:
+    friend struct ThreadBuffer;
+
+    void open( const char* name_, const char* category_, long int argument_ );
+
+    void closeOpenSpan();
+
+    /* buffer of the owning thread, in whose list of open sequences the sequence is linked */
+    ThreadBuffer* buffer = nullptr;
+
+    /* guarded by the mutex of the buffer, as stop() ends the open span from another thread */
+    SpanSequence* previousOpen = nullptr;
+    SpanSequence* nextOpen     = nullptr;
+    const char*   name         = nullptr;
+    const char*   category     = nullptr;
+    long int      argument     = -1;
+    long long     begin        = -1;
+  };
+
+} // namespace Marmot::Tracing
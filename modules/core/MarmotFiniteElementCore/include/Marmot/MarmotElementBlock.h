@@ -0,0 +1,43 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ * Magdalena Schreter magdalena.schreter@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+#pragma once
+
+namespace Marmot::Elements {
+
+  /**
+   * @class Marmot::Elements::ElementBlock
+   * @tparam ElementType Element type of all elements in the block.
+   * @brief Container for many elements of the same type, which stores the geometry and the quadrature point data of
+   * all elements in contiguous arrays (structure of arrays) and computes all elements in a single call.
+   * @details Element modules provide specializations for their element types, e.g.,
+   * ElementBlock< DisplacementFiniteElement< nDim, nNodes > >.
+   */
+  template < typename ElementType >
+  class ElementBlock;
+
+} // namespace Marmot::Elements
@@ -40,6 +40,136 @@ namespace Marmot {
       SimoRifaiEAS4,
     };
 
+    /** @brief Spatial dimension and number of enhanced parameters of the fixed-size interpolations. */
+    template < EASType type >
+    struct EASTraits;
+
+    // clang-format off
+    template <> struct EASTraits< DeBorstEAS2 >   { static constexpr int nDim = 2, nParameters = 2; };
+    template <> struct EASTraits< SimoRifaiEAS4 > { static constexpr int nDim = 2, nParameters = 4; };
+    template <> struct EASTraits< SimoRifaiEAS5 > { static constexpr int nDim = 2, nParameters = 5; };
+    template <> struct EASTraits< EAS3 >          { static constexpr int nDim = 3, nParameters = 3; };
+    template <> struct EASTraits< DeBorstEAS6b >  { static constexpr int nDim = 3, nParameters = 6; };
+    template <> struct EASTraits< DeBorstEAS9 >   { static constexpr int nDim = 3, nParameters = 9; };
+    // clang-format on
+
+    /** @brief Size of the strain vector in Voigt notation for nDim = 2 (3) and nDim = 3 (6). */
+    template < int nDim >
+    constexpr int nVoigt = nDim == 2 ? 3 : 6;
+
+    /**
+     * @brief Transformation of the enhanced strains from the parent to the physical space, from the Jacobian J.
+     */
+    template < int nDim >
+    Eigen::Matrix< double, nVoigt< nDim >, nVoigt< nDim > > F( const Eigen::Matrix< double, nDim, nDim >& J )
+    {
+      // Transformation according to
+      // - Andelfinger, Ramm (1993),
+      // - 'Notes on Continuum Mechanics -  Eduardo WV Chaves' !
+      // - Lecture Notes S.Kinkel
+      // - Quy,Matzenmiller 2007
+      //
+      // Attention: Incosistent with Simo Rifai ( topleft block!)
+      // and FEAP Theory Manual!
+      Eigen::Matrix< double, nVoigt< nDim >, nVoigt< nDim > > F;
+
+      if constexpr ( nDim == 2 ) {
+        // clang-format off
+        F <<    J(0,0)*J(0,0),    J(0,1)*J(0,1),        2*J(0,0)*J(0,1),
+                J(1,0)*J(1,0),    J(1,1)*J(1,1),        2*J(1,0)*J(1,1),
+                J(0,0)*J(1,0),    J(0,1)*J(1,1),        J(0,0)*J(1,1)+J(0,1)*J(1,0);
+        // clang-format on
+      }
+      else {
+        // clang-format off
+        F.topLeftCorner(3,3) <<
+            J(0,0)*J(0,0),  J(0,1)*J(0,1),  J(0,2)*J(0,2),
+            J(1,0)*J(1,0),  J(1,1)*J(1,1),  J(1,2)*J(1,2),
+            J(2,0)*J(2,0),  J(2,1)*J(2,1),  J(2,2)*J(2,2);
+
+        F.topRightCorner(3,3) <<
+            2*J(0,0)*J(0,1),  2*J(0,0)*J(0,2),  2*J(0,1)*J(0,2),
+            2*J(1,0)*J(1,1),  2*J(1,0)*J(1,2),  2*J(1,1)*J(1,2),
+            2*J(2,0)*J(2,1),  2*J(2,0)*J(2,2),  2*J(2,1)*J(2,2);
+
+        F.bottomLeftCorner(3,3) <<
+            J(0,0)*J(1,0),  J(0,1)*J(1,1),  J(0,2)*J(1,2),
+            J(0,0)*J(2,0),  J(0,1)*J(2,1),  J(0,2)*J(2,2),
+            J(1,0)*J(2,0),  J(1,1)*J(2,1),  J(1,2)*J(2,2);
+
+        F.bottomRightCorner(3,3) <<
+            J(0,0)*J(1,1)+J(0,1)*J(1,0),  J(0,0)*J(1,2)+J(0,2)*J(1,0),  J(0,1)*J(1,2)+J(0,2)*J(1,1),
+            J(0,0)*J(2,1)+J(0,1)*J(2,0),  J(0,0)*J(2,2)+J(0,2)*J(2,0),  J(0,1)*J(2,2)+J(0,2)*J(2,1),
+            J(1,0)*J(2,1)+J(1,1)*J(2,0),  J(1,0)*J(2,2)+J(1,2)*J(2,0),  J(1,1)*J(2,2)+J(1,2)*J(2,1);
+        // clang-format on
+      }
+
+      return F;
+    }
+
+    /**
+     * @brief Interpolation of the enhanced strains in the parent space at the parent coordinates xi.
+     */
+    template < EASType type >
+    Eigen::Matrix< double, nVoigt< EASTraits< type >::nDim >, EASTraits< type >::nParameters > EASInterpolation(
+      const Eigen::Matrix< double, EASTraits< type >::nDim, 1 >& xi )
+    {
+      Eigen::Matrix< double, nVoigt< EASTraits< type >::nDim >, EASTraits< type >::nParameters > E_;
+      E_.setZero();
+
+      if constexpr ( type == DeBorstEAS2 ) {
+        // clang-format off
+        E_ <<   xi[1],      0,
+                0,          xi[0],
+                0,          0;
+        // clang-format on
+      }
+      else if constexpr ( type == EAS3 ) {
+        // Not sufficient to avoid volumetric locking, as proven in (de Borst, Groen 1999)
+        E_.topLeftCorner( 3, 3 ).diagonal() << xi[0], xi[1], xi[2];
+      }
+      else if constexpr ( type == DeBorstEAS9 ) {
+        E_.topLeftCorner( 3, 3 ).diagonal() << xi[0], xi[1], xi[2];
+
+        E_( 0, 3 ) = xi[0] * xi[1];
+        E_( 0, 4 ) = xi[0] * xi[2];
+
+        E_( 1, 5 ) = xi[1] * xi[0];
+        E_( 1, 6 ) = xi[1] * xi[2];
+
+        E_( 2, 7 ) = xi[2] * xi[0];
+        E_( 2, 8 ) = xi[2] * xi[1];
+      }
+      else if constexpr ( type == DeBorstEAS6b ) {
+        E_.topLeftCorner( 3, 3 ).diagonal() << xi[0], xi[1], xi[2];
+
+        E_( 0, 3 ) = xi[1] * xi[0];
+        E_( 0, 4 ) = xi[2] * xi[0];
+
+        E_( 1, 3 ) = xi[0] * xi[1];
+        E_( 1, 5 ) = xi[2] * xi[1];
+
+        E_( 2, 4 ) = xi[0] * xi[2];
+        E_( 2, 5 ) = xi[1] * xi[2];
+      }
+      else if constexpr ( type == SimoRifaiEAS5 ) {
+        // clang-format off
+        E_ <<   xi[0],      0,      0,      0,      xi[0]*xi[1],
+                0,          xi[1],  0,      0,      -xi[0]*xi[1],
+                0,          0,      xi[0],  xi[1],  xi[0]*xi[0]-xi[1]*xi[1];
+        // clang-format on
+      }
+      else if constexpr ( type == SimoRifaiEAS4 ) {
+        // clang-format off
+        E_ <<   xi[0],      0,      0,      0,
+                0,          xi[1],  0,      0,
+                0,          0,      xi[0],  xi[1];
+        // clang-format on
+      }
+
+      return E_;
+    }
+
     Eigen::MatrixXd F( const Eigen::MatrixXd& J );
 
     Eigen::MatrixXd EASInterpolation( EASType type, const Eigen::VectorXd& xi );
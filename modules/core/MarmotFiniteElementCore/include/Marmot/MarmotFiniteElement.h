@@ -226,6 +226,73 @@ namespace Marmot {
         return B_;
       }
 
+      /*
+       * Structured kernels for the products with the B-operator, which only use the shape function derivatives dNdX
+       * (optionally stored in single precision) without forming B. For each node a, B_a is the 6x3 block shown above.
+       */
+
+      /** @brief Strain increment \f$\boldsymbol{B}\, \boldsymbol{q}\f$. */
+      template < int nNodes, typename T >
+      Eigen::Matrix< double, voigtSize, 1 > BTimes(
+        const Eigen::Matrix< T, nDim, nNodes >&                              dNdX,
+        const Eigen::Ref< const Eigen::Matrix< double, nNodes * nDim, 1 > >& q )
+      {
+        Eigen::Matrix< double, voigtSize, 1 > e = Eigen::Matrix< double, voigtSize, 1 >::Zero();
+
+        for ( int a = 0; a < nNodes; a++ ) {
+          const double g0 = dNdX( 0, a ), g1 = dNdX( 1, a ), g2 = dNdX( 2, a );
+          const double u0 = q( nDim * a ), u1 = q( nDim * a + 1 ), u2 = q( nDim * a + 2 );
+          e( 0 ) += g0 * u0;
+          e( 1 ) += g1 * u1;
+          e( 2 ) += g2 * u2;
+          e( 3 ) += g1 * u0 + g0 * u1;
+          e( 4 ) += g2 * u0 + g0 * u2;
+          e( 5 ) += g2 * u1 + g1 * u2;
+        }
+
+        return e;
+      }
+
+      /** @brief Add \f$ f\, \boldsymbol{B}^T \boldsymbol{S}\f$ to a vector. */
+      template < int nNodes, typename T >
+      void addBTransposeTimes( Eigen::Ref< Eigen::Matrix< double, nNodes * nDim, 1 > > P,
+                               const Eigen::Matrix< T, nDim, nNodes >&                 dNdX,
+                               const Eigen::Matrix< double, voigtSize, 1 >&            S,
+                               double                                                  f )
+      {
+        for ( int a = 0; a < nNodes; a++ ) {
+          const double g0 = dNdX( 0, a ), g1 = dNdX( 1, a ), g2 = dNdX( 2, a );
+          P( nDim * a ) += f * ( g0 * S( 0 ) + g1 * S( 3 ) + g2 * S( 4 ) );
+          P( nDim * a + 1 ) += f * ( g1 * S( 1 ) + g0 * S( 3 ) + g2 * S( 5 ) );
+          P( nDim * a + 2 ) += f * ( g2 * S( 2 ) + g0 * S( 4 ) + g1 * S( 5 ) );
+        }
+      }
+
+      /** @brief Add \f$ f\, \boldsymbol{B}^T \boldsymbol{C}\, \boldsymbol{B}\f$ to a matrix. */
+      template < int nNodes, typename T >
+      void addBTransposeCB( Eigen::Ref< Eigen::Matrix< double, nNodes * nDim, nNodes * nDim > > K,
+                            const Eigen::Matrix< T, nDim, nNodes >&                             dNdX,
+                            const Eigen::Matrix< double, voigtSize, voigtSize >&                C,
+                            double                                                              f )
+      {
+        // C B_b, scaled by f
+        Eigen::Matrix< double, voigtSize, nNodes * nDim > CB;
+        for ( int b = 0; b < nNodes; b++ ) {
+          const double g0 = f * dNdX( 0, b ), g1 = f * dNdX( 1, b ), g2 = f * dNdX( 2, b );
+          CB.col( nDim * b )     = C.col( 0 ) * g0 + C.col( 3 ) * g1 + C.col( 4 ) * g2;
+          CB.col( nDim * b + 1 ) = C.col( 1 ) * g1 + C.col( 3 ) * g0 + C.col( 5 ) * g2;
+          CB.col( nDim * b + 2 ) = C.col( 2 ) * g2 + C.col( 4 ) * g0 + C.col( 5 ) * g1;
+        }
+
+        // B_a^T (C B)
+        for ( int a = 0; a < nNodes; a++ ) {
+          const double g0 = dNdX( 0, a ), g1 = dNdX( 1, a ), g2 = dNdX( 2, a );
+          K.row( nDim * a ) += g0 * CB.row( 0 ) + g1 * CB.row( 3 ) + g2 * CB.row( 4 );
+          K.row( nDim * a + 1 ) += g1 * CB.row( 1 ) + g0 * CB.row( 3 ) + g2 * CB.row( 5 );
+          K.row( nDim * a + 2 ) += g2 * CB.row( 2 ) + g0 * CB.row( 4 ) + g1 * CB.row( 5 );
+        }
+      }
+
       template < int nNodes >
       Eigen::Matrix< double, voigtSize, nNodes * nDim > B_bar( const Eigen::Matrix< double, nDim, nNodes >& dNdX,
                                                                const Eigen::Matrix< double, nDim, nNodes >& dNdX0 )
@@ -439,7 +506,18 @@ namespace Marmot {
     constexpr double gp2 = 0.577350269189625764509;
     constexpr double gp3 = 0.774596669241483;
 
-    enum IntegrationTypes { FullIntegration, ReducedIntegration };
+    /* parent coordinates of the 14 point rule of Irons for hexahedra, sqrt( 19 / 30 ) and sqrt( 19 / 33 ) */
+    constexpr double irons14A = 0.795822425754221463264548820476135846;
+    constexpr double irons14B = 0.758786910639328146269034278112267428;
+
+    /**
+     * Integration types:
+     * - FullIntegration, ReducedIntegration: Gauss rules (and the 1 and 4 point rules for tetra4 and tetra10)
+     * - IronsIntegration: 14 point rule of Irons for hexahedra, exact for polynomials of degree 5 as the 3x3x3 rule
+     * - NodalIntegration: quadrature points at the nodes of linear elements (and Simpson's rule for bar3), in the
+     *   order of the nodes, which results in diagonal mass matrices
+     */
+    enum IntegrationTypes { FullIntegration, ReducedIntegration, IronsIntegration, NodalIntegration };
 
     struct QuadraturePointInfo {
       Eigen::VectorXd xi;
@@ -469,6 +547,17 @@ namespace Marmot {
                 { ( Eigen::VectorXd ( 1 ) << 0.   ).finished(),            8./9 },
                 { ( Eigen::VectorXd ( 1 ) << +gp3 ).finished(),            5./9 }
             };
+
+            const std::vector< QuadraturePointInfo >  gaussPointListNodalBar2 = {
+                { ( Eigen::VectorXd ( 1 ) << -1. ).finished(),            1.0 },
+                { ( Eigen::VectorXd ( 1 ) << +1. ).finished(),            1.0 }
+            };
+
+            const std::vector< QuadraturePointInfo >  gaussPointListNodalBar3 = {
+                { ( Eigen::VectorXd ( 1 ) << -1. ).finished(),            1./3 },
+                { ( Eigen::VectorXd ( 1 ) << +1. ).finished(),            1./3 },
+                { ( Eigen::VectorXd ( 1 ) << 0.  ).finished(),            4./3 }
+            };
       // clang-format on
 
     } // namespace Spatial1D
@@ -499,6 +588,13 @@ namespace Marmot {
                 { ( Eigen::Vector2d () << 0,        +gp3 ).finished(),   40./81},
                 { ( Eigen::Vector2d () << -gp3,     0.   ).finished(),   40./81},
             };
+
+            const std::vector< QuadraturePointInfo > gaussPointListNodalQuad4 = {
+                { ( Eigen::Vector2d () << -1.,      -1.  ).finished(),   1.0 },
+                { ( Eigen::Vector2d () << +1.,      -1.  ).finished(),   1.0 },
+                { ( Eigen::Vector2d () << +1.,      +1.  ).finished(),   1.0 },
+                { ( Eigen::Vector2d () << -1.,      +1.  ).finished(),   1.0 }
+            };
       // clang-format on
 
       void modifyCharElemLengthAbaqusLike( double& charElemLength, int intPoint );
@@ -565,6 +661,42 @@ namespace Marmot {
                 { ( Eigen::Vector3d () << 0,        +gp3,   +gp3 ).finished(),       0.274348422496571},
                 { ( Eigen::Vector3d () << +gp3,     +gp3,   +gp3 ).finished(),       0.171467764060357}
             };
+
+            const inline std::vector< QuadraturePointInfo > gaussPointListIrons14 = {
+                { ( Eigen::Vector3d () << -irons14A,    0,          0 ).finished(),             320./361},
+                { ( Eigen::Vector3d () << +irons14A,    0,          0 ).finished(),             320./361},
+                { ( Eigen::Vector3d () << 0,            -irons14A,  0 ).finished(),             320./361},
+                { ( Eigen::Vector3d () << 0,            +irons14A,  0 ).finished(),             320./361},
+                { ( Eigen::Vector3d () << 0,            0,          -irons14A ).finished(),     320./361},
+                { ( Eigen::Vector3d () << 0,            0,          +irons14A ).finished(),     320./361},
+
+                { ( Eigen::Vector3d () << -irons14B,    -irons14B,  -irons14B ).finished(),     121./361},
+                { ( Eigen::Vector3d () << +irons14B,    -irons14B,  -irons14B ).finished(),     121./361},
+                { ( Eigen::Vector3d () << +irons14B,    +irons14B,  -irons14B ).finished(),     121./361},
+                { ( Eigen::Vector3d () << -irons14B,    +irons14B,  -irons14B ).finished(),     121./361},
+                { ( Eigen::Vector3d () << -irons14B,    -irons14B,  +irons14B ).finished(),     121./361},
+                { ( Eigen::Vector3d () << +irons14B,    -irons14B,  +irons14B ).finished(),     121./361},
+                { ( Eigen::Vector3d () << +irons14B,    +irons14B,  +irons14B ).finished(),     121./361},
+                { ( Eigen::Vector3d () << -irons14B,    +irons14B,  +irons14B ).finished(),     121./361}
+            };
+
+            const inline std::vector< QuadraturePointInfo > gaussPointListNodalTetra4 = {
+                { ( Eigen::Vector3d () << 0,    0,      0 ).finished(),     1./24},
+                { ( Eigen::Vector3d () << 1,    0,      0 ).finished(),     1./24},
+                { ( Eigen::Vector3d () << 0,    1,      0 ).finished(),     1./24},
+                { ( Eigen::Vector3d () << 0,    0,      1 ).finished(),     1./24}
+            };
+
+            const inline std::vector< QuadraturePointInfo > gaussPointListNodalHexa8 = {
+                { ( Eigen::Vector3d () << -1,   -1,     -1 ).finished(),    1.0},
+                { ( Eigen::Vector3d () << +1,   -1,     -1 ).finished(),    1.0},
+                { ( Eigen::Vector3d () << +1,   +1,     -1 ).finished(),    1.0},
+                { ( Eigen::Vector3d () << -1,   +1,     -1 ).finished(),    1.0},
+                { ( Eigen::Vector3d () << -1,   -1,     +1 ).finished(),    1.0},
+                { ( Eigen::Vector3d () << +1,   -1,     +1 ).finished(),    1.0},
+                { ( Eigen::Vector3d () << +1,   +1,     +1 ).finished(),    1.0},
+                { ( Eigen::Vector3d () << -1,   +1,     +1 ).finished(),    1.0}
+            };
       // clang-format on
 
     } // namespace Spatial3D
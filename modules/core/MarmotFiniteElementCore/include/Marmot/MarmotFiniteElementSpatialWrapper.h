@@ -51,6 +51,10 @@ public:
   Eigen::MatrixXd                  P;
   Eigen::MatrixXd                  projectedCoordinates;
 
+  // workspace for computeYourself, allocated once
+  Eigen::VectorXd QProjected, dQProjected, PeProjected;
+  Eigen::MatrixXd KeProjected, KeProjectedTimesP;
+
   MarmotElementSpatialWrapper( int                              nDim,
                                int                              nChildDim,
                                int                              nNodes,
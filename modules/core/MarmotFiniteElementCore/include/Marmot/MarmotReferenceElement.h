@@ -0,0 +1,574 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ * Magdalena Schreter magdalena.schreter@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+#pragma once
+#include "Marmot/MarmotFiniteElement.h"
+#include <array>
+#include <stdexcept>
+
+/**
+ * @namespace Marmot::FiniteElement::ReferenceElement
+ * @brief Compile-time tables of quadrature points, weights, shape functions N and their derivatives dNdXi.
+ *
+ * For each combination of element shape and integration type supported by Quadrature::getGaussPointInfo (see
+ * hasQuadratureRule), Table provides the quadrature rule in the same order, and the shape functions and their
+ * derivatives evaluated at the quadrature points. The tables are evaluated by the compiler and shared by all elements,
+ * which access them through a TableView and fixed size Eigen::Maps. dNdXi is stored column major (nDim x nNodes) per
+ * quadrature point.
+ */
+namespace Marmot::FiniteElement::ReferenceElement {
+
+  using Quadrature::IntegrationTypes;
+
+  /** @brief Element shape by the number of dimensions and nodes, cf. getElementShapeByMetric. */
+  constexpr ElementShapes getShape( int nDim, int nNodes )
+  {
+    if ( nDim == 1 && nNodes == 2 )
+      return Bar2;
+    if ( nDim == 1 && nNodes == 3 )
+      return Bar3;
+    if ( nDim == 2 && nNodes == 4 )
+      return Quad4;
+    if ( nDim == 2 && nNodes == 8 )
+      return Quad8;
+    if ( nDim == 3 && nNodes == 4 )
+      return Tetra4;
+    if ( nDim == 3 && nNodes == 10 )
+      return Tetra10;
+    if ( nDim == 3 && nNodes == 8 )
+      return Hexa8;
+    if ( nDim == 3 && nNodes == 20 )
+      return Hexa20;
+
+    throw std::invalid_argument( "no reference element table for this element shape" );
+  }
+
+  template < int nDim >
+  struct QuadraturePoint {
+    std::array< double, nDim > xi;
+    double                     weight;
+  };
+
+  /*
+   * Shapes
+   *
+   * Elements of the Bar, Quad and Hexa families are described by the parent coordinates of their nodes; linear
+   * elements use products of linear Lagrange polynomials, quadratic elements (Bar3, Quad8, Hexa20) serendipity
+   * functions. Tetrahedra are described by the area coordinates L = ( 1 - xi0 - xi1 - xi2, xi0, xi1, xi2 ) associated
+   * with their nodes; nodes at edges are described by the two area coordinates of the edge.
+   */
+
+  template < ElementShapes shape >
+  struct Shape;
+
+  // clang-format off
+  template <> struct Shape< Bar2 > {
+    static constexpr int  nDim = 1, nNodes = 2, order = 1;
+    static constexpr bool isSimplex = false;
+    static constexpr std::array< std::array< double, nDim >, nNodes > nodes = { { { -1 }, { 1 } } };
+  };
+
+  template <> struct Shape< Bar3 > {
+    static constexpr int  nDim = 1, nNodes = 3, order = 2;
+    static constexpr bool isSimplex = false;
+    static constexpr std::array< std::array< double, nDim >, nNodes > nodes = { { { -1 }, { 1 }, { 0 } } };
+  };
+
+  template <> struct Shape< Quad4 > {
+    static constexpr int  nDim = 2, nNodes = 4, order = 1;
+    static constexpr bool isSimplex = false;
+    static constexpr std::array< std::array< double, nDim >, nNodes > nodes = { { { -1, -1 }, { 1, -1 }, { 1, 1 },
+                                                                                  { -1, 1 } } };
+  };
+
+  template <> struct Shape< Quad8 > {
+    static constexpr int  nDim = 2, nNodes = 8, order = 2;
+    static constexpr bool isSimplex = false;
+    static constexpr std::array< std::array< double, nDim >, nNodes > nodes = { { { -1, -1 }, { 1, -1 }, { 1, 1 },
+                                                                                  { -1, 1 }, { 0, -1 }, { 1, 0 },
+                                                                                  { 0, 1 }, { -1, 0 } } };
+  };
+
+  template <> struct Shape< Hexa8 > {
+    static constexpr int  nDim = 3, nNodes = 8, order = 1;
+    static constexpr bool isSimplex = false;
+    static constexpr std::array< std::array< double, nDim >, nNodes > nodes = { { { -1, -1, -1 }, { 1, -1, -1 },
+                                                                                  { 1, 1, -1 }, { -1, 1, -1 },
+                                                                                  { -1, -1, 1 }, { 1, -1, 1 },
+                                                                                  { 1, 1, 1 }, { -1, 1, 1 } } };
+  };
+
+  template <> struct Shape< Hexa20 > {
+    static constexpr int  nDim = 3, nNodes = 20, order = 2;
+    static constexpr bool isSimplex = false;
+    static constexpr std::array< std::array< double, nDim >, nNodes > nodes = { { { -1, -1, -1 }, { 1, -1, -1 },
+                                                                                  { 1, 1, -1 }, { -1, 1, -1 },
+                                                                                  { -1, -1, 1 }, { 1, -1, 1 },
+                                                                                  { 1, 1, 1 }, { -1, 1, 1 },
+                                                                                  { 0, -1, -1 }, { 1, 0, -1 },
+                                                                                  { 0, 1, -1 }, { -1, 0, -1 },
+                                                                                  { 0, -1, 1 }, { 1, 0, 1 },
+                                                                                  { 0, 1, 1 }, { -1, 0, 1 },
+                                                                                  { -1, -1, 0 }, { 1, -1, 0 },
+                                                                                  { 1, 1, 0 }, { -1, 1, 0 } } };
+  };
+
+  template <> struct Shape< Tetra4 > {
+    static constexpr int  nDim = 3, nNodes = 4, order = 1;
+    static constexpr bool isSimplex = true;
+    static constexpr std::array< std::array< int, 2 >, nNodes > nodes = { { { 0, 0 }, { 1, 1 }, { 2, 2 }, { 3, 3 } } };
+  };
+
+  template <> struct Shape< Tetra10 > {
+    static constexpr int  nDim = 3, nNodes = 10, order = 2;
+    static constexpr bool isSimplex = true;
+    static constexpr std::array< std::array< int, 2 >, nNodes > nodes = { { { 2, 2 }, { 3, 3 }, { 0, 0 }, { 1, 1 },
+                                                                            { 2, 3 }, { 3, 0 }, { 2, 0 }, { 1, 2 },
+                                                                            { 1, 3 }, { 1, 0 } } };
+  };
+  // clang-format on
+
+  /**
+   * @brief Evaluate the shape functions and their derivatives at a point.
+   * @param xi Parent coordinates.
+   * @param N Shape functions (nNodes).
+   * @param dNdXi Derivatives, column major (nDim x nNodes).
+   */
+  template < ElementShapes shape >
+  constexpr void evaluate( const std::array< double, Shape< shape >::nDim >&                       xi,
+                           std::array< double, Shape< shape >::nNodes >&                           N,
+                           std::array< double, Shape< shape >::nDim * Shape< shape >::nNodes >& dNdXi )
+  {
+    using S            = Shape< shape >;
+    constexpr int nDim = S::nDim;
+
+    if constexpr ( S::isSimplex ) {
+      const std::array< double, 4 > L = { 1 - xi[0] - xi[1] - xi[2], xi[0], xi[1], xi[2] };
+
+      // dL_k / dxi_j
+      auto dL = []( int k, int j ) { return k == 0 ? -1.0 : ( k - 1 == j ? 1.0 : 0.0 ); };
+
+      for ( int a = 0; a < S::nNodes; a++ ) {
+        const int i = S::nodes[a][0], k = S::nodes[a][1];
+        if ( i == k && S::order == 1 ) {
+          N[a] = L[i];
+          for ( int j = 0; j < nDim; j++ )
+            dNdXi[a * nDim + j] = dL( i, j );
+        }
+        else if ( i == k ) {
+          N[a] = L[i] * ( 2 * L[i] - 1 );
+          for ( int j = 0; j < nDim; j++ )
+            dNdXi[a * nDim + j] = ( 4 * L[i] - 1 ) * dL( i, j );
+        }
+        else {
+          N[a] = 4 * L[i] * L[k];
+          for ( int j = 0; j < nDim; j++ )
+            dNdXi[a * nDim + j] = 4 * ( dL( i, j ) * L[k] + L[i] * dL( k, j ) );
+        }
+      }
+    }
+
+    else {
+      for ( int a = 0; a < S::nNodes; a++ ) {
+        const auto& X = S::nodes[a];
+
+        // linear factors ( 1 + xi_i X_i ) / 2, and the direction of a node at the middle of an edge
+        std::array< double, nDim > f{};
+        int                        m = -1;
+        for ( int i = 0; i < nDim; i++ ) {
+          f[i] = ( 1 + xi[i] * X[i] ) / 2;
+          if ( X[i] == 0 )
+            m = i;
+        }
+
+        // product of the linear factors, excluding up to two directions
+        auto product = [&]( int excluded0, int excluded1 ) {
+          double p = 1.0;
+          for ( int i = 0; i < nDim; i++ )
+            if ( i != excluded0 && i != excluded1 )
+              p *= f[i];
+          return p;
+        };
+
+        if ( S::order == 1 ) {
+          N[a] = product( -1, -1 );
+          for ( int j = 0; j < nDim; j++ )
+            dNdXi[a * nDim + j] = X[j] / 2 * product( j, -1 );
+        }
+        else if ( m < 0 ) {
+          // corner node of a serendipity element
+          double sum = -( nDim - 1 );
+          for ( int i = 0; i < nDim; i++ )
+            sum += xi[i] * X[i];
+
+          N[a] = product( -1, -1 ) * sum;
+          for ( int j = 0; j < nDim; j++ )
+            dNdXi[a * nDim + j] = X[j] / 2 * product( j, -1 ) * sum + product( -1, -1 ) * X[j];
+        }
+        else {
+          // node at the middle of an edge in direction m
+          N[a] = ( 1 - xi[m] * xi[m] ) * product( m, -1 );
+          for ( int j = 0; j < nDim; j++ )
+            dNdXi[a * nDim + j] = j == m ? -2 * xi[m] * product( m, -1 )
+                                         : ( 1 - xi[m] * xi[m] ) * X[j] / 2 * product( m, j );
+        }
+      }
+    }
+  }
+
+  /** @brief Parent coordinates of the nodes, column major (nDim x nNodes). */
+  template < ElementShapes shape >
+  constexpr std::array< double, Shape< shape >::nDim * Shape< shape >::nNodes > getNodeCoordinates()
+  {
+    using S = Shape< shape >;
+
+    std::array< double, S::nDim * S::nNodes > X{};
+    for ( int a = 0; a < S::nNodes; a++ )
+      for ( int j = 0; j < S::nDim; j++ ) {
+        if constexpr ( S::isSimplex ) {
+          // average of the (one or two) vertices; vertex k > 0 is located at xi_{k-1} = 1
+          const int i = S::nodes[a][0], k = S::nodes[a][1];
+          X[a * S::nDim + j] = ( ( i == j + 1 ) + ( k == j + 1 ) ) / 2.0;
+        }
+        else
+          X[a * S::nDim + j] = S::nodes[a][j];
+      }
+
+    return X;
+  }
+
+  /*
+   * Quadrature rules, in the order of Quadrature::getGaussPointInfo
+   */
+
+  namespace Rules {
+    using Quadrature::gp2;
+    using Quadrature::gp3;
+
+    /* parent coordinates of the 4 point rule for tetrahedra, ( 5 - sqrt( 5 ) ) / 20 and ( 5 + 3 sqrt( 5 ) ) / 20 */
+    constexpr double tetA = 0.138196601125010515179541316563436;
+    constexpr double tetB = 0.585410196624968454461376050309693;
+
+    // clang-format off
+    constexpr std::array< QuadraturePoint< 1 >, 1 > gauss1 = { { { { 0 }, 2. } } };
+    constexpr std::array< QuadraturePoint< 1 >, 2 > gauss2 = { { { { -gp2 }, 1. }, { { +gp2 }, 1. } } };
+    constexpr std::array< QuadraturePoint< 1 >, 3 > gauss3 = { { { { -gp3 }, 5. / 9 }, { { 0 }, 8. / 9 },
+                                                                 { { +gp3 }, 5. / 9 } } };
+
+    constexpr std::array< QuadraturePoint< 2 >, 1 > gauss1x1 = { { { { 0, 0 }, 4. } } };
+    constexpr std::array< QuadraturePoint< 2 >, 4 > gauss2x2 = { { { { +gp2, +gp2 }, 1. }, { { -gp2, +gp2 }, 1. },
+                                                                   { { -gp2, -gp2 }, 1. }, { { +gp2, -gp2 }, 1. } } };
+    constexpr std::array< QuadraturePoint< 2 >, 9 > gauss3x3 = { { { { 0, 0 }, 64. / 81 },
+                                                                   { { -gp3, -gp3 }, 25. / 81 },
+                                                                   { { +gp3, -gp3 }, 25. / 81 },
+                                                                   { { +gp3, +gp3 }, 25. / 81 },
+                                                                   { { -gp3, +gp3 }, 25. / 81 },
+                                                                   { { 0, -gp3 }, 40. / 81 },
+                                                                   { { +gp3, 0 }, 40. / 81 },
+                                                                   { { 0, +gp3 }, 40. / 81 },
+                                                                   { { -gp3, 0 }, 40. / 81 } } };
+
+    constexpr std::array< QuadraturePoint< 3 >, 1 > gauss1x1x1 = { { { { 0, 0, 0 }, 8. } } };
+    constexpr std::array< QuadraturePoint< 3 >, 1 > tetra1     = { { { { 1. / 4, 1. / 4, 1. / 4 }, 1. / 6 } } };
+    constexpr std::array< QuadraturePoint< 3 >, 4 > tetra4     = { { { { tetA, tetA, tetA }, 1. / 24 },
+                                                                     { { tetA, tetA, tetB }, 1. / 24 },
+                                                                     { { tetA, tetB, tetA }, 1. / 24 },
+                                                                     { { tetB, tetA, tetA }, 1. / 24 } } };
+    // clang-format on
+
+    constexpr std::array< QuadraturePoint< 3 >, 8 > gauss2x2x2 = [] {
+      constexpr std::array< std::array< double, 2 >, 4 > plane = { { { -gp2, -gp2 },
+                                                                     { +gp2, -gp2 },
+                                                                     { +gp2, +gp2 },
+                                                                     { -gp2, +gp2 } } };
+      std::array< QuadraturePoint< 3 >, 8 > rule{};
+      for ( int k = 0; k < 2; k++ )
+        for ( int q = 0; q < 4; q++ )
+          rule[k * 4 + q] = { { plane[q][0], plane[q][1], k == 0 ? -gp2 : +gp2 }, 1. };
+      return rule;
+    }();
+
+    constexpr std::array< QuadraturePoint< 3 >, 27 > gauss3x3x3 = [] {
+      constexpr std::array< double, 3 > points  = { -gp3, 0, +gp3 };
+      constexpr std::array< double, 3 > weights = { 5. / 9, 8. / 9, 5. / 9 };
+      std::array< QuadraturePoint< 3 >, 27 > rule{};
+      for ( int k = 0; k < 3; k++ )
+        for ( int j = 0; j < 3; j++ )
+          for ( int i = 0; i < 3; i++ )
+            rule[k * 9 + j * 3 + i] = { { points[i], points[j], points[k] }, weights[i] * weights[j] * weights[k] };
+      return rule;
+    }();
+
+    constexpr std::array< QuadraturePoint< 3 >, 14 > irons14 = [] {
+      using Quadrature::irons14A;
+      using Quadrature::irons14B;
+
+      std::array< QuadraturePoint< 3 >, 14 > rule{};
+      for ( int i = 0; i < 6; i++ ) {
+        rule[i].xi[i / 2] = i % 2 == 0 ? -irons14A : +irons14A;
+        rule[i].weight    = 320. / 361;
+      }
+
+      // corners in the order of the nodes of hexa8
+      for ( int i = 0; i < 8; i++ ) {
+        const auto& X = Shape< Hexa8 >::nodes[i];
+        rule[6 + i]   = { { X[0] * irons14B, X[1] * irons14B, X[2] * irons14B }, 121. / 361 };
+      }
+      return rule;
+    }();
+
+    /** @brief Quadrature points at the nodes of linear elements, and Simpson's rule for bar3. */
+    template < ElementShapes shape >
+    constexpr auto nodal()
+    {
+      using S = Shape< shape >;
+
+      constexpr auto   X      = getNodeCoordinates< shape >();
+      constexpr double volume = S::isSimplex ? 1. / 6 : S::nDim == 1 ? 2. : S::nDim == 2 ? 4. : 8.;
+
+      std::array< QuadraturePoint< S::nDim >, S::nNodes > rule{};
+      for ( int a = 0; a < S::nNodes; a++ ) {
+        for ( int i = 0; i < S::nDim; i++ )
+          rule[a].xi[i] = X[a * S::nDim + i];
+
+        if constexpr ( shape == Bar3 )
+          rule[a].weight = a < 2 ? 1. / 3 : 4. / 3;
+        else
+          rule[a].weight = volume / S::nNodes;
+      }
+      return rule;
+    }
+  } // namespace Rules
+
+  /** @brief Check if a rule exists for a shape and integration type, cf. Quadrature::getGaussPointInfo. */
+  constexpr bool hasQuadratureRule( ElementShapes shape, IntegrationTypes integrationType )
+  {
+    switch ( integrationType ) {
+    case IntegrationTypes::FullIntegration:
+    case IntegrationTypes::ReducedIntegration: return true;
+    case IntegrationTypes::IronsIntegration: return shape == Hexa8 || shape == Hexa20;
+    case IntegrationTypes::NodalIntegration:
+      return shape == Bar2 || shape == Bar3 || shape == Quad4 || shape == Tetra4 || shape == Hexa8;
+    }
+    return false;
+  }
+
+  /** @brief Quadrature rule of a shape and integration type, cf. Quadrature::getGaussPointInfo. */
+  template < ElementShapes shape, IntegrationTypes integrationType >
+  constexpr auto getQuadratureRule()
+  {
+    static_assert( hasQuadratureRule( shape, integrationType ), "no quadrature rule for this shape" );
+
+    constexpr bool isFull = integrationType == IntegrationTypes::FullIntegration;
+
+    if constexpr ( integrationType == IntegrationTypes::IronsIntegration )
+      return Rules::irons14;
+    else if constexpr ( integrationType == IntegrationTypes::NodalIntegration )
+      return Rules::nodal< shape >();
+    else if constexpr ( shape == Bar2 ) {
+      if constexpr ( isFull )
+        return Rules::gauss2;
+      else
+        return Rules::gauss1;
+    }
+    else if constexpr ( shape == Bar3 ) {
+      if constexpr ( isFull )
+        return Rules::gauss3;
+      else
+        return Rules::gauss2;
+    }
+    else if constexpr ( shape == Quad4 ) {
+      if constexpr ( isFull )
+        return Rules::gauss2x2;
+      else
+        return Rules::gauss1x1;
+    }
+    else if constexpr ( shape == Quad8 ) {
+      if constexpr ( isFull )
+        return Rules::gauss3x3;
+      else
+        return Rules::gauss2x2;
+    }
+    else if constexpr ( shape == Tetra4 )
+      return Rules::tetra1;
+    else if constexpr ( shape == Tetra10 )
+      return Rules::tetra4;
+    else if constexpr ( shape == Hexa8 ) {
+      if constexpr ( isFull )
+        return Rules::gauss2x2x2;
+      else
+        return Rules::gauss1x1x1;
+    }
+    else if constexpr ( shape == Hexa20 ) {
+      if constexpr ( isFull )
+        return Rules::gauss3x3x3;
+      else
+        return Rules::gauss2x2x2;
+    }
+  }
+
+  /** @brief Type-erased access to a Table. */
+  struct TableView {
+    ElementShapes shape;
+    int           nDim;
+    int           nNodes;
+    int           nQuadraturePoints;
+    const double* xi;
+    const double* weights;
+    const double* N;
+    const double* dNdXi;
+    const double* nodeCoordinates;
+
+    /** @brief Parent coordinates of a quadrature point (nDim). */
+    const double* getXi( int qp ) const { return xi + qp * nDim; }
+
+    /** @brief Shape functions at a quadrature point (nNodes). */
+    const double* getN( int qp ) const { return N + qp * nNodes; }
+
+    /** @brief Derivatives of the shape functions at a quadrature point, column major (nDim x nNodes). */
+    const double* getdNdXi( int qp ) const { return dNdXi + qp * nDim * nNodes; }
+  };
+
+  /**
+   * @class Table
+   * @brief Quadrature rule and shape functions evaluated at the quadrature points, computed at compile time.
+   */
+  template < ElementShapes shape, IntegrationTypes integrationType >
+  struct Table {
+    static constexpr int  nDim              = Shape< shape >::nDim;
+    static constexpr int  nNodes            = Shape< shape >::nNodes;
+    static constexpr auto rule              = getQuadratureRule< shape, integrationType >();
+    static constexpr int  nQuadraturePoints = rule.size();
+
+    static constexpr std::array< double, nQuadraturePoints* nDim > xi = [] {
+      std::array< double, nQuadraturePoints * nDim > result{};
+      for ( int q = 0; q < nQuadraturePoints; q++ )
+        for ( int i = 0; i < nDim; i++ )
+          result[q * nDim + i] = rule[q].xi[i];
+      return result;
+    }();
+
+    static constexpr std::array< double, nQuadraturePoints > weights = [] {
+      std::array< double, nQuadraturePoints > result{};
+      for ( int q = 0; q < nQuadraturePoints; q++ )
+        result[q] = rule[q].weight;
+      return result;
+    }();
+
+    static constexpr std::array< double, nQuadraturePoints* nNodes > N = [] {
+      std::array< double, nQuadraturePoints * nNodes > result{};
+      for ( int q = 0; q < nQuadraturePoints; q++ ) {
+        std::array< double, nNodes >        N_{};
+        std::array< double, nDim * nNodes > dNdXi_{};
+        evaluate< shape >( rule[q].xi, N_, dNdXi_ );
+        for ( int a = 0; a < nNodes; a++ )
+          result[q * nNodes + a] = N_[a];
+      }
+      return result;
+    }();
+
+    static constexpr std::array< double, nQuadraturePoints* nDim* nNodes > dNdXi = [] {
+      std::array< double, nQuadraturePoints * nDim * nNodes > result{};
+      for ( int q = 0; q < nQuadraturePoints; q++ ) {
+        std::array< double, nNodes >        N_{};
+        std::array< double, nDim * nNodes > dNdXi_{};
+        evaluate< shape >( rule[q].xi, N_, dNdXi_ );
+        for ( int i = 0; i < nDim * nNodes; i++ )
+          result[q * nDim * nNodes + i] = dNdXi_[i];
+      }
+      return result;
+    }();
+
+    static constexpr std::array< double, nDim* nNodes > nodeCoordinates = getNodeCoordinates< shape >();
+
+    static constexpr TableView view = { shape,
+                                        nDim,
+                                        nNodes,
+                                        nQuadraturePoints,
+                                        xi.data(),
+                                        weights.data(),
+                                        N.data(),
+                                        dNdXi.data(),
+                                        nodeCoordinates.data() };
+  };
+
+  /** @brief Table of an element with nDim dimensions and nNodes nodes for an integration type. */
+  template < int nDim, int nNodes >
+  const TableView& getTable( IntegrationTypes integrationType )
+  {
+    constexpr ElementShapes shape = getShape( nDim, nNodes );
+
+    switch ( integrationType ) {
+    case IntegrationTypes::FullIntegration: return Table< shape, IntegrationTypes::FullIntegration >::view;
+    case IntegrationTypes::ReducedIntegration: return Table< shape, IntegrationTypes::ReducedIntegration >::view;
+    case IntegrationTypes::IronsIntegration: {
+      if constexpr ( hasQuadratureRule( shape, IntegrationTypes::IronsIntegration ) )
+        return Table< shape, IntegrationTypes::IronsIntegration >::view;
+      break;
+    }
+    case IntegrationTypes::NodalIntegration: {
+      if constexpr ( hasQuadratureRule( shape, IntegrationTypes::NodalIntegration ) )
+        return Table< shape, IntegrationTypes::NodalIntegration >::view;
+      break;
+    }
+    }
+
+    throw std::invalid_argument( "Invalid shape/integrationType combination" );
+  }
+
+  /**
+   * @brief Check if the isoparametric map of an element is affine, i.e., if its Jacobian is constant.
+   * @details This is the case if all nodes are located at \f$ \boldsymbol{x}_0 + \boldsymbol{J}\, (
+   * \boldsymbol{\xi}_a - \boldsymbol{\xi}_0 ) \f$, with the position \f$\boldsymbol{x}_0\f$ and the Jacobian
+   * \f$\boldsymbol{J}\f$ at the first quadrature point \f$\boldsymbol{\xi}_0\f$, e.g., for straight-sided
+   * tetrahedra or parallelepipeds.
+   * @param table Reference element table.
+   * @param coordinates Node coordinates, node by node.
+   * @param J Jacobian at the first quadrature point.
+   * @param tolerance Tolerance relative to the size of the element.
+   */
+  template < int nDim, int nNodes >
+  bool isAffine( const TableView&                           table,
+                 const double*                              coordinates,
+                 const Eigen::Matrix< double, nDim, nDim >& J,
+                 double                                     tolerance = 1e-12 )
+  {
+    const Eigen::Map< const Eigen::Matrix< double, nDim, nNodes > > x( coordinates );
+    const Eigen::Map< const Eigen::Matrix< double, nDim, nNodes > > X( table.nodeCoordinates );
+    const Eigen::Map< const Eigen::Matrix< double, nDim, 1 > >      xi0( table.getXi( 0 ) );
+    const Eigen::Map< const Eigen::Matrix< double, nNodes, 1 > >    N0( table.getN( 0 ) );
+
+    const Eigen::Matrix< double, nDim, 1 > x0 = x * N0;
+
+    for ( int a = 0; a < nNodes; a++ )
+      if ( ( x.col( a ) - x0 - J * ( X.col( a ) - xi0 ) ).cwiseAbs().maxCoeff() > tolerance * J.cwiseAbs().maxCoeff() )
+        return false;
+
+    return true;
+  }
+
+} // namespace Marmot::FiniteElement::ReferenceElement
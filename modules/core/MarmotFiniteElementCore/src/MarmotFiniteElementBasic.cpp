@@ -101,6 +101,25 @@ namespace Marmot {
                                                                  IntegrationTypes                     integrationType )
     {
       using Marmot::FiniteElement::ElementShapes;
+
+      if ( integrationType == IntegrationTypes::IronsIntegration ) {
+        if ( shape == ElementShapes::Hexa8 || shape == ElementShapes::Hexa20 )
+          return Spatial3D::gaussPointListIrons14;
+
+        throw std::invalid_argument( "Invalid shape/integrationType combination" );
+      }
+
+      if ( integrationType == IntegrationTypes::NodalIntegration ) {
+        switch ( shape ) {
+        case ( ElementShapes::Bar2 ): return Spatial1D::gaussPointListNodalBar2;
+        case ( ElementShapes::Bar3 ): return Spatial1D::gaussPointListNodalBar3;
+        case ( ElementShapes::Quad4 ): return Spatial2D::gaussPointListNodalQuad4;
+        case ( ElementShapes::Tetra4 ): return Spatial3D::gaussPointListNodalTetra4;
+        case ( ElementShapes::Hexa8 ): return Spatial3D::gaussPointListNodalHexa8;
+        default: throw std::invalid_argument( "Invalid shape/integrationType combination" );
+        }
+      }
+
       switch ( shape ) {
       case ( ElementShapes::Bar2 ): {
         if ( integrationType == IntegrationTypes::FullIntegration )
@@ -19,7 +19,12 @@ MarmotElementSpatialWrapper::MarmotElementSpatialWrapper( int
     rhsIndicesToBeProjected( rhsIndicesToBeWrapped, nRhsIndicesToBeWrapped ),
     projectedSize( nRhsChild ),
     unprojectedSize( nRhsChild + rhsIndicesToBeProjected.size() * ( nDim - nDimChild ) ),
-    childElement( std::move( childElement ) )
+    childElement( std::move( childElement ) ),
+    QProjected( projectedSize ),
+    dQProjected( projectedSize ),
+    PeProjected( projectedSize ),
+    KeProjected( projectedSize, projectedSize ),
+    KeProjectedTimesP( projectedSize, unprojectedSize )
 {
 }
 
@@ -155,16 +160,16 @@ void MarmotElementSpatialWrapper::computeYourself( const double* Q,
   Map< const VectorXd > Q_Unprojected( Q, unprojectedSize );
   Map< const VectorXd > dQ_Unprojected( dQ, unprojectedSize );
 
-  VectorXd Q_Projected  = P * Q_Unprojected;
-  VectorXd dQ_Projected = P * dQ_Unprojected;
+  QProjected.noalias()  = P * Q_Unprojected;
+  dQProjected.noalias() = P * dQ_Unprojected;
 
-  VectorXd Pe_Projected = VectorXd::Zero( projectedSize );
-  MatrixXd Ke_Projected = MatrixXd::Zero( projectedSize, projectedSize );
+  PeProjected.setZero();
+  KeProjected.setZero();
 
-  childElement->computeYourself( Q_Projected.data(),
-                                 dQ_Projected.data(),
-                                 Pe_Projected.data(),
-                                 Ke_Projected.data(),
+  childElement->computeYourself( QProjected.data(),
+                                 dQProjected.data(),
+                                 PeProjected.data(),
+                                 KeProjected.data(),
                                  time,
                                  dT,
                                  pNewDT );
@@ -175,8 +180,9 @@ void MarmotElementSpatialWrapper::computeYourself( const double* Q,
   Map< VectorXd > Pe_Unprojected( Pe_, unprojectedSize );
   Map< MatrixXd > Ke_Unprojected( Ke_, unprojectedSize, unprojectedSize );
 
-  Ke_Unprojected += P.transpose() * Ke_Projected * P;
-  Pe_Unprojected += P.transpose() * Pe_Projected;
+  KeProjectedTimesP.noalias() = KeProjected * P;
+  Ke_Unprojected.noalias() += P.transpose() * KeProjectedTimesP;
+  Pe_Unprojected.noalias() += P.transpose() * PeProjected;
 }
 
 void MarmotElementSpatialWrapper::setInitialConditions( StateTypes state, const double* values )
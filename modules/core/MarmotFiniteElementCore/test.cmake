@@ -0,0 +1,8 @@
+# add current directory to the source for the tests
+SET(CURR_TEST_SOURCE_DIR "${CMAKE_CURRENT_LIST_DIR}/test")
+
+# Tests for the structured B-operator kernels in MarmotFiniteElement
+add_marmot_test("TestMarmotFiniteElementSpatial3D" "${CURR_TEST_SOURCE_DIR}/TestMarmotFiniteElementSpatial3D.cpp")
+
+# Tests for MarmotReferenceElement
+add_marmot_test("TestMarmotReferenceElement" "${CURR_TEST_SOURCE_DIR}/TestMarmotReferenceElement.cpp")
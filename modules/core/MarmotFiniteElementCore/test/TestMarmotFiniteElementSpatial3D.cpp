@@ -0,0 +1,60 @@
+#include "Marmot/MarmotFiniteElement.h"
+#include "Marmot/MarmotTesting.h"
+
+using namespace Marmot::Testing;
+using namespace Marmot::FiniteElement;
+
+/* Compare the structured kernels with the products of the dense B-operator of a hexa20. */
+template < typename T >
+void compareStructuredKernelsWithB( double tolerance )
+{
+  constexpr int nNodes = 20, nDof = 3 * nNodes;
+
+  const Eigen::Matrix< T, 3, nNodes >    dNdX = Eigen::Matrix< T, 3, nNodes >::Random();
+  const Eigen::Matrix< double, 6, nDof > B    = Spatial3D::B< nNodes >( dNdX.template cast< double >() );
+
+  const Eigen::Matrix< double, nDof, 1 > q = Eigen::Matrix< double, nDof, 1 >::Random();
+  const Eigen::Matrix< double, 6, 1 >    S = Eigen::Matrix< double, 6, 1 >::Random();
+  const Eigen::Matrix< double, 6, 6 >    C = Eigen::Matrix< double, 6, 6 >::Random();
+  const double                           f = 0.7;
+
+  const Eigen::Matrix< double, 6, 1 > e = Spatial3D::BTimes< nNodes >( dNdX, q );
+  throwExceptionOnFailure( checkIfEqual( Eigen::MatrixXd( e ), Eigen::MatrixXd( B * q ), tolerance ),
+                           "B times q differs from dense product" );
+
+  Eigen::Matrix< double, nDof, 1 > P = Eigen::Matrix< double, nDof, 1 >::Ones();
+  Spatial3D::addBTransposeTimes< nNodes >( P, dNdX, S, f );
+  throwExceptionOnFailure( checkIfEqual( Eigen::MatrixXd( P ),
+                                         Eigen::MatrixXd( Eigen::Matrix< double, nDof, 1 >::Ones() +
+                                                          f * B.transpose() * S ),
+                                         tolerance ),
+                           "B^T S differs from dense product" );
+
+  Eigen::Matrix< double, nDof, nDof > K = Eigen::Matrix< double, nDof, nDof >::Ones();
+  Spatial3D::addBTransposeCB< nNodes >( K, dNdX, C, f );
+  throwExceptionOnFailure( checkIfEqual( Eigen::MatrixXd( K ),
+                                         Eigen::MatrixXd( Eigen::Matrix< double, nDof, nDof >::Ones() +
+                                                          f * B.transpose() * C * B ),
+                                         tolerance ),
+                           "B^T C B differs from dense product" );
+}
+
+void testStructuredKernelsDouble()
+{
+  compareStructuredKernelsWithB< double >( 1e-12 );
+}
+
+void testStructuredKernelsFloat()
+{
+  // the derivatives are exactly representable in double, so only rounding of the products remains
+  compareStructuredKernelsWithB< float >( 1e-12 );
+}
+
+int main()
+{
+  auto tests = std::vector< std::function< void() > >{ testStructuredKernelsDouble, testStructuredKernelsFloat };
+
+  executeTestsAndCollectExceptions( tests );
+
+  return 0;
+}
@@ -0,0 +1,181 @@
+#include "Marmot/MarmotGeometryElement.h"
+#include "Marmot/MarmotReferenceElement.h"
+#include "Marmot/MarmotTesting.h"
+
+using namespace Marmot::Testing;
+using namespace Marmot::FiniteElement;
+using namespace Marmot::FiniteElement::ReferenceElement;
+
+/* Compare a table with the quadrature rule of getGaussPointInfo and with the shape functions evaluated at runtime. */
+template < int nDim, int nNodes, typename NFunction, typename dNdXiFunction >
+void compareTable( Quadrature::IntegrationTypes integrationType, NFunction N, dNdXiFunction dNdXi )
+{
+  const TableView& table = getTable< nDim, nNodes >( integrationType );
+  const auto&      rule  = Quadrature::getGaussPointInfo( table.shape, integrationType );
+  throwExceptionOnFailure( table.nQuadraturePoints == static_cast< int >( rule.size() ),
+                           "wrong number of quadrature points" );
+
+  for ( int q = 0; q < table.nQuadraturePoints; q++ ) {
+    const Eigen::Matrix< double, nDim, 1 > xi = rule[q].xi;
+
+    throwExceptionOnFailure( checkIfEqual( Eigen::MatrixXd( Eigen::Map< const Eigen::Matrix< double, nDim, 1 > >(
+                                             table.getXi( q ) ) ),
+                                           Eigen::MatrixXd( xi ),
+                                           1e-15 ),
+                             "wrong quadrature point" );
+    throwExceptionOnFailure( checkIfEqual( table.weights[q], rule[q].weight, 1e-14 ), "wrong quadrature weight" );
+
+    throwExceptionOnFailure( checkIfEqual( Eigen::MatrixXd( Eigen::Map< const Eigen::Matrix< double, 1, nNodes > >(
+                                             table.getN( q ) ) ),
+                                           Eigen::MatrixXd( N( xi ) ),
+                                           1e-14 ),
+                             "wrong shape functions" );
+    throwExceptionOnFailure( checkIfEqual( Eigen::MatrixXd( Eigen::Map< const Eigen::Matrix< double, nDim, nNodes > >(
+                                             table.getdNdXi( q ) ) ),
+                                           Eigen::MatrixXd( dNdXi( xi ) ),
+                                           1e-14 ),
+                             "wrong shape function derivatives" );
+  }
+}
+
+template < int nDim, int nNodes >
+void compareTableWithGeometryElement()
+{
+  MarmotGeometryElement< nDim, nNodes > geometry;
+
+  for ( auto integrationType : { Quadrature::FullIntegration,
+                                  Quadrature::ReducedIntegration,
+                                  Quadrature::IronsIntegration,
+                                  Quadrature::NodalIntegration } ) {
+    if ( !hasQuadratureRule( getShape( nDim, nNodes ), integrationType ) )
+      continue;
+
+    compareTable< nDim, nNodes >(
+      integrationType,
+      [&]( const Eigen::Matrix< double, nDim, 1 >& xi ) { return geometry.N( xi ); },
+      [&]( const Eigen::Matrix< double, nDim, 1 >& xi ) { return geometry.dNdXi( xi ); } );
+  }
+
+  // each shape function is one at its node and zero at all others
+  const TableView& table = getTable< nDim, nNodes >( Quadrature::FullIntegration );
+  for ( int a = 0; a < nNodes; a++ ) {
+    const Eigen::Matrix< double, nDim, 1 > X = Eigen::Map< const Eigen::Matrix< double, nDim, 1 > >(
+      table.nodeCoordinates + a * nDim );
+
+    throwExceptionOnFailure( checkIfEqual( Eigen::MatrixXd( geometry.N( X ) ),
+                                           Eigen::MatrixXd( Eigen::Matrix< double, 1, nNodes >::Unit( a ) ),
+                                           1e-14 ),
+                             "wrong node coordinates" );
+  }
+}
+
+void testBarTables()
+{
+  compareTableWithGeometryElement< 1, 2 >();
+
+  for ( auto integrationType : { Quadrature::FullIntegration, Quadrature::ReducedIntegration } )
+    compareTable< 1, 3 >(
+      integrationType,
+      []( const Eigen::Matrix< double, 1, 1 >& xi ) { return Spatial1D::Bar3::N( xi( 0 ) ); },
+      []( const Eigen::Matrix< double, 1, 1 >& xi ) { return Spatial1D::Bar3::dNdXi( xi( 0 ) ); } );
+}
+
+void testQuadTables()
+{
+  compareTableWithGeometryElement< 2, 4 >();
+  compareTableWithGeometryElement< 2, 8 >();
+}
+
+void testTetraTables()
+{
+  compareTableWithGeometryElement< 3, 4 >();
+  compareTableWithGeometryElement< 3, 10 >();
+}
+
+void testHexaTables()
+{
+  compareTableWithGeometryElement< 3, 8 >();
+  compareTableWithGeometryElement< 3, 20 >();
+}
+
+void testTablesAreConstantExpressions()
+{
+  // partition of unity, evaluated by the compiler
+  using Hexa20Table = Table< Hexa20, Quadrature::FullIntegration >;
+  constexpr double sumN = [] {
+    double sum = 0;
+    for ( int a = 0; a < Hexa20Table::nNodes; a++ )
+      sum += Hexa20Table::N[a];
+    return sum;
+  }();
+
+  static_assert( Hexa20Table::nQuadraturePoints == 27 );
+  throwExceptionOnFailure( checkIfEqual( sumN, 1.0, 1e-14 ), "no partition of unity" );
+}
+
+void testIronsRuleIsExact()
+{
+  // all monomials up to degree 5, as with the 3x3x3 rule
+  const TableView& irons = getTable< 3, 20 >( Quadrature::IronsIntegration );
+  throwExceptionOnFailure( irons.nQuadraturePoints == 14, "wrong number of quadrature points" );
+
+  auto exact = []( int p ) { return p % 2 == 0 ? 2. / ( p + 1 ) : 0.; };
+
+  for ( int i = 0; i <= 5; i++ )
+    for ( int j = 0; i + j <= 5; j++ )
+      for ( int k = 0; i + j + k <= 5; k++ ) {
+        double integral = 0;
+        for ( int q = 0; q < irons.nQuadraturePoints; q++ ) {
+          const double* xi = irons.getXi( q );
+          integral += irons.weights[q] * std::pow( xi[0], i ) * std::pow( xi[1], j ) * std::pow( xi[2], k );
+        }
+        throwExceptionOnFailure( checkIfEqual( integral, exact( i ) * exact( j ) * exact( k ), 1e-14 ),
+                                 "monomial not integrated exactly" );
+      }
+}
+
+template < int nDim, int nNodes >
+void checkNodalRule()
+{
+  // quadrature points at the nodes, in the order of the nodes
+  const TableView& table = getTable< nDim, nNodes >( Quadrature::NodalIntegration );
+  throwExceptionOnFailure( table.nQuadraturePoints == nNodes, "wrong number of quadrature points" );
+  throwExceptionOnFailure( checkIfEqual( Eigen::MatrixXd( Eigen::Map< const Eigen::Matrix< double, nNodes, nNodes > >(
+                                           table.N ) ),
+                                         Eigen::MatrixXd( Eigen::Matrix< double, nNodes, nNodes >::Identity() ),
+                                         1e-15 ),
+                           "quadrature points not at the nodes" );
+}
+
+void testNodalRules()
+{
+  checkNodalRule< 1, 2 >();
+  checkNodalRule< 1, 3 >();
+  checkNodalRule< 2, 4 >();
+  checkNodalRule< 3, 4 >();
+  checkNodalRule< 3, 8 >();
+
+  bool hasThrown = false;
+  try {
+    getTable< 3, 20 >( Quadrature::NodalIntegration );
+  }
+  catch ( const std::invalid_argument& ) {
+    hasThrown = true;
+  }
+  throwExceptionOnFailure( hasThrown, "no nodal rule expected for hexa20" );
+}
+
+int main()
+{
+  auto tests = std::vector< std::function< void() > >{ testBarTables,
+                                                       testQuadTables,
+                                                       testTetraTables,
+                                                       testHexaTables,
+                                                       testTablesAreConstantExpressions,
+                                                       testIronsRuleIsExact,
+                                                       testNodalRules };
+
+  executeTestsAndCollectExceptions( tests );
+
+  return 0;
+}
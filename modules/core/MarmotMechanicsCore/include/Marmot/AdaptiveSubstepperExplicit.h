@@ -27,6 +27,7 @@
 
 #pragma once
 #include "Marmot/MarmotJournal.h"
+#include "Marmot/MarmotTracing.h"
 #include "Marmot/MarmotTypedefs.h"
 
 namespace Marmot::NumericalAlgorithms {
@@ -114,6 +115,9 @@ namespace Marmot::NumericalAlgorithms {
 
     bool acceptSubstepWithFullStepOnly();
     bool splitCurrentSubstep();
+
+    /// spans of the substeps for tracing
+    Marmot::Tracing::SpanSequence substepSpans;
   };
 
 } // namespace Marmot::NumericalAlgorithms
@@ -196,6 +200,8 @@ namespace Marmot::NumericalAlgorithms {
   template < size_t n, size_t nState >
   double AdaptiveSubstepperExplicit< n, nState >::getNextSubstep()
   {
+    substepSpans.next( "substep", "substepper" );
+
     switch ( currentState ) {
     case FullStep: {
       const double remainingProgress = 1.0 - currentProgress;
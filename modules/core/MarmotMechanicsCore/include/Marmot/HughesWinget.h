@@ -45,6 +45,23 @@ namespace Marmot::NumericalAlgorithms {
     Marmot::EigenTensors::Tensor633d compute_dS_dF( const Marmot::Vector6d& stress,
                                                     const Eigen::Matrix3d&  FInv,
                                                     const Marmot::Matrix6d& dChauchyDEps );
+
+    /**
+     * @brief Computes the algorithmic tangent \f$ \frac{\partial \sigma}{\partial F} \f$ in place.
+     *
+     * Fused kernel which exploits the sparsity of \f$ \frac{\partial \Omega}{\partial l} \f$ and
+     * \f$ \frac{\partial d}{\partial l} \f$ instead of contracting the full projection tensors.
+     *
+     * @param dS_dF Pointer to the 6x3x3 tensor (column major) which is overwritten.
+     * @param stress The (rotated) Cauchy stress in Voigt notation.
+     * @param FInv The inverse of the deformation gradient at the end of the increment.
+     * @param dChauchyDEps The Jaumann tangent provided by the small strain material.
+     */
+    void compute_dS_dF( double*                 dS_dF,
+                        const Marmot::Vector6d& stress,
+                        const Eigen::Matrix3d&  FInv,
+                        const Marmot::Matrix6d& dChauchyDEps );
+
     Eigen::Matrix3d compute_dScalar_dF( const Eigen::Matrix3d& FInv, const Marmot::Vector6d& dScalarDEps );
 
   private:
@@ -231,8 +231,8 @@ namespace Marmot::Materials {
      */
 
     void updateStateVarMatrix( const double                 dT,
-                               Properties                   elasticModuli,
-                               Properties                   retardationTimes,
+                               const Properties&            elasticModuli,
+                               const Properties&            retardationTimes,
                                Eigen::Ref< StateVarMatrix > stateVars,
                                const Marmot::Vector6d&      dStress,
                                const Marmot::Matrix6d&      unitComplianceMatrix );
@@ -253,13 +253,13 @@ namespace Marmot::Materials {
      * @param[in] factor the solidification factor (in non aging viscoelasticity set to 1).
      */
 
-    void evaluateKelvinChain( const double      dT,
-                              Properties        elasticModuli,
-                              Properties        retardationTimes,
-                              StateVarMatrix    stateVars,
-                              double&           uniaxialCompliance,
-                              Marmot::Vector6d& dStrain,
-                              const double      factor );
+    void evaluateKelvinChain( const double                              dT,
+                              const Properties&                         elasticModuli,
+                              const Properties&                         retardationTimes,
+                              const Eigen::Ref< const StateVarMatrix >& stateVars,
+                              double&                                   uniaxialCompliance,
+                              Marmot::Vector6d&                         dStrain,
+                              const double                              factor );
     /**
      * @brief Computes the time-dependent relaxation factors \f$\lambda\f$ and \f$\beta\f$ for a given Kelvin unit.
      *
@@ -272,5 +272,82 @@ namespace Marmot::Materials {
 
     void computeLambdaAndBeta( double dT, double tau, double& lambda, double& beta );
 
+    /**
+     * @brief Time-dependent factors \f$\lambda\f$ and \f$\beta\f$ of all Kelvin units for a time increment.
+     *
+     * The factors only depend on the time increment and the retardation times, and can thus be computed once per
+     * increment for all material points sharing the Kelvin chain.
+     */
+    struct IncrementFactors {
+      double     dT;     ///< the time increment.
+      Properties lambda; ///< time dependent factor for each Kelvin unit.
+      Properties beta;   ///< time dependent factor for each Kelvin unit.
+    };
+
+    /**
+     * @brief Computes the time-dependent factors \f$\lambda\f$ and \f$\beta\f$ of all Kelvin units.
+     *
+     * @param[in] dT the time increment.
+     * @param[in] retardationTimes vector containing the retardation time for each Kelvin unit in the Kelvin chain.
+     * @returns the factors of each Kelvin unit, see computeLambdaAndBeta.
+     */
+    IncrementFactors computeIncrementFactors( double dT, const Properties& retardationTimes );
+
+    /**
+     * @brief Updates the viscoelastic strain state variables for each Kelvin unit with precomputed factors.
+     *
+     * @param[in] factors the time-dependent factors of the Kelvin units for the time increment.
+     * @param[in] elasticModuli vector containing the elastic moduli of ech Kelvin unit in the Kelvin chain.
+     * @param[in,out] stateVars the \f$[6\times \mu]\f$ matrix that contains the viscoelastic strain update for each
+     * unit of the Kelvin chain.
+     * @param[in] dStress the \f$[6\times 1]\f$ vector of the total stress increment.
+     * @param[in] unitComplianceMatrix the [6\times 6] compliance matrix of the material with unit compliance and given
+     * Poisson coeffiscient.
+     */
+    void updateStateVarMatrix( const IncrementFactors&      factors,
+                               const Properties&            elasticModuli,
+                               Eigen::Ref< StateVarMatrix > stateVars,
+                               const Marmot::Vector6d&      dStress,
+                               const Marmot::Matrix6d&      unitComplianceMatrix );
+
+    /**
+     * @brief Computes the viscoelastic strain state variables at the end of the increment from those at its begin.
+     *
+     * Same update rule as the in place update, for materials keeping the state at the begin of the increment in a
+     * separate buffer. The old state variables may alias the updated ones.
+     *
+     * @param[in] factors the time-dependent factors of the Kelvin units for the time increment.
+     * @param[in] elasticModuli vector containing the elastic moduli of ech Kelvin unit in the Kelvin chain.
+     * @param[in] stateVarsOld the \f$[6\times \mu]\f$ matrix of the state variables at the begin of the increment.
+     * @param[out] stateVars the \f$[6\times \mu]\f$ matrix of the updated state variables.
+     * @param[in] dStress the \f$[6\times 1]\f$ vector of the total stress increment.
+     * @param[in] unitComplianceMatrix the [6\times 6] compliance matrix of the material with unit compliance and given
+     * Poisson coeffiscient.
+     */
+    void updateStateVarMatrix( const IncrementFactors&                   factors,
+                               const Properties&                         elasticModuli,
+                               const Eigen::Ref< const StateVarMatrix >& stateVarsOld,
+                               Eigen::Ref< StateVarMatrix >              stateVars,
+                               const Marmot::Vector6d&                   dStress,
+                               const Marmot::Matrix6d&                   unitComplianceMatrix );
+
+    /**
+     * @brief Evaluates the viscoelastic response of the Kelvin chain over a time increment with precomputed factors.
+     *
+     * @param[in] factors the time-dependent factors of the Kelvin units for the time increment.
+     * @param[in] elasticModuli vector containing the elastic moduli of ech Kelvin unit in the Kelvin chain.
+     * @param[in] stateVars the \f$[6\times \mu]\f$ matrix that contains the viscoelastic strain update for each unit of
+     * the Kelvin chain.
+     * @param[in,out] uniaxialCompliance number containing the \f$\sum^M_{\mu=1}\frac{\lambda^{\mu, k}}{E_\mu}\f$.
+     * @param[in,out] dStrain the viscoelastic update of the strain based on the state variables of the Kelvin chain.
+     * @param[in] factor the solidification factor (in non aging viscoelasticity set to 1).
+     */
+    void evaluateKelvinChain( const IncrementFactors&                   factors,
+                              const Properties&                         elasticModuli,
+                              const Eigen::Ref< const StateVarMatrix >& stateVars,
+                              double&                                   uniaxialCompliance,
+                              Marmot::Vector6d&                         dStrain,
+                              const double                              factor );
+
   } // namespace KelvinChain
 } // namespace Marmot::Materials
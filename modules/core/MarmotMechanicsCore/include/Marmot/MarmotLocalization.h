@@ -40,5 +40,41 @@ namespace Marmot {
 
     double minimumDeterminantAcousticTensor( const Marmot::Matrix6d& materialTangent );
 
+    /**
+     * @brief Result of the search for the minimum determinant of the acoustic tensor.
+     */
+    struct AcousticTensorMinimum {
+      double           determinant;  ///< the minimum determinant found
+      Marmot::Vector3d normalVector; ///< the corresponding (unit) normal vector
+    };
+
+    /**
+     * @brief Finds the minimum determinant of the acoustic tensor with an adaptive direction search.
+     *
+     * A coarse, precomputed set of directions on the hemisphere is evaluated first. The most critical directions are
+     * subsequently refined by a Newton method on the unit sphere, using the analytical gradient and Hessian of
+     * \f$ \det \boldsymbol{Q}( \boldsymbol{n} ) \f$. No trigonometric functions are evaluated per call.
+     *
+     * @param materialTangent The material tangent in Voigt notation.
+     * @return The minimum determinant and the corresponding normal vector.
+     */
+    AcousticTensorMinimum adaptiveMinimumDeterminantAcousticTensor( const Marmot::Matrix6d& materialTangent );
+
+    /**
+     * @brief Batched version of adaptiveMinimumDeterminantAcousticTensor for many quadrature points.
+     *
+     * The evaluation of different points is independent, the function is reentrant and may be called concurrently on
+     * disjoint ranges. Optionally, the batch is distributed over nThreads threads.
+     *
+     * @param materialTangents Contiguous array of nPoints 6x6 (column major) material tangents.
+     * @param minimumDeterminants Array of size nPoints, which is overwritten with the minimum determinants.
+     * @param nPoints The number of points in the batch.
+     * @param nThreads The number of threads used for the evaluation.
+     */
+    void adaptiveMinimumDeterminantAcousticTensors( const double* materialTangents,
+                                                    double*       minimumDeterminants,
+                                                    int           nPoints,
+                                                    int           nThreads = 1 );
+
   } // namespace ContinuumMechanics::LocalizationAnalysis
 } // namespace Marmot
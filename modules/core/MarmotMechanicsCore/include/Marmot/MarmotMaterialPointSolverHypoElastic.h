@@ -209,7 +209,7 @@ private:
   /**
    * @brief Solve a single increment within a loading step
    * @param increment The Increment to be solved
-   * @throws std::runtime_error if the solver does not converge
+   * @return Status of the increment; a failed increment requires a reduced time increment
    *
    * @details This function implements a Newton-Raphson iterative
    * solver to compute the stress and strain state for the given increment.
@@ -217,7 +217,7 @@ private:
    * after convergence.
    *
    */
-  void solveIncrement( const Increment& increment );
+  Marmot::Status solveIncrement( const Increment& increment );
 
   /**
    * @brief Compute the residual for the current increment
@@ -30,6 +30,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 /// @brief A convenience auxiliary class for managing multiple statevars with arbitrary length in a single consecutive
@@ -50,6 +51,9 @@ public:
   /// check if the entry with name is managed
   inline bool contains( const std::string& name ) const { return theLayout.entries.count( name ); }
 
+  /// get the pointer to the first element in the statevar vector
+  inline double* data() const { return theStateVars; }
+
 protected:
   /// An entry in the statevar vector consists of the name and a certain length
   struct StateVarEntryDefinition {
@@ -92,3 +96,16 @@ protected:
   MarmotStateVarVectorManager( double* theStateVars, const StateVarVectorLayout& theLayout_ )
     : theStateVars( theStateVars ), theLayout( theLayout_ ){};
 };
+
+/// bind a manager to a statevar vector; an existing manager is constructed anew in place rather than reallocated, such
+/// that swapping double buffered statevar vectors does not allocate
+template < typename Manager, typename... Args >
+void bindStateVarManager( std::unique_ptr< Manager >& manager, Args&&... args )
+{
+  if ( manager ) {
+    std::destroy_at( manager.get() );
+    std::construct_at( manager.get(), std::forward< Args >( args )... );
+  }
+  else
+    manager = std::make_unique< Manager >( std::forward< Args >( args )... );
+}
@@ -27,6 +27,7 @@
 
 #pragma once
 #include "Marmot/MarmotJournal.h"
+#include "Marmot/MarmotTracing.h"
 #include "Marmot/MarmotTypedefs.h"
 
 namespace Marmot::NumericalAlgorithms {
@@ -77,6 +78,9 @@ namespace Marmot::NumericalAlgorithms {
     TangentSizedMatrix I77;
 
     MatrixStateStrain consistentTangent;
+
+    /// spans of the substeps for tracing
+    Marmot::Tracing::SpanSequence substepSpans;
   };
 } // namespace Marmot::NumericalAlgorithms
 
@@ -116,6 +120,8 @@ namespace Marmot::NumericalAlgorithms {
   template < int n >
   double PerezFougetSubstepper< n >::getNextSubstep()
   {
+    substepSpans.next( "substep", "substepper" );
+
     if ( passedSubsteps >= nPassesToIncrease )
       currentSubstepSize *= scaleUpFactor;
 
@@ -28,6 +28,7 @@
 #pragma once
 #include "Marmot/MarmotJournal.h"
 #include "Marmot/MarmotMath.h"
+#include "Marmot/MarmotTracing.h"
 #include "Marmot/MarmotTypedefs.h"
 
 namespace Marmot::NumericalAlgorithms {
@@ -76,6 +77,9 @@ namespace Marmot::NumericalAlgorithms {
     const Matrix6d& Cel;
 
     TangentSizedMatrix consistentTangent;
+
+    /// spans of the substeps for tracing
+    Marmot::Tracing::SpanSequence substepSpans;
   };
 } // namespace Marmot::NumericalAlgorithms
 
@@ -112,6 +116,8 @@ namespace Marmot::NumericalAlgorithms {
   template < int n >
   double PerezFougetSubstepper< n >::getNextSubstep()
   {
+    substepSpans.next( "substep", "substepper" );
+
     if ( passedSubsteps >= nPassesToIncrease )
       currentSubstepSize *= scaleUpFactor;
 
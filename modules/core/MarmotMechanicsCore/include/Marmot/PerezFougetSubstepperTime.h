@@ -26,6 +26,7 @@
  */
 
 #pragma once
+#include "Marmot/MarmotTracing.h"
 #include "Marmot/MarmotTypedefs.h"
 
 namespace Marmot::NumericalAlgorithms {
@@ -74,6 +75,9 @@ namespace Marmot::NumericalAlgorithms {
 
     TangentSizedMatrix elasticTangent;
     TangentSizedMatrix consistentTangent;
+
+    /// spans of the substeps for tracing
+    Marmot::Tracing::SpanSequence substepSpans;
   };
 } // namespace Marmot::NumericalAlgorithms
 
@@ -109,6 +113,8 @@ namespace Marmot::NumericalAlgorithms {
   template < int s >
   double PerezFougetSubstepperTime< s >::getNextSubstep()
   {
+    substepSpans.next( "substep", "substepper" );
+
     if ( passedSubsteps >= nPassesToIncrease )
       currentSubstepSize *= scaleUpFactor;
 
@@ -36,58 +36,78 @@ namespace Marmot::NumericalAlgorithms {
       dR * Marmot::ContinuumMechanics::VoigtNotation::voigtToStress( tensor ) * dR.transpose() );
   }
 
+  namespace {
+    using namespace Marmot::ContinuumMechanics::TensorUtility;
+
+    // Only a single entry of dStretchingRate_dVelocityGradient( :, k, l ) is nonzero (and equal to one),
+    // namely the one at the Voigt index of (k,l).
+    constexpr int voigtIndexOf[3][3] = { { IndexNotation::toVoigt< 3 >( 0, 0 ),
+                                           IndexNotation::toVoigt< 3 >( 0, 1 ),
+                                           IndexNotation::toVoigt< 3 >( 0, 2 ) },
+                                         { IndexNotation::toVoigt< 3 >( 1, 0 ),
+                                           IndexNotation::toVoigt< 3 >( 1, 1 ),
+                                           IndexNotation::toVoigt< 3 >( 1, 2 ) },
+                                         { IndexNotation::toVoigt< 3 >( 2, 0 ),
+                                           IndexNotation::toVoigt< 3 >( 2, 1 ),
+                                           IndexNotation::toVoigt< 3 >( 2, 2 ) } };
+
+    // tensor indices (i,j) for each Voigt index ij
+    constexpr std::pair< int, int > tensorIndicesOf[6] = { IndexNotation::fromVoigt< 3 >( 0 ),
+                                                           IndexNotation::fromVoigt< 3 >( 1 ),
+                                                           IndexNotation::fromVoigt< 3 >( 2 ),
+                                                           IndexNotation::fromVoigt< 3 >( 3 ),
+                                                           IndexNotation::fromVoigt< 3 >( 4 ),
+                                                           IndexNotation::fromVoigt< 3 >( 5 ) };
+  } // namespace
+
   Marmot::EigenTensors::Tensor633d HughesWinget::compute_dS_dF( const Marmot::Vector6d& stress,
                                                                 const Matrix3d&         FInv,
                                                                 const Marmot::Matrix6d& dChauchydEps )
   {
-    using namespace Marmot;
-    using namespace Marmot::ContinuumMechanics::TensorUtility;
-    using namespace Marmot::ContinuumMechanics::Kinematics::VelocityGradient;
-
-    EigenTensors::Tensor633d dS_dl;
     EigenTensors::Tensor633d dS_dF;
-    EigenTensors::Tensor633d dStressRotational_dl;
-    EigenTensors::Tensor633d dStressJaumann_dl;
-    auto                     stressNew = ContinuumMechanics::VoigtNotation::stressMatrixFromVoigt< 3 >( stress );
-
-    dStressRotational_dl.setZero();
-    for ( int ij = 0; ij < 6; ij++ ) {
-      auto [i, j] = IndexNotation::fromVoigt< 3 >( ij );
-      for ( int k = 0; k < 3; k++ )
-        for ( int l = 0; l < 3; l++ )
-          for ( int m = 0; m < 3; m++ )
-            dStressRotational_dl( ij, k, l ) += dOmega_dVelocityGradient( i, m, k, l ) * stressNew( m, j ) +
-                                                dOmega_dVelocityGradient( j, m, k, l ) * stressNew( i, m );
-    }
+    compute_dS_dF( dS_dF.data(), stress, FInv, dChauchydEps );
+    return dS_dF;
+  }
 
-    dStressJaumann_dl.setZero();
-    for ( int ij = 0; ij < 6; ij++ )
-      for ( int k = 0; k < 3; k++ )
-        for ( int l = 0; l < 3; l++ )
-          for ( int mn = 0; mn < 6; mn++ )
-            dStressJaumann_dl( ij, k, l ) += dChauchydEps( ij, mn ) * dStretchingRate_dVelocityGradient( mn, k, l );
+  void HughesWinget::compute_dS_dF( double*                 dS_dF_,
+                                    const Marmot::Vector6d& stress,
+                                    const Matrix3d&         FInv,
+                                    const Marmot::Matrix6d& dChauchydEps )
+  {
+    // The 6x3x3 tensors are stored column major, hence they can be viewed as 18x3 matrices with
+    // row index ij + 6 * k and column index l. The final contraction with FInv is then a single fixed size product.
+    using Matrix183d = Matrix< double, 18, 3 >;
 
-    dS_dl = dStressJaumann_dl + dStressRotational_dl;
+    const auto stressNew = ContinuumMechanics::VoigtNotation::stressMatrixFromVoigt< 3 >( stress );
 
-    dS_dF.setZero();
-    for ( int ij = 0; ij < 6; ij++ )
+    // Jaumann part: dChauchydEps( ij, mn ) * dStretchingRate_dVelocityGradient( mn, k, l )
+    Matrix183d dS_dl;
+    for ( int l = 0; l < 3; l++ )
       for ( int k = 0; k < 3; k++ )
-        for ( int l = 0; l < 3; l++ )
-          for ( int m = 0; m < 3; m++ )
-            dS_dF( ij, k, l ) += dS_dl( ij, k, m ) * FInv( l, m );
+        dS_dl.col( l ).segment< 6 >( 6 * k ) = dChauchydEps.col( voigtIndexOf[k][l] );
 
-    return dS_dF;
+    // rotational part: dOmega_dVelocityGradient( i, m, k, l ) = 0.5 * ( delta_ik delta_ml - delta_km delta_il ),
+    // hence only four contributions per (ij, q) remain from the original contraction over m
+    for ( int ij = 0; ij < 6; ij++ ) {
+      const auto [i, j] = tensorIndicesOf[ij];
+      for ( int q = 0; q < 3; q++ ) {
+        dS_dl( ij + 6 * i, q ) += 0.5 * stressNew( q, j );
+        dS_dl( ij + 6 * q, i ) -= 0.5 * stressNew( q, j );
+        dS_dl( ij + 6 * j, q ) += 0.5 * stressNew( i, q );
+        dS_dl( ij + 6 * q, j ) -= 0.5 * stressNew( i, q );
+      }
+    }
+
+    Map< Matrix183d > dS_dF( dS_dF_ );
+    dS_dF.noalias() = dS_dl * FInv.transpose();
   }
 
   Eigen::Matrix3d HughesWinget::compute_dScalar_dF( const Eigen::Matrix3d& FInv, const Marmot::Vector6d& dScalarDEps )
   {
-
-    using namespace Marmot::ContinuumMechanics::Kinematics::VelocityGradient;
-    Matrix3d dScalar_dl = Matrix3d::Zero();
-    for ( int k = 0; k < 3; k++ )
-      for ( int l = 0; l < 3; l++ )
-        for ( int ij = 0; ij < 6; ij++ )
-          dScalar_dl( k, l ) += dScalarDEps( ij ) * dStretchingRate_dVelocityGradient( ij, k, l );
+    Matrix3d dScalar_dl;
+    for ( int l = 0; l < 3; l++ )
+      for ( int k = 0; k < 3; k++ )
+        dScalar_dl( k, l ) = dScalarDEps( voigtIndexOf[k][l] );
 
     return dScalar_dl * FInv;
   }
@@ -15,45 +15,95 @@ namespace Marmot::Materials {
       return retardationTimes;
     }
 
-    void evaluateKelvinChain( double         dT,
-                              Properties     elasticModuli,
-                              Properties     retardationTimes,
-                              StateVarMatrix stateVars,
-                              double&        uniaxialCompliance,
-                              Vector6d&      dStrain,
-                              const double   factor )
+    // the factors are computed per Kelvin unit rather than by computeIncrementFactors, which allocates
+    void evaluateKelvinChain( double                             dT,
+                              const Properties&                  elasticModuli,
+                              const Properties&                  retardationTimes,
+                              const Ref< const StateVarMatrix >& stateVars,
+                              double&                            uniaxialCompliance,
+                              Vector6d&                          dStrain,
+                              const double                       factor )
     {
-
       for ( int i = 0; i < retardationTimes.size(); i++ ) {
-        const double& tau = retardationTimes( i );
-        const double& D   = elasticModuli( i );
+        const double& D = elasticModuli( i );
 
         double lambda, beta;
-        computeLambdaAndBeta( dT, tau, lambda, beta );
+        computeLambdaAndBeta( dT, retardationTimes( i ), lambda, beta );
         uniaxialCompliance += ( 1. - lambda ) / D * factor;
         dStrain += ( 1. - beta ) * stateVars.col( i ) * factor;
       }
     }
 
     void updateStateVarMatrix( double                dT,
-                               Properties            elasticModuli,
-                               Properties            retardationTimes,
+                               const Properties&     elasticModuli,
+                               const Properties&     retardationTimes,
                                Ref< StateVarMatrix > stateVars,
                                const Vector6d&       dStress,
                                const Matrix6d&       unitComplianceMatrix )
     {
-
       if ( dT <= 1e-14 )
         return;
       for ( int i = 0; i < retardationTimes.size(); i++ ) {
-        const double& tau = retardationTimes( i );
-        const double& D   = elasticModuli( i );
-        double        lambda, beta;
-        computeLambdaAndBeta( dT, tau, lambda, beta );
+        const double& D = elasticModuli( i );
+
+        double lambda, beta;
+        computeLambdaAndBeta( dT, retardationTimes( i ), lambda, beta );
         stateVars.col( i ) = ( lambda / D ) * unitComplianceMatrix * dStress + beta * stateVars.col( i );
       }
     }
 
+    IncrementFactors computeIncrementFactors( double dT, const Properties& retardationTimes )
+    {
+      IncrementFactors factors{ dT, Properties( retardationTimes.size() ), Properties( retardationTimes.size() ) };
+
+      for ( int i = 0; i < retardationTimes.size(); i++ )
+        computeLambdaAndBeta( dT, retardationTimes( i ), factors.lambda( i ), factors.beta( i ) );
+
+      return factors;
+    }
+
+    void evaluateKelvinChain( const IncrementFactors&            factors,
+                              const Properties&                  elasticModuli,
+                              const Ref< const StateVarMatrix >& stateVars,
+                              double&                            uniaxialCompliance,
+                              Vector6d&                          dStrain,
+                              const double                       factor )
+    {
+      for ( int i = 0; i < factors.lambda.size(); i++ ) {
+        const double& D = elasticModuli( i );
+
+        uniaxialCompliance += ( 1. - factors.lambda( i ) ) / D * factor;
+        dStrain += ( 1. - factors.beta( i ) ) * stateVars.col( i ) * factor;
+      }
+    }
+
+    void updateStateVarMatrix( const IncrementFactors& factors,
+                               const Properties&       elasticModuli,
+                               Ref< StateVarMatrix >   stateVars,
+                               const Vector6d&         dStress,
+                               const Matrix6d&         unitComplianceMatrix )
+    {
+      updateStateVarMatrix( factors, elasticModuli, stateVars, stateVars, dStress, unitComplianceMatrix );
+    }
+
+    void updateStateVarMatrix( const IncrementFactors&            factors,
+                               const Properties&                  elasticModuli,
+                               const Ref< const StateVarMatrix >& stateVarsOld,
+                               Ref< StateVarMatrix >              stateVars,
+                               const Vector6d&                    dStress,
+                               const Matrix6d&                    unitComplianceMatrix )
+    {
+      if ( factors.dT <= 1e-14 ) {
+        stateVars = stateVarsOld;
+        return;
+      }
+      for ( int i = 0; i < factors.lambda.size(); i++ ) {
+        const double& D    = elasticModuli( i );
+        stateVars.col( i ) = ( factors.lambda( i ) / D ) * unitComplianceMatrix * dStress +
+                             factors.beta( i ) * stateVarsOld.col( i );
+      }
+    }
+
     void computeLambdaAndBeta( double dT, double tau, double& lambda, double& beta )
     {
       const double dT_tau = dT / tau;
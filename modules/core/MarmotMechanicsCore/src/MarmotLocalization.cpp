@@ -1,8 +1,12 @@
 #include "Marmot/MarmotLocalization.h"
 #include "Marmot/MarmotMath.h"
 #include "Marmot/MarmotTensor.h"
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 namespace Marmot {
   namespace ContinuumMechanics::LocalizationAnalysis {
@@ -68,5 +72,226 @@ namespace Marmot {
 
       return detQ;
     }
+
+    namespace {
+
+      using Marmot::Matrix3d;
+      using Marmot::Matrix6d;
+      using Marmot::Matrix9d;
+      using Marmot::Vector3d;
+
+      constexpr int coarseAlphaSteps = 12; // 30 degree
+      constexpr int coarseBetaSteps  = 6;  // 15 degree
+      constexpr int nCoarseNormals   = coarseAlphaSteps * coarseBetaSteps + 1;
+      constexpr int nRefinedNormals  = 3;
+
+      const std::array< Vector3d, nCoarseNormals >& coarseNormals()
+      {
+        static const std::array< Vector3d, nCoarseNormals > normals = [] {
+          std::array< Vector3d, nCoarseNormals > result;
+          int                                    idx = 0;
+          for ( int a = 0; a < coarseAlphaSteps; a++ )
+            for ( int b = 0; b < coarseBetaSteps; b++ )
+              result[idx++] = computeNormalVector( a * 360. / coarseAlphaSteps, b * 90. / coarseBetaSteps );
+          result[idx] = computeNormalVector( 0., 90. );
+          return result;
+        }();
+        return normals;
+      }
+
+      /**
+       * Rearrangement of the material tangent \f$ K_{(jk),(il)} = C_{ijkl} \f$,
+       * such that the acoustic tensor is a single matrix-vector product.
+       */
+      Matrix9d acousticTensorKernel( const Matrix6d& C )
+      {
+        using namespace Marmot::ContinuumMechanics::TensorUtility::IndexNotation;
+        Matrix9d K;
+        for ( int l = 0; l < 3; l++ )
+          for ( int i = 0; i < 3; i++ )
+            for ( int k = 0; k < 3; k++ )
+              for ( int j = 0; j < 3; j++ )
+                K( j + 3 * k, i + 3 * l ) = C( toVoigt< 3 >( i, j ), toVoigt< 3 >( k, l ) );
+        return K;
+      }
+
+      /**
+       * Bilinear form of the acoustic tensor \f$ A_{jk}( a, b ) = a_i\, C_{ijkl}\, b_l \f$,
+       * such that \f$ Q( n ) = A( n, n ) \f$.
+       */
+      Matrix3d bilinearAcousticTensor( const Matrix9d& K, const Vector3d& a, const Vector3d& b )
+      {
+        const Matrix3d ab = a * b.transpose();
+        Matrix3d       A;
+        Marmot::Vector9d::Map( A.data() ) = K * Marmot::Vector9d::Map( ab.data() );
+        return A;
+      }
+
+      /**
+       * Adjugate of a 3x3 matrix, valid also for singular matrices.
+       */
+      Matrix3d adjugate( const Matrix3d& M )
+      {
+        Matrix3d adj;
+        adj( 0, 0 ) = M( 1, 1 ) * M( 2, 2 ) - M( 1, 2 ) * M( 2, 1 );
+        adj( 0, 1 ) = M( 0, 2 ) * M( 2, 1 ) - M( 0, 1 ) * M( 2, 2 );
+        adj( 0, 2 ) = M( 0, 1 ) * M( 1, 2 ) - M( 0, 2 ) * M( 1, 1 );
+        adj( 1, 0 ) = M( 1, 2 ) * M( 2, 0 ) - M( 1, 0 ) * M( 2, 2 );
+        adj( 1, 1 ) = M( 0, 0 ) * M( 2, 2 ) - M( 0, 2 ) * M( 2, 0 );
+        adj( 1, 2 ) = M( 0, 2 ) * M( 1, 0 ) - M( 0, 0 ) * M( 1, 2 );
+        adj( 2, 0 ) = M( 1, 0 ) * M( 2, 1 ) - M( 1, 1 ) * M( 2, 0 );
+        adj( 2, 1 ) = M( 0, 1 ) * M( 2, 0 ) - M( 0, 0 ) * M( 2, 1 );
+        adj( 2, 2 ) = M( 0, 0 ) * M( 1, 1 ) - M( 0, 1 ) * M( 1, 0 );
+        return adj;
+      }
+
+      /**
+       * Second order term of \f$ \det( Q + \varepsilon X ) \f$,
+       * which is \f$ \operatorname{tr}( Q \operatorname{adj}( X ) ) \f$ for 3x3 matrices.
+       */
+      double secondOrderDeterminantTerm( const Matrix3d& Q, const Matrix3d& X )
+      {
+        return ( Q * adjugate( X ) ).trace();
+      }
+
+      /**
+       * Newton method on the unit sphere for \f$ f( n ) = \det Q( n ) \f$.
+       *
+       * The update is computed in the tangent plane at n, spanned by t1 and t2. Since f is homogeneous of degree 6,
+       * \f$ \nabla f \cdot n = 6 f \f$, which yields the curvature correction of the Hessian on the sphere.
+       */
+      Vector3d refineNormalOnSphere( const Matrix9d& K, Vector3d n, double& f )
+      {
+        constexpr int    maxIterations = 15;
+        constexpr int    maxLineSearch = 8;
+        constexpr double tolerance     = 1e-10;
+
+        for ( int iteration = 0; iteration < maxIterations; iteration++ ) {
+          // orthonormal tangents
+          const Vector3d helper = std::abs( n( 0 ) ) < 0.9 ? Vector3d::UnitX() : Vector3d::UnitY();
+          const Vector3d t1     = n.cross( helper ).normalized();
+          const Vector3d t2     = n.cross( t1 );
+
+          const Matrix3d Q    = bilinearAcousticTensor( K, n, n );
+          const Matrix3d adjQ = adjugate( Q );
+
+          const std::array< Matrix3d, 2 > dQ = {
+            bilinearAcousticTensor( K, t1, n ) + bilinearAcousticTensor( K, n, t1 ),
+            bilinearAcousticTensor( K, t2, n ) + bilinearAcousticTensor( K, n, t2 ),
+          };
+
+          const std::array< Matrix3d, 3 > ddQ = {
+            2 * bilinearAcousticTensor( K, t1, t1 ),
+            2 * bilinearAcousticTensor( K, t2, t2 ),
+            bilinearAcousticTensor( K, t1, t2 ) + bilinearAcousticTensor( K, t2, t1 ),
+          };
+
+          Eigen::Vector2d gradient( ( adjQ * dQ[0] ).trace(), ( adjQ * dQ[1] ).trace() );
+
+          // d2f[t,s] = tr( adj(Q) d2Q[t,s] ) + polarized 2 * tr( Q adj( dQ[t] ) )
+          const double h11 = ( adjQ * ddQ[0] ).trace() + 2 * secondOrderDeterminantTerm( Q, dQ[0] );
+          const double h22 = ( adjQ * ddQ[1] ).trace() + 2 * secondOrderDeterminantTerm( Q, dQ[1] );
+          const double h12 = ( adjQ * ddQ[2] ).trace() + secondOrderDeterminantTerm( Q, dQ[0] + dQ[1] ) -
+                             secondOrderDeterminantTerm( Q, dQ[0] ) - secondOrderDeterminantTerm( Q, dQ[1] );
+
+          Eigen::Matrix2d hessian;
+          hessian << h11 - 6 * f, h12, h12, h22 - 6 * f;
+
+          Eigen::Vector2d du;
+          if ( hessian.determinant() > 0 && hessian.trace() > 0 )
+            du = -hessian.inverse() * gradient;
+          else {
+            // fallback: steepest descent with a step scaled to the curvature magnitude
+            const double scale = std::max( hessian.cwiseAbs().maxCoeff(), 1e-300 );
+            du                 = -gradient / scale;
+          }
+
+          // limit the step to avoid jumping over the hemisphere
+          const double stepNorm = du.norm();
+          if ( stepNorm > 0.5 )
+            du *= 0.5 / stepNorm;
+
+          bool accepted = false;
+          for ( int i = 0; i < maxLineSearch; i++ ) {
+            const Vector3d nTrial = ( n + du( 0 ) * t1 + du( 1 ) * t2 ).normalized();
+            const double   fTrial = bilinearAcousticTensor( K, nTrial, nTrial ).determinant();
+            if ( fTrial <= f ) {
+              n        = nTrial;
+              f        = fTrial;
+              accepted = true;
+              break;
+            }
+            du *= 0.5;
+          }
+
+          if ( !accepted || du.norm() < tolerance )
+            break;
+        }
+
+        return n;
+      }
+    } // namespace
+
+    AcousticTensorMinimum adaptiveMinimumDeterminantAcousticTensor( const Marmot::Matrix6d& materialTangent )
+    {
+      const auto&    normals = coarseNormals();
+      const Matrix9d K       = acousticTensorKernel( materialTangent );
+
+      std::array< double, nCoarseNormals > determinants;
+      for ( int i = 0; i < nCoarseNormals; i++ )
+        determinants[i] = bilinearAcousticTensor( K, normals[i], normals[i] ).determinant();
+
+      std::array< int, nCoarseNormals > order;
+      for ( int i = 0; i < nCoarseNormals; i++ )
+        order[i] = i;
+      std::partial_sort( order.begin(),
+                         order.begin() + nRefinedNormals,
+                         order.end(),
+                         [&]( int a, int b ) { return determinants[a] < determinants[b]; } );
+
+      AcousticTensorMinimum result{ determinants[order[0]], normals[order[0]] };
+
+      for ( int i = 0; i < nRefinedNormals; i++ ) {
+        double         detQ = determinants[order[i]];
+        const Vector3d n    = refineNormalOnSphere( K, normals[order[i]], detQ );
+        if ( detQ < result.determinant )
+          result = { detQ, n };
+      }
+
+      return result;
+    }
+
+    void adaptiveMinimumDeterminantAcousticTensors( const double* materialTangents,
+                                                    double*       minimumDeterminants,
+                                                    int           nPoints,
+                                                    int           nThreads )
+    {
+      auto computeRange = [&]( int begin, int end ) {
+        for ( int i = begin; i < end; i++ )
+          minimumDeterminants[i] = adaptiveMinimumDeterminantAcousticTensor(
+                                     Eigen::Map< const Marmot::Matrix6d >( materialTangents + 36 * i ) )
+                                     .determinant;
+      };
+
+      nThreads = std::max( 1, std::min( nThreads, nPoints ) );
+
+      if ( nThreads == 1 ) {
+        computeRange( 0, nPoints );
+        return;
+      }
+
+      std::vector< std::thread > threads;
+      threads.reserve( nThreads - 1 );
+      const int chunkSize = ( nPoints + nThreads - 1 ) / nThreads;
+      for ( int t = 1; t < nThreads; t++ )
+        threads.emplace_back( computeRange,
+                              std::min( t * chunkSize, nPoints ),
+                              std::min( ( t + 1 ) * chunkSize, nPoints ) );
+
+      computeRange( 0, std::min( chunkSize, nPoints ) );
+
+      for ( auto& thread : threads )
+        thread.join();
+    }
   } // namespace ContinuumMechanics::LocalizationAnalysis
 } // namespace Marmot
@@ -46,9 +46,7 @@ void MarmotMaterialHypoElastic::computeStress( double*       stress_,
 
   computeStress( stress.data(), CJaumann.data(), dEps.data(), timeOld, dT, pNewDT );
 
-  TensorMap< Eigen::Tensor< double, 3 > > dS_dF( dStressDDDeformationGradient_, 6, 3, 3 );
-
-  dS_dF = hughesWingetIntegrator.compute_dS_dF( stress, FNew.inverse(), CJaumann );
+  hughesWingetIntegrator.compute_dS_dF( dStressDDDeformationGradient_, stress, FNew.inverse(), CJaumann );
 }
 
 void MarmotMaterialHypoElastic::computePlaneStress( double*       stress2D_,
@@ -64,12 +62,16 @@ void MarmotMaterialHypoElastic::computePlaneStress( double*       stress2D_,
   Map< const Matrix< double, 3, 1 > > dStrain2D( dStrain2D_ );
   Map< Matrix< double, 3, 1 > >       stress2D( stress2D_ );
   Map< Matrix< double, 3, 3 > >       dStress_dStrain2D( dStress_dStrain2D_ );
-  Map< VectorXd >                     stateVars( this->stateVars, this->nStateVars );
 
   Matrix6d dStress_dStrain3D;
 
   Vector6d stress3DTemp;
-  VectorXd stateVarsOld  = stateVars;
+
+  // the state at the begin of the increment, restored in each iteration unless the material computes from its old
+  // state variables
+  std::vector< double > stateVarsBackup;
+  backupStateVars( stateVarsBackup );
+
   Vector6d dStrain3DTemp = Marmot::ContinuumMechanics::VoigtNotation::make3DVoigt< VoigtSize::TwoD >( dStrain2D );
 
   // assumption of isochoric deformation for initial guess
@@ -77,8 +79,9 @@ void MarmotMaterialHypoElastic::computePlaneStress( double*       stress2D_,
 
   int planeStressCount = 1;
   while ( true ) {
+    countEvent( PerformanceCounters::PlaneStressIterations );
     stress3DTemp = Marmot::ContinuumMechanics::VoigtNotation::make3DVoigt< VoigtSize::TwoD >( stress2D );
-    stateVars    = stateVarsOld;
+    restoreStateVarsFromBackup( stateVarsBackup );
 
     computeStress( stress3DTemp.data(), dStress_dStrain3D.data(), dStrain3DTemp.data(), timeOld, dT, pNewDT );
 
@@ -101,6 +104,7 @@ void MarmotMaterialHypoElastic::computePlaneStress( double*       stress2D_,
     planeStressCount += 1;
     if ( planeStressCount > 13 ) {
       pNewDT = 0.25;
+      countEvent( PerformanceCounters::Cutbacks );
       MarmotJournal::warningToMSG( "PlaneStressWrapper requires cutback" );
       return;
     }
@@ -123,18 +127,23 @@ void MarmotMaterialHypoElastic::computeUniaxialStress( double* stress1D_,
 
   Map< const Matrix< double, 1, 1 > > dStrain1D( dStrain1D_ );
   Map< Matrix< double, 1, 1 > >       stress1D( stress1D_ );
-  Map< VectorXd >                     stateVars( this->stateVars, this->nStateVars );
 
   Matrix6d dStress_dStrain3D;
 
   Vector6d stress3DTemp;
-  VectorXd stateVarsOld  = stateVars;
+
+  // the state at the begin of the increment, restored in each iteration unless the material computes from its old
+  // state variables
+  std::vector< double > stateVarsBackup;
+  backupStateVars( stateVarsBackup );
+
   Vector6d dStrain3DTemp = Marmot::ContinuumMechanics::VoigtNotation::make3DVoigt< VoigtSize::OneD >( dStrain1D );
 
   int count = 1;
   while ( true ) {
+    countEvent( PerformanceCounters::UniaxialStressIterations );
     stress3DTemp = Marmot::ContinuumMechanics::VoigtNotation::make3DVoigt< VoigtSize::OneD >( stress1D );
-    stateVars    = stateVarsOld;
+    restoreStateVarsFromBackup( stateVarsBackup );
 
     computeStress( stress3DTemp.data(), dStress_dStrain3D.data(), dStrain3DTemp.data(), timeOld, dT, pNewDT );
 
@@ -154,6 +163,7 @@ void MarmotMaterialHypoElastic::computeUniaxialStress( double* stress1D_,
     count += 1;
     if ( count > 13 ) {
       pNewDT = 0.25;
+      countEvent( PerformanceCounters::Cutbacks );
       MarmotJournal::warningToMSG( "UniaxialStressWrapper requires cutback" );
       return;
     }
@@ -14,13 +14,17 @@ void MarmotMaterialHypoElasticAD::computeStress( double*       stress,
 {
 
   using namespace Marmot;
+  countEvent( PerformanceCounters::ComputeStressCalls );
+  Tracing::ScopedSpan span( "computeStress", "material", materialCode );
+
   mVector6d       S( stress );
   const Vector6d  dEps = Map< const Vector6d >( dStrain );
   Map< VectorXd > stateVars( this->stateVars, this->nStateVars );
 
   // remember old state
-  const VectorXd stateVarsOld = stateVars;
-  const Vector6d SOld         = S;
+  std::vector< double >       stateVarsBackup;
+  const Map< const VectorXd > stateVarsOld( getStateVarsAtBeginOfIncrement( stateVarsBackup ), this->nStateVars );
+  const Vector6d              SOld = S;
 
   mMatrix6d C( dStressDDStrain );
   // ----------------------------------------
@@ -55,12 +55,11 @@ void MarmotMaterialGradientEnhancedHypoElastic::computeStress( double*       str
                  dT,
                  pNewDT );
 
-  TensorMap< Eigen::Tensor< double, 3 > > dS_dF( dStressDDDeformationGradient_, 6, 3, 3 );
-  Map< Matrix3d >                         dKLocal_dF( dK_localDDeformationGradient_ );
+  Map< Matrix3d > dKLocal_dF( dK_localDDeformationGradient_ );
 
   Matrix3d FInv = FNew.inverse();
-  dS_dF         = hughesWingetIntegrator.compute_dS_dF( stress, FInv, CJaumann );
-  dKLocal_dF    = hughesWingetIntegrator.compute_dScalar_dF( FInv, dK_LocalDStretchingRate );
+  hughesWingetIntegrator.compute_dS_dF( dStressDDDeformationGradient_, stress, FInv, CJaumann );
+  dKLocal_dF = hughesWingetIntegrator.compute_dScalar_dF( FInv, dK_LocalDStretchingRate );
 }
 
 void MarmotMaterialGradientEnhancedHypoElastic::computePlaneStress( double*       stress2D_,
@@ -84,14 +83,18 @@ void MarmotMaterialGradientEnhancedHypoElastic::computePlaneStress( double*
   Map< Matrix< double, 3, 3 > >       dStress_dStrain2D( dStress_dStrain2D_ );
   Map< Matrix< double, 3, 1 > >       dStress_dK2D( dStress_dK2D_ );
   Map< Matrix< double, 3, 1 > >       dKLocal_dStrain2D( dKLocal_dStrain2D_ );
-  Map< VectorXd >                     stateVars( this->stateVars, this->nStateVars );
 
   Matrix6d dStress_dStrain3D;
   Vector6d dKLocal_dStrain3D;
   Vector6d dStress_dK3D;
 
   Vector6d stressTemp3D;
-  VectorXd stateVarsOld  = stateVars;
+
+  // the state at the begin of the increment, restored in each iteration unless the material computes from its old
+  // state variables
+  std::vector< double > stateVarsBackup;
+  backupStateVars( stateVarsBackup );
+
   Vector6d dStrain3DTemp = Marmot::ContinuumMechanics::VoigtNotation::make3DVoigt< VoigtSize::TwoD >( dStrain2D );
 
   // assumption of isochoric deformation for initial guess
@@ -99,8 +102,9 @@ void MarmotMaterialGradientEnhancedHypoElastic::computePlaneStress( double*
 
   int planeStressCount = 1;
   while ( true ) {
+    countEvent( PerformanceCounters::PlaneStressIterations );
     stressTemp3D = Marmot::ContinuumMechanics::VoigtNotation::make3DVoigt< VoigtSize::TwoD >( stress2D );
-    stateVars    = stateVarsOld;
+    restoreStateVarsFromBackup( stateVarsBackup );
 
     computeStress( stressTemp3D.data(),
                    KLocal,
@@ -134,6 +138,7 @@ void MarmotMaterialGradientEnhancedHypoElastic::computePlaneStress( double*
     planeStressCount += 1;
     if ( planeStressCount > 10 ) {
       pNewDT = 0.25;
+      countEvent( PerformanceCounters::Cutbacks );
       MarmotJournal::warningToMSG( "PlaneStressWrapper requires cutback" );
       return;
     }
@@ -41,10 +41,13 @@ void MarmotMaterialMechanical::computePlaneStress( double*       stress2D_,
                                                                                  2 );
   Map< const Matrix2d >                          FNew2D( FNew2D_ );
   Map< const Matrix2d >                          FOld2D( FOld2D_ );
-  Map< VectorXd >                                stateVars( this->stateVars, this->nStateVars );
 
   Vector6d stress3DTemp;
-  VectorXd stateVarsOld = stateVars;
+
+  // the state at the begin of the increment, restored in each iteration unless the material computes from its old
+  // state variables
+  std::vector< double > stateVarsBackup;
+  backupStateVars( stateVarsBackup );
 
   Matrix3d FNew3D              = Matrix3d::Identity();
   FNew3D.topLeftCorner( 2, 2 ) = FNew2D;
@@ -59,9 +62,10 @@ void MarmotMaterialMechanical::computePlaneStress( double*       stress2D_,
 
   int planeStressCount = 1;
   while ( true ) {
+    countEvent( PerformanceCounters::PlaneStressIterations );
     stress3DTemp = Marmot::ContinuumMechanics::VoigtNotation::make3DVoigt<
       Marmot::ContinuumMechanics::VoigtNotation::VoigtSize::TwoD >( stress2D );
-    stateVars = stateVarsOld;
+    restoreStateVarsFromBackup( stateVarsBackup );
 
     computeStress( stress3DTemp.data(),
                    dStress_dDeformationGradient3D.data(),
@@ -92,6 +96,7 @@ void MarmotMaterialMechanical::computePlaneStress( double*       stress2D_,
     planeStressCount += 1;
     if ( planeStressCount > 13 ) {
       pNewDT = 0.25;
+      countEvent( PerformanceCounters::Cutbacks );
       MarmotJournal::warningToMSG( "PlaneStressWrapper requires cutback" );
       return;
     }
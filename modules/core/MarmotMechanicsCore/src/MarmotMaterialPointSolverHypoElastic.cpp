@@ -1,5 +1,6 @@
 #include "Marmot/MarmotMaterialPointSolverHypoElastic.h"
 #include "Marmot/Marmot.h"
+#include "Marmot/MarmotTracing.h"
 #include <fstream>
 
 MarmotMaterialPointSolverHypoElastic::MarmotMaterialPointSolverHypoElastic( std::string&         materialName,
@@ -22,7 +23,8 @@ MarmotMaterialPointSolverHypoElastic::MarmotMaterialPointSolverHypoElastic( std:
   _initialStateVars = Eigen::VectorXd::Zero( nStateVars );
   stateVarsTemp     = Eigen::VectorXd::Zero( nStateVars );
 
-  material->assignStateVars( stateVarsTemp.data(), nStateVars );
+  // the material computes stateVarsTemp from stateVars, which is never modified during the iterations
+  material->assignStateVarsDoubleBuffered( stateVarsTemp.data(), stateVars.data(), nStateVars );
 }
 
 void MarmotMaterialPointSolverHypoElastic::addStep( const Step& step )
@@ -81,17 +83,18 @@ void MarmotMaterialPointSolverHypoElastic::solveStep( const Step& step )
     increment.isStressComponentControlled = step.isStressComponentControlled;
 
     // solve increment
-    try {
-      std::cout << "  Solving increment " << counter + 1 << ", time: " << time << " to " << time + dT << ", dT: " << dT
-                << std::endl;
-      solveIncrement( increment );
+    std::cout << "  Solving increment " << counter + 1 << ", time: " << time << " to " << time + dT << ", dT: " << dT
+              << std::endl;
+    const Marmot::Status status = solveIncrement( increment );
+
+    if ( status.isSuccess() ) {
       time += dT;
-      stateVars = stateVarsTemp;
       counter++;
     }
-    catch ( std::runtime_error& e ) {
+    else {
       // if failed, reduce time step and retry
-      std::cout << "    Increment failed: " << e.what() << ", reducing time step to " << dT / 2.0 << std::endl;
+      std::cout << "    Increment failed: " << Marmot::Status::getReasonName( status.reason )
+                << ", reducing time step to " << dT / 2.0 << std::endl;
       if ( dT <= step.dTMin )
         throw std::runtime_error( "Minimum time step reached, cannot proceed." );
       dT = std::max( dT / 2.0, step.dTMin );
@@ -102,8 +105,10 @@ void MarmotMaterialPointSolverHypoElastic::solveStep( const Step& step )
     throw std::runtime_error( "Maximum number of increments reached, cannot proceed." );
 }
 
-void MarmotMaterialPointSolverHypoElastic::solveIncrement( const Increment& increment )
+Marmot::Status MarmotMaterialPointSolverHypoElastic::solveIncrement( const Increment& increment )
 {
+  Marmot::Tracing::ScopedSpan span( "increment", "materialPointSolver" );
+
   // set initial strain increment, set not controlled components to zero
   // use a Eigen Vector multiplication
 
@@ -132,9 +137,6 @@ void MarmotMaterialPointSolverHypoElastic::solveIncrement( const Increment& incr
   while ( counter < options.maxIterations ) {
     std::cout << "    Iteration " << counter;
 
-    // assign state variables to material
-    stateVarsTemp = stateVars;
-
     // set stress to previous converged value
     stressTemp = stress;
 
@@ -142,10 +144,11 @@ void MarmotMaterialPointSolverHypoElastic::solveIncrement( const Increment& incr
     double time[2] = { -1, increment.timeOld + increment.dT };
 
     // compute stress and tangent
+    material->resetStatus();
     material->computeStress( stressTemp.data(), dStressDStrain.data(), dStrain.data(), &time[0], increment.dT, pNewDT );
 
-    if ( pNewDT < 1.0 )
-      throw std::runtime_error( "Material model requested time step reduction." );
+    if ( pNewDT < 1.0 || !material->getStatus().isSuccess() )
+      return Marmot::Status::atQuadraturePoint( material->getStatus(), pNewDT, 0 );
 
     // initialize residual with stress increment
     Marmot::Vector6d residual = computeResidual( stressTemp - stress, target, increment );
@@ -174,16 +177,19 @@ void MarmotMaterialPointSolverHypoElastic::solveIncrement( const Increment& incr
     counter++;
   }
   if ( counter >= options.maxIterations )
-    throw std::runtime_error( "Maximum number of iterations reached, no convergence." );
+    return Marmot::Status::cutback( Marmot::Status::NotConverged, 0.5 );
 
   std::cout << "    Converged after " << counter << " iterations." << std::endl;
 
   stress = stressTemp;
   strain += dStrain;
 
-  // copy back updated state variables
-  stateVars = stateVarsTemp;
+  // accept the updated state variables by swapping the buffers
+  stateVars.swap( stateVarsTemp );
+  material->assignStateVarsDoubleBuffered( stateVarsTemp.data(), stateVars.data(), nStateVars );
   history.push_back( HistoryEntry{ increment.timeOld + increment.dT, stress, strain, dStressDStrain, stateVars } );
+
+  return {};
 }
 
 Marmot::Vector6d MarmotMaterialPointSolverHypoElastic::computeResidual( const Marmot::Vector6d& stressIncrement,
@@ -4,9 +4,15 @@ SET(CURR_TEST_SOURCE_DIR "${CMAKE_CURRENT_LIST_DIR}/test")
 # Tests for HaighWestergaard
 add_marmot_test("TestHaighWestergaard" "${CURR_TEST_SOURCE_DIR}/TestHaighWestergaard.cpp")
 
+# Tests for HughesWinget
+add_marmot_test("TestHughesWinget" "${CURR_TEST_SOURCE_DIR}/TestHughesWinget.cpp")
+
 # Tests for MarmotElasticity
 add_marmot_test("TestMarmotElasticity" "${CURR_TEST_SOURCE_DIR}/TestMarmotElasticity.cpp")
 
+# Tests for MarmotJournal
+add_marmot_test("TestMarmotJournal" "${CURR_TEST_SOURCE_DIR}/TestMarmotJournal.cpp")
+
 # Tests for MarmotKelvinChain
 add_marmot_test("TestMarmotKelvinChain" "${CURR_TEST_SOURCE_DIR}/TestMarmotKelvinChain.cpp")
 
@@ -25,6 +31,9 @@ add_marmot_test("TestMarmotPronySeries" "${CURR_TEST_SOURCE_DIR}/TestMarmotProny
 # Tests for MarmotStateVarVectorManager
 add_marmot_test("TestMarmotStateVarVectorManager" "${CURR_TEST_SOURCE_DIR}/TestMarmotStateVarVectorManager.cpp")
 
+# Tests for MarmotTracing
+add_marmot_test("TestMarmotTracing" "${CURR_TEST_SOURCE_DIR}/TestMarmotTracing.cpp")
+
 # Tests for MarmotViscoelasticity
 add_marmot_test("TestMarmotViscoelasticity" "${CURR_TEST_SOURCE_DIR}/TestMarmotViscoelasticity.cpp")
 
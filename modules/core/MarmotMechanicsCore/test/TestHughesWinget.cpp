@@ -0,0 +1,111 @@
+#include "Marmot/HughesWinget.h"
+#include "Marmot/MarmotKinematics.h"
+#include "Marmot/MarmotTensor.h"
+#include "Marmot/MarmotTesting.h"
+
+using namespace Eigen;
+using namespace Marmot;
+using namespace Marmot::Testing;
+using namespace Marmot::ContinuumMechanics::TensorUtility;
+using namespace Marmot::ContinuumMechanics::Kinematics::VelocityGradient;
+
+EigenTensors::Tensor633d referenceDS_dF( const Vector6d& stress, const Matrix3d& FInv, const Matrix6d& dCauchy_dEps )
+{
+  // full contraction of the projection tensors
+  EigenTensors::Tensor633d dS_dl;
+  EigenTensors::Tensor633d dS_dF;
+  auto stressMatrix = ContinuumMechanics::VoigtNotation::stressMatrixFromVoigt< 3 >( stress );
+
+  dS_dl.setZero();
+  for ( int ij = 0; ij < 6; ij++ ) {
+    auto [i, j] = IndexNotation::fromVoigt< 3 >( ij );
+    for ( int k = 0; k < 3; k++ )
+      for ( int l = 0; l < 3; l++ ) {
+        for ( int m = 0; m < 3; m++ )
+          dS_dl( ij, k, l ) += dOmega_dVelocityGradient( i, m, k, l ) * stressMatrix( m, j ) +
+                               dOmega_dVelocityGradient( j, m, k, l ) * stressMatrix( i, m );
+        for ( int mn = 0; mn < 6; mn++ )
+          dS_dl( ij, k, l ) += dCauchy_dEps( ij, mn ) * dStretchingRate_dVelocityGradient( mn, k, l );
+      }
+  }
+
+  dS_dF.setZero();
+  for ( int ij = 0; ij < 6; ij++ )
+    for ( int k = 0; k < 3; k++ )
+      for ( int l = 0; l < 3; l++ )
+        for ( int m = 0; m < 3; m++ )
+          dS_dF( ij, k, l ) += dS_dl( ij, k, m ) * FInv( l, m );
+
+  return dS_dF;
+}
+
+void testCompute_dS_dF()
+{
+  Matrix3d FOld = Matrix3d::Identity();
+  Matrix3d FNew;
+  FNew << 1.1, 0.2, 0.05, -0.1, 0.95, 0.3, 0.02, -0.15, 1.05;
+
+  Vector6d stress;
+  stress << 10, -5, 3, 2, -1, 4;
+
+  Matrix6d dCauchy_dEps;
+  for ( int i = 0; i < 6; i++ )
+    for ( int j = 0; j < 6; j++ )
+      dCauchy_dEps( i, j ) = 100. * ( i + 1 ) + 7. * ( j + 1 ) + ( i == j ? 1000. : 0. );
+
+  NumericalAlgorithms::HughesWinget hughesWinget( FOld,
+                                                  FNew,
+                                                  NumericalAlgorithms::HughesWinget::Formulation::AbaqusLike );
+
+  const Matrix3d FInv = FNew.inverse();
+
+  const EigenTensors::Tensor633d expected = referenceDS_dF( stress, FInv, dCauchy_dEps );
+
+  EigenTensors::Tensor633d dS_dF = hughesWinget.compute_dS_dF( stress, FInv, dCauchy_dEps );
+  throwExceptionOnFailure( checkIfEqual( dS_dF, expected, 1e-12 ),
+                           MakeString() << __PRETTY_FUNCTION__ << " compute_dS_dF failed" );
+
+  EigenTensors::Tensor633d dS_dFInPlace;
+  hughesWinget.compute_dS_dF( dS_dFInPlace.data(), stress, FInv, dCauchy_dEps );
+  throwExceptionOnFailure( checkIfEqual( dS_dFInPlace, expected, 1e-12 ),
+                           MakeString() << __PRETTY_FUNCTION__ << " in place compute_dS_dF failed" );
+}
+
+void testCompute_dScalar_dF()
+{
+  Matrix3d FOld = Matrix3d::Identity();
+  Matrix3d FNew;
+  FNew << 1.1, 0.2, 0.05, -0.1, 0.95, 0.3, 0.02, -0.15, 1.05;
+
+  Vector6d dScalar_dEps;
+  dScalar_dEps << 1, 2, 3, 4, 5, 6;
+
+  NumericalAlgorithms::HughesWinget hughesWinget( FOld,
+                                                  FNew,
+                                                  NumericalAlgorithms::HughesWinget::Formulation::AbaqusLike );
+
+  const Matrix3d FInv = FNew.inverse();
+
+  Matrix3d dScalar_dl = Matrix3d::Zero();
+  for ( int k = 0; k < 3; k++ )
+    for ( int l = 0; l < 3; l++ )
+      for ( int ij = 0; ij < 6; ij++ )
+        dScalar_dl( k, l ) += dScalar_dEps( ij ) * dStretchingRate_dVelocityGradient( ij, k, l );
+
+  const Matrix3d expected = dScalar_dl * FInv;
+
+  throwExceptionOnFailure( checkIfEqual< double >( hughesWinget.compute_dScalar_dF( FInv, dScalar_dEps ),
+                                                   expected,
+                                                   1e-14 ),
+                           MakeString() << __PRETTY_FUNCTION__ << " compute_dScalar_dF failed" );
+}
+
+int main()
+{
+
+  auto tests = std::vector< std::function< void() > >{ testCompute_dS_dF, testCompute_dScalar_dF };
+
+  executeTestsAndCollectExceptions( tests );
+
+  return 0;
+}
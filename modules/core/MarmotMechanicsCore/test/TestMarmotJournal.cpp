@@ -0,0 +1,107 @@
+#include "Marmot/MarmotJournal.h"
+#include "Marmot/MarmotTesting.h"
+#include <sstream>
+#include <thread>
+
+using namespace Marmot::Testing;
+
+int countOccurrences( const std::string& text, const std::string& pattern )
+{
+  int    count = 0;
+  size_t pos   = text.find( pattern );
+  while ( pos != std::string::npos ) {
+    count += 1;
+    pos = text.find( pattern, pos + pattern.size() );
+  }
+  return count;
+}
+
+void resetJournal()
+{
+  MarmotJournal::setOptions( MarmotJournal::Options() );
+  MarmotJournal::setMSGOutputDirection( std::cout );
+}
+
+void testRateLimitingAcrossThreads()
+{
+  std::stringstream output;
+  MarmotJournal::setMSGOutputDirection( output );
+
+  MarmotJournal::Options options;
+  options.bufferPerThread = true;
+  options.maxRepetitions  = 2;
+  options.flushInterval   = std::chrono::hours( 1 );
+  MarmotJournal::setOptions( options );
+
+  auto writeMessages = []( const char* notification ) {
+    for ( int i = 0; i < 10; i++ )
+      MarmotJournal::warningToMSG( "repeated warning\n" );
+    MarmotJournal::notificationToMSG( notification );
+  };
+  std::thread first( writeMessages, "notification of thread 1\n" );
+  std::thread second( writeMessages, "notification of thread 2\n" );
+  first.join();
+  second.join();
+
+  const bool isWrittenBeforeFlush = !output.str().empty();
+
+  MarmotJournal::flush();
+  const std::string text = output.str();
+  resetJournal();
+
+  throwExceptionOnFailure( !isWrittenBeforeFlush, "buffered messages written before flush" );
+  // two repetitions per thread, and the summary of both threads
+  throwExceptionOnFailure( countOccurrences( text, "repeated warning" ) == 5, "rate limiting failed" );
+  throwExceptionOnFailure( countOccurrences( text, "suppressed 16 repetitions of message: repeated warning\n" ) == 1,
+                           "suppressed repetitions are not aggregated over the threads" );
+  throwExceptionOnFailure( countOccurrences( text, "notification of thread 1\n" ) == 1 &&
+                             countOccurrences( text, "notification of thread 2\n" ) == 1,
+                           "buffers of terminated threads are not flushed" );
+
+  MarmotJournal::flush();
+  throwExceptionOnFailure( output.str() == text, "messages written twice" );
+}
+
+void testTrackedMessagesAreBounded()
+{
+  std::stringstream output;
+  MarmotJournal::setMSGOutputDirection( output );
+
+  MarmotJournal::Options options;
+  options.maxRepetitions     = 1;
+  options.maxTrackedMessages = 4;
+  options.flushInterval      = std::chrono::hours( 1 );
+  MarmotJournal::setOptions( options );
+
+  for ( int i = 0; i < 10; i++ ) {
+    const std::string message = MakeString() << "message " << i << "\n";
+    MarmotJournal::warningToMSG( message );
+    MarmotJournal::warningToMSG( message );
+  }
+
+  // the fifth distinct message starts a new period, which reports the suppressed repetitions of the first period
+  const std::string textBeforeFlush = output.str();
+
+  MarmotJournal::flush();
+  const std::string text = output.str();
+  resetJournal();
+
+  throwExceptionOnFailure( countOccurrences( textBeforeFlush, "suppressed 1 repetitions of message: message 0\n" ) ==
+                             1,
+                           "message counts are not bounded" );
+  throwExceptionOnFailure( countOccurrences( text, "suppressed 1 repetitions of message" ) == 10,
+                           "suppressed repetitions are lost" );
+  throwExceptionOnFailure( countOccurrences( text, "message 9\n" ) == 2, "rate limiting failed" );
+}
+
+int main()
+{
+  auto tests = std::vector< std::function< void() > >{
+    testRateLimitingAcrossThreads,
+    testTrackedMessagesAreBounded,
+  };
+
+  executeTestsAndCollectExceptions( tests );
+
+  return 0;
+}
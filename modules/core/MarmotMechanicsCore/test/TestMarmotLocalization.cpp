@@ -64,6 +64,47 @@ void testMarmotLocalization()
                                          0.0301537,
                                          1e-6 ),
                            "test minimumDeterminantAcousticTensor" );
+
+  // the adaptive search must find the exact localization direction on the shear meridian
+  const auto minimum = adaptiveMinimumDeterminantAcousticTensor( dStress_dStrain );
+
+  throwExceptionOnFailure( minimum.determinant <= minimumDeterminantAcousticTensor( dStress_dStrain ),
+                           "adaptive search should not be worse than the fixed grid search" );
+
+  throwExceptionOnFailure( checkIfEqual( minimum.determinant / computeAcousticTensor( dStress_dStrain, n ).determinant(),
+                                         0.,
+                                         1e-10 ),
+                           "test adaptiveMinimumDeterminantAcousticTensor" );
+
+  throwExceptionOnFailure( checkIfEqual( computeAcousticTensor( dStress_dStrain, minimum.normalVector ).determinant() /
+                                           computeAcousticTensor( dStress_dStrain, n ).determinant(),
+                                         0.,
+                                         1e-10 ),
+                           "test normal vector of adaptiveMinimumDeterminantAcousticTensor" );
+
+  // batched evaluation
+  Marmot::Matrix6d elasticTangent = dStress_dStrain;
+  elasticTangent.setZero();
+  const double G = 210000. / ( 2 * 1.3 ), lambda = 210000. * 0.3 / ( 1.3 * 0.4 );
+  elasticTangent.topLeftCorner( 3, 3 ).setConstant( lambda );
+  elasticTangent.topLeftCorner( 3, 3 ) += 2 * G * Marmot::Matrix3d::Identity();
+  elasticTangent.bottomRightCorner( 3, 3 ) = G * Marmot::Matrix3d::Identity();
+
+  std::vector< double > tangents;
+  for ( int i = 0; i < 7; i++ ) {
+    const Marmot::Matrix6d& C = i % 2 ? dStress_dStrain : elasticTangent;
+    tangents.insert( tangents.end(), C.data(), C.data() + 36 );
+  }
+
+  std::vector< double > minimumDeterminants( 7 );
+  adaptiveMinimumDeterminantAcousticTensors( tangents.data(), minimumDeterminants.data(), 7, 3 );
+
+  for ( int i = 0; i < 7; i++ )
+    throwExceptionOnFailure( checkIfEqual( minimumDeterminants[i],
+                                           adaptiveMinimumDeterminantAcousticTensor(
+                                             Eigen::Map< const Marmot::Matrix6d >( tangents.data() + 36 * i ) )
+                                             .determinant ),
+                             "test adaptiveMinimumDeterminantAcousticTensors" );
 }
 
 int main()
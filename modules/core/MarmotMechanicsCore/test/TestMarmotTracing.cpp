@@ -0,0 +1,129 @@
+#include "Marmot/MarmotTesting.h"
+#include "Marmot/MarmotTracing.h"
+#include <sstream>
+#include <thread>
+
+using namespace Marmot::Testing;
+
+int countOccurrences( const std::string& text, const std::string& pattern )
+{
+  int    count = 0;
+  size_t pos   = text.find( pattern );
+  while ( pos != std::string::npos ) {
+    count += 1;
+    pos = text.find( pattern, pos + pattern.size() );
+  }
+  return count;
+}
+
+void testRingBuffer()
+{
+  using namespace Marmot::Tracing;
+
+  // each thread keeps only its 4 most recent events
+  start( 4 );
+
+  auto recordEvents = []( const char* name ) {
+    for ( int i = 0; i < 10; i++ ) {
+      const long long begin = now();
+      record( name, "test", begin, begin + 1000, i );
+    }
+  };
+  std::thread first( recordEvents, "first" ), second( recordEvents, "second" );
+  first.join();
+  second.join();
+
+  stop();
+
+  std::stringstream trace;
+  writeChromeTrace( trace );
+  const std::string json = trace.str();
+
+  throwExceptionOnFailure( countOccurrences( json, "\"name\":\"first\"" ) == 4, "ring buffer of thread 1 failed" );
+  throwExceptionOnFailure( countOccurrences( json, "\"name\":\"second\"" ) == 4, "ring buffer of thread 2 failed" );
+  throwExceptionOnFailure( countOccurrences( json, "\"code\":9" ) == 2, "most recent events are missing" );
+  throwExceptionOnFailure( countOccurrences( json, "\"code\":5" ) == 0, "overwritten events are written" );
+  throwExceptionOnFailure( json.front() == '{' && json.find( "]}" ) != std::string::npos, "invalid trace JSON" );
+}
+
+void testScopedSpan()
+{
+  using namespace Marmot::Tracing;
+
+  start();
+  {
+    ScopedSpan span( "scoped", "test" );
+  }
+  stop();
+  {
+    ScopedSpan span( "afterStop", "test" );
+  }
+
+  std::stringstream trace;
+  writeChromeTrace( trace );
+  const std::string json = trace.str();
+
+  // spans are only recorded if tracing is enabled at compile time, and only between start() and stop()
+  throwExceptionOnFailure( countOccurrences( json, "\"name\":\"scoped\"" ) == ( enabled ? 1 : 0 ),
+                           "scoped span recorded incorrectly" );
+  throwExceptionOnFailure( countOccurrences( json, "\"name\":\"afterStop\"" ) == 0, "span recorded after stop" );
+}
+
+void testSpanSequenceClosedByStop()
+{
+  using namespace Marmot::Tracing;
+
+  start();
+  SpanSequence sequence;
+  sequence.next( "first", "test" );
+  sequence.next( "open", "test" );
+  stop();
+
+  std::stringstream traceAfterStop;
+  writeChromeTrace( traceAfterStop );
+
+  sequence.close();
+  std::stringstream traceAfterClose;
+  writeChromeTrace( traceAfterClose );
+
+  // the span open at stop() is ended by stop(), and it is not recorded again on closing the sequence
+  throwExceptionOnFailure( countOccurrences( traceAfterStop.str(), "\"name\":\"open\"" ) == ( enabled ? 1 : 0 ),
+                           "open span not ended by stop" );
+  throwExceptionOnFailure( traceAfterClose.str() == traceAfterStop.str(), "span recorded twice" );
+}
+
+void testRecycledThreadBuffers()
+{
+  using namespace Marmot::Tracing;
+
+  registerThread();
+  start();
+
+  // buffers of exited threads without events are reused, the buffer with events is kept for writing
+  for ( int i = 0; i < 3; i++ )
+    std::thread( [] { registerThread(); } ).join();
+  std::thread( [] { record( "recycled", "test", now(), now() ); } ).join();
+
+  stop();
+
+  std::stringstream trace;
+  writeChromeTrace( trace );
+  const std::string json = trace.str();
+
+  throwExceptionOnFailure( countOccurrences( json, "\"name\":\"recycled\"" ) == 1, "events of exited threads lost" );
+  throwExceptionOnFailure( countOccurrences( json, "\"name\":\"thread_name\"" ) == 2, "buffers not recycled" );
+}
+
+int main()
+{
+  auto tests = std::vector< std::function< void() > >{
+    testRingBuffer,
+    testScopedSpan,
+    testSpanSequenceClosedByStop,
+    testRecycledThreadBuffers,
+  };
+
+  executeTestsAndCollectExceptions( tests );
+
+  return 0;
+}
@@ -27,6 +27,7 @@
  */
 #pragma once
 #include "Marmot/Marmot.h"
+#include "Marmot/MarmotConfig.h"
 #include "Marmot/MarmotConstants.h"
 #include "Marmot/MarmotElement.h"
 #include "Marmot/MarmotElementProperty.h"
@@ -36,11 +37,15 @@
 #include "Marmot/MarmotLowerDimensionalStress.h"
 #include "Marmot/MarmotMaterialHypoElastic.h"
 #include "Marmot/MarmotMath.h"
+#include "Marmot/MarmotReferenceElement.h"
 #include "Marmot/MarmotStateVarVectorManager.h"
 #include "Marmot/MarmotTypedefs.h"
 #include "Marmot/MarmotVoigt.h"
+#include "Marmot/NewmarkBetaIntegrator.h"
+#include <algorithm>
 #include <iostream>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 using namespace Marmot;
@@ -48,6 +53,18 @@ using namespace Eigen;
 
 namespace Marmot::Elements {
 
+#ifdef MARMOT_ENABLE_COMPACT_KINEMATICS
+  inline constexpr bool compactKinematicsEnabled = true;
+#else
+  inline constexpr bool compactKinematicsEnabled = false;
+#endif
+
+#ifdef MARMOT_ENABLE_SINGLE_PRECISION_KINEMATICS
+  using CompactKinematicsScalar = float;
+#else
+  using CompactKinematicsScalar = double;
+#endif
+
   /**
    * @class Marmot::Elements::DisplacementFiniteElement
    * @tparam nDim Number of spatial dimensions (1, 2, or 3).
@@ -85,10 +102,33 @@ namespace Marmot::Elements {
     using dNdXiSized            = typename ParentGeometryElement::dNdXiSized;
     using BSized                = typename ParentGeometryElement::BSized;
     using XiSized               = typename ParentGeometryElement::XiSized;
+    using NSized                = typename ParentGeometryElement::NSized;
     using RhsSized              = Matrix< double, sizeLoadVector, 1 >;
     using KeSizedMatrix         = Matrix< double, sizeLoadVector, sizeLoadVector >;
     using CSized                = Matrix< double, ParentGeometryElement::voigtSize, ParentGeometryElement::voigtSize >;
     using Voigt                 = Matrix< double, ParentGeometryElement::voigtSize, 1 >;
+    using CompactdNdXSized      = Matrix< CompactKinematicsScalar, nDim, nNodes >;
+    using ScalarMassMatrix      = Matrix< double, nNodes, nNodes >;
+
+    /**
+     * @brief Lumping scheme of computeLumpedInertia.
+     * - RowSumLumping: row sums of the consistent mass matrix
+     * - HRZLumping: diagonal of the consistent mass matrix, scaled to the total mass (Hinton, Rock, Zienkiewicz
+     *   1976), which avoids negative or zero masses at the corner nodes of quadratic elements
+     */
+    enum LumpingScheme {
+      RowSumLumping,
+      HRZLumping,
+    };
+
+    /**
+     * Large 3D elements (e.g., hexa20, tetra10) store only the shape function derivatives dNdX instead of the
+     * B-operator at the quadrature points if MARMOT_ENABLE_COMPACT_KINEMATICS is defined (CMake option
+     * MARMOT_COMPACT_KINEMATICS), and products with B are evaluated by structured kernels. dNdX is stored in single
+     * precision if MARMOT_ENABLE_SINGLE_PRECISION_KINEMATICS is defined (CMake option
+     * MARMOT_SINGLE_PRECISION_KINEMATICS).
+     */
+    static constexpr bool hasCompactKinematics = compactKinematicsEnabled && nDim == 3 && sizeLoadVector > 24;
 
     /** Element-level properties (e.g., thickness for 2D, area for 1D). */
     Map< const VectorXd > elementProperties;
@@ -96,21 +136,32 @@ namespace Marmot::Elements {
     const int elLabel;
     /** Section assumption applied by this element instance. */
     const SectionType sectionType;
+    /** Quadrature rule with N and dNdXi at the quadrature points, in the order of qps. */
+    const FiniteElement::ReferenceElement::TableView& referenceTable;
+    /** Flag for a constant Jacobian (e.g., straight-sided simplices), determined in initializeYourself. */
+    bool hasAffineGeometry = false;
+    /** Lumping scheme of computeLumpedInertia. */
+    LumpingScheme lumpingScheme = RowSumLumping;
 
     /**
      * @brief Data and state associated with a quadrature point.
      * @details Holds parent coordinates, integration weight, Jacobian determinant,
-     *          kinematic (strain-displacement) B-matrix, and a material instance with
-     *          managed state variables.
+     *          kinematic (strain-displacement) B-matrix or, with compact kinematics, the shape function
+     *          derivatives, and a material instance with managed state variables.
      */
     struct QuadraturePoint {
 
+      struct NoStorage {
+      };
+
       const XiSized xi;
       const double  weight;
 
       double detJ;
       double J0xW;
-      BSized B;
+
+      [[no_unique_address]] std::conditional_t< hasCompactKinematics, NoStorage, BSized >           B;
+      [[no_unique_address]] std::conditional_t< hasCompactKinematics, CompactdNdXSized, NoStorage > dNdX;
 
       /**
        * @brief Manager for per-quadrature-point state variables.
@@ -143,6 +194,9 @@ namespace Marmot::Elements {
 
       std::unique_ptr< QPStateVarManager > managedStateVars;
 
+      /// State variables of the quadrature point at the begin of the increment, if assigned as a pair.
+      const double* stateVarsOld = nullptr;
+
       std::unique_ptr< MarmotMaterialHypoElastic > material;
 
       int getNumberOfRequiredStateVarsQuadraturePointOnly()
@@ -157,13 +211,49 @@ namespace Marmot::Elements {
 
       void assignStateVars( double* stateVars, int nStateVars )
       {
-        managedStateVars = std::make_unique< QPStateVarManager >( stateVars, nStateVars );
+        bindStateVarManager( managedStateVars, stateVars, nStateVars );
+        stateVarsOld = nullptr;
         material->assignStateVars( managedStateVars->materialStateVars.data(),
                                    managedStateVars->materialStateVars.size() );
       }
 
-      QuadraturePoint( XiSized xi, double weight )
-        : xi( xi ), weight( weight ), detJ( 0.0 ), J0xW( 0.0 ), B( BSized::Zero() ){};
+      void assignStateVarsDoubleBuffered( double* stateVars, const double* stateVarsOld_, int nStateVars )
+      {
+        bindStateVarManager( managedStateVars, stateVars, nStateVars );
+        stateVarsOld = stateVarsOld_;
+        material->assignStateVarsDoubleBuffered( managedStateVars->materialStateVars.data(),
+                                                 stateVarsOld + getNumberOfRequiredStateVarsQuadraturePointOnly(),
+                                                 managedStateVars->materialStateVars.size() );
+      }
+
+      /// Swap the working and the old state variables, see MarmotElement::swapStateBuffers.
+      void swapStateBuffers()
+      {
+        if ( !stateVarsOld )
+          throw std::logic_error( MakeString() << __PRETTY_FUNCTION__ << ": no pair of state variables assigned" );
+
+        const double* stateVars  = managedStateVars->data();
+        const int     nStateVars = getNumberOfRequiredStateVarsQuadraturePointOnly() +
+                                   managedStateVars->materialStateVars.size();
+        // the host owns both arrays writable
+        assignStateVarsDoubleBuffered( const_cast< double* >( stateVarsOld ), stateVars, nStateVars );
+      }
+
+      /// Reset stress and strain to the begin of the increment, if a pair of buffers is assigned. The material
+      /// computes its own state variables from the old ones.
+      void restoreStressAndStrain()
+      {
+        if ( stateVarsOld )
+          std::copy_n( stateVarsOld, getNumberOfRequiredStateVarsQuadraturePointOnly(), managedStateVars->data() );
+      }
+
+      QuadraturePoint( XiSized xi, double weight ) : xi( xi ), weight( weight ), detJ( 0.0 ), J0xW( 0.0 )
+      {
+        if constexpr ( hasCompactKinematics )
+          dNdX.setZero();
+        else
+          B.setZero();
+      };
     };
 
     /// Quadrature points owned by the element (one per integration point).
@@ -203,6 +293,17 @@ namespace Marmot::Elements {
     /** @brief Map the provided element state vector to all quadrature points. */
     void assignStateVars( double* stateVars, int nStateVars );
 
+    /**
+     * @brief Map the provided pair of element state vectors to all quadrature points.
+     * @details Stress and strain of the quadrature points are computed from the old state vector like the material
+     * state variables, see MarmotMaterial::assignStateVarsDoubleBuffered. Initial conditions are set in the working
+     * state vector, and the host accepts them like an increment.
+     */
+    void assignStateVarsDoubleBuffered( double* stateVars, const double* stateVarsOld, int nStateVars );
+
+    /** @brief Swap the pair of state vectors of all quadrature points to accept an increment. */
+    void swapStateBuffers();
+
     /** @brief Assign element properties (e.g., thickness in 2D, area in 1D). */
     void assignProperty( const ElementProperties& marmotElementProperty );
 
@@ -212,7 +313,11 @@ namespace Marmot::Elements {
     /** @brief Provide nodal coordinates to the parent geometry element. */
     void assignNodeCoordinates( const double* coordinates );
 
-    /** @brief Precompute geometry-related quantities at quadrature points (B, detJ, J0xW). */
+    /**
+     * @brief Precompute geometry-related quantities at quadrature points (B, detJ, J0xW).
+     * @details For affine geometry, the Jacobian and its inverse are computed only once, and for linear simplices
+     * also the kinematics, which are then copied to all quadrature points.
+     */
     void initializeYourself();
 
     /**
@@ -284,18 +389,87 @@ namespace Marmot::Elements {
                           double        dT,
                           double&       pNewdT );
 
+    /**
+     * @brief Implementation of computeYourself for materials of type MaterialType.
+     * @details For MarmotMaterialHypoElastic, the materials are called through virtual functions. For a concrete
+     * material type, the materials must be of exactly this type, and they are called statically bound, see
+     * DisplacementFiniteElementBoundMaterial.
+     */
+    template < typename MaterialType >
+    void computeYourselfWithMaterial( const double* QTotal,
+                                      const double* dQ,
+                                      double*       Pe,
+                                      double*       Ke,
+                                      const double* time,
+                                      double        dT,
+                                      double&       pNewdT );
+
+    /**
+     * @brief Constitutive update at a quadrature point according to the section assumption.
+     * @details The material is called statically bound if MaterialType is a concrete material type, and through
+     * virtual functions for MarmotMaterialHypoElastic.
+     * @param sectionType Section assumption.
+     * @param material Material of the quadrature point.
+     * @param stress 3D stress state of the quadrature point (updated).
+     * @param S Stress in the reduced Voigt notation of the section.
+     * @param C Algorithmic tangent in the reduced Voigt notation of the section.
+     * @param dE Strain increment in the reduced Voigt notation of the section.
+     * @param time Time data forwarded to the material.
+     * @param dT Time increment.
+     * @param pNewDT Suggested scaling of dT by the material, also reduced if the material signals a cutback by its
+     * status.
+     */
+    template < typename MaterialType >
+    static void computeStressForSection( SectionType   sectionType,
+                                         MaterialType& material,
+                                         mVector6d&    stress,
+                                         Voigt&        S,
+                                         CSized&       C,
+                                         const Voigt&  dE,
+                                         const double* time,
+                                         double        dT,
+                                         double&       pNewDT );
+
+    /**
+     * @brief Scalar mass matrix \f$\mathbf{m} = \sum_{qp} \rho\, \mathbf{N}^\mathsf{T}\mathbf{N}\, J_0 w\f$
+     * (nNodes x nNodes), computed on the first request and cached until initializeYourself or a new material
+     * assignment.
+     */
+    const ScalarMassMatrix& getScalarMassMatrix();
+
     /**
      * @brief Compute consistent mass matrix using material density.
-     * @details \f$\mathbf{M}_e = \sum_{qp} \rho\, \mathbf{N}^\mathsf{T}\mathbf{N}\, J_0 w\f$.
+     * @details \f$\mathbf{M}_e = \sum_{qp} \rho\, \mathbf{N}^\mathsf{T}\mathbf{N}\, J_0 w\f$, expanded from the
+     * scalar mass matrix by the dimension.
      */
     void computeConsistentInertia( double* M );
 
     /**
-     * @brief Compute lumped mass vector via row-sum of consistent mass.
-     * @details \f$\mathbf{m}_e = \mathrm{rowsum}(\mathbf{M}_e)\f$.
+     * @brief Compute lumped mass vector directly from the scalar mass matrix, see lumpingScheme.
+     * @details \f$\mathbf{m}_e = \mathrm{rowsum}(\mathbf{M}_e)\f$ or \f$\mathbf{m}_e =
+     * \mathrm{diag}(\mathbf{M}_e)\, \mathrm{sum}(\mathbf{M}_e) / \mathrm{tr}(\mathbf{M}_e)\f$.
      */
     void computeLumpedInertia( double* M );
 
+    /**
+     * @brief Compute the effective residual and tangent of an implicit dynamic step in a single pass over the
+     * quadrature points.
+     * @details Velocities and accelerations at the end of the increment follow from
+     * TimeIntegration::newmarkBetaIntegration. The inertia and mass proportional damping contributions are added
+     * directly from the cached scalar mass matrix, without forming the dense mass matrix.
+     * @see MarmotElement::NewmarkParameters
+     */
+    void computeYourselfDynamic( const double*            QTotal,
+                                 const double*            dQ,
+                                 const double*            V,
+                                 const double*            A,
+                                 double*                  Pe,
+                                 double*                  Ke,
+                                 const double*            time,
+                                 double                   dT,
+                                 double&                  pNewdT,
+                                 const NewmarkParameters& parameters );
+
     /**
      * @brief Access a named state view at a quadrature point.
      * @note Using "sdv" returns the raw material state vector and is deprecated.
@@ -327,6 +501,23 @@ namespace Marmot::Elements {
 
     /** @brief Number of quadrature points of this element. */
     int getNumberOfQuadraturePoints();
+
+    /**
+     * @brief Resolve a state by its offset within the state variables of the first quadrature point.
+     * @details States outside of the state variables of the quadrature points (e.g., of derived elements) are
+     * gathered through getStateView.
+     */
+    StateFieldAccessor resolveStateField( const std::string& stateName );
+
+    /** @brief Gather a state at all quadrature points by its offset, without lookups by name. */
+    void gatherStateField( const StateFieldAccessor& accessor, double* values );
+
+    /** @brief Gather the physical coordinates of all quadrature points. */
+    void gatherCoordinatesAtQuadraturePoints( double* coordinates );
+
+  private:
+    ScalarMassMatrix scalarMassMatrix;
+    bool             hasScalarMassMatrix = false;
   };
 
   template < int nDim, int nNodes >
@@ -337,7 +528,8 @@ namespace Marmot::Elements {
     : ParentGeometryElement(),
       elementProperties( Map< const VectorXd >( nullptr, 0 ) ),
       elLabel( elementID ),
-      sectionType( sectionType )
+      sectionType( sectionType ),
+      referenceTable( FiniteElement::ReferenceElement::getTable< nDim, nNodes >( integrationType ) )
   {
     for ( const auto& qpInfo : FiniteElement::Quadrature::getGaussPointInfo( this->shape, integrationType ) ) {
       QuadraturePoint qp( qpInfo.xi, qpInfo.weight );
@@ -389,6 +581,26 @@ namespace Marmot::Elements {
     }
   }
 
+  template < int nDim, int nNodes >
+  void DisplacementFiniteElement< nDim, nNodes >::assignStateVarsDoubleBuffered( double*       stateVars,
+                                                                                 const double* stateVarsOld,
+                                                                                 int           nStateVars )
+  {
+    const int nQpStateVars = nStateVars / qps.size();
+
+    for ( size_t i = 0; i < qps.size(); i++ )
+      qps[i].assignStateVarsDoubleBuffered( stateVars + i * nQpStateVars,
+                                            stateVarsOld + i * nQpStateVars,
+                                            nQpStateVars );
+  }
+
+  template < int nDim, int nNodes >
+  void DisplacementFiniteElement< nDim, nNodes >::swapStateBuffers()
+  {
+    for ( auto& qp : qps )
+      qp.swapStateBuffers();
+  }
+
   template < int nDim, int nNodes >
   void DisplacementFiniteElement< nDim, nNodes >::assignProperty( const ElementProperties& elementPropertiesInfo )
   {
@@ -401,10 +613,7 @@ namespace Marmot::Elements {
   {
     for ( auto& qp : qps ) {
       qp.material = std::unique_ptr< MarmotMaterialHypoElastic >( dynamic_cast< MarmotMaterialHypoElastic* >(
-        MarmotLibrary::MarmotMaterialFactory::createMaterial( section.materialCode,
-                                                              section.materialProperties,
-                                                              section.nMaterialProperties,
-                                                              elLabel ) ) );
+        MarmotLibrary::MarmotMaterialFactory::createMaterial( section, elLabel ) ) );
 
       if ( !qp.material )
         throw std::invalid_argument( MakeString()
@@ -418,6 +627,8 @@ namespace Marmot::Elements {
       if constexpr ( nDim == 1 )
         qp.material->setCharacteristicElementLength( 2 * qp.detJ );
     }
+
+    hasScalarMassMatrix = false;
   }
 
   template < int nDim, int nNodes >
@@ -429,13 +640,37 @@ namespace Marmot::Elements {
   template < int nDim, int nNodes >
   void DisplacementFiniteElement< nDim, nNodes >::initializeYourself()
   {
-    for ( QuadraturePoint& qp : qps ) {
-      const dNdXiSized    dNdXi = this->dNdXi( qp.xi );
-      const JacobianSized J     = this->Jacobian( dNdXi );
-      const JacobianSized JInv  = J.inverse();
-      const dNdXiSized    dNdX  = this->dNdX( dNdXi, JInv );
-      qp.detJ                   = J.determinant();
-      qp.B                      = this->B( dNdX );
+    const JacobianSized J0    = this->Jacobian( Map< const dNdXiSized >( referenceTable.getdNdXi( 0 ) ) );
+    const JacobianSized J0Inv = J0.inverse();
+    hasAffineGeometry         = FiniteElement::ReferenceElement::isAffine< nDim, nNodes >( referenceTable,
+                                                                                           this->coordinates.data(),
+                                                                                           J0 );
+
+    // shape function derivatives of linear simplices are constant as well
+    const bool hasConstantKinematics = hasAffineGeometry && nNodes == nDim + 1;
+
+    for ( size_t i = 0; i < qps.size(); i++ ) {
+      QuadraturePoint& qp = qps[i];
+
+      if ( hasConstantKinematics && i > 0 ) {
+        qp.detJ = qps[0].detJ;
+        if constexpr ( hasCompactKinematics )
+          qp.dNdX = qps[0].dNdX;
+        else
+          qp.B = qps[0].B;
+      }
+      else {
+        const Map< const dNdXiSized > dNdXi( referenceTable.getdNdXi( i ) );
+        const JacobianSized           J    = hasAffineGeometry ? J0 : this->Jacobian( dNdXi );
+        const JacobianSized           JInv = hasAffineGeometry ? J0Inv : J.inverse();
+        const dNdXiSized              dNdX = this->dNdX( dNdXi, JInv );
+        qp.detJ                            = J.determinant();
+
+        if constexpr ( hasCompactKinematics )
+          qp.dNdX = dNdX.template cast< CompactKinematicsScalar >();
+        else
+          qp.B = this->B( dNdX );
+      }
 
       if constexpr ( nDim == 3 ) {
         qp.J0xW = qp.weight * qp.detJ;
@@ -449,6 +684,8 @@ namespace Marmot::Elements {
         qp.J0xW                    = qp.weight * qp.detJ * crossSection;
       }
     }
+
+    hasScalarMassMatrix = false;
   }
 
   template < int nDim, int nNodes >
@@ -459,10 +696,26 @@ namespace Marmot::Elements {
                                                                    const double* time,
                                                                    double        dT,
                                                                    double&       pNewDT )
+  {
+    computeYourselfWithMaterial< MarmotMaterialHypoElastic >( QTotal_, dQ_, Pe_, Ke_, time, dT, pNewDT );
+  }
+
+  template < int nDim, int nNodes >
+  template < typename MaterialType >
+  void DisplacementFiniteElement< nDim, nNodes >::computeYourselfWithMaterial( const double* QTotal_,
+                                                                               const double* dQ_,
+                                                                               double*       Pe_,
+                                                                               double*       Ke_,
+                                                                               const double* time,
+                                                                               double        dT,
+                                                                               double&       pNewDT )
   {
     using namespace Marmot;
     using namespace ContinuumMechanics::VoigtNotation;
 
+    countEvent( PerformanceCounters::ComputeYourselfCalls );
+    Tracing::ScopedSpan span( "computeYourself", "element", elementCode );
+
     Map< const RhsSized > QTotal( QTotal_ );
     Map< const RhsSized > dQ( dQ_ );
     Map< KeSizedMatrix >  Ke( Ke_ );
@@ -471,58 +724,113 @@ namespace Marmot::Elements {
     Voigt  S, dE;
     CSized C;
 
-    for ( QuadraturePoint& qp : qps ) {
+    status = {};
 
-      const BSized& B = qp.B;
-      dE              = B * dQ;
+    for ( size_t i = 0; i < qps.size(); i++ ) {
+      QuadraturePoint& qp = qps[i];
 
-      if constexpr ( nDim == 1 ) {
+      if constexpr ( hasCompactKinematics )
+        dE = FiniteElement::Spatial3D::BTimes< nNodes >( qp.dNdX, dQ );
+      else
+        dE = qp.B * dQ;
+
+      MaterialType& material = static_cast< MaterialType& >( *qp.material );
+      qp.restoreStressAndStrain();
+      computeStressForSection( sectionType, material, qp.managedStateVars->stress, S, C, dE, time, dT, pNewDT );
+
+      qp.managedStateVars->strain += make3DVoigt< ParentGeometryElement::voigtSize >( dE );
 
-        S = reduce3DVoigt< ParentGeometryElement::voigtSize >( qp.managedStateVars->stress );
-        qp.material->computeUniaxialStress( S.data(), C.data(), dE.data(), time, dT, pNewDT );
-        qp.managedStateVars->stress = make3DVoigt< ParentGeometryElement::voigtSize >( S );
+      if ( pNewDT < 1.0 ) {
+        requestCutback( Status::atQuadraturePoint( qp.material->getStatus(), pNewDT, i ) );
+        return;
       }
 
-      else if constexpr ( nDim == 2 ) {
+      if constexpr ( hasCompactKinematics ) {
+        FiniteElement::Spatial3D::addBTransposeCB< nNodes >( Ke, qp.dNdX, C, qp.J0xW );
+        FiniteElement::Spatial3D::addBTransposeTimes< nNodes >( Pe, qp.dNdX, S, -qp.J0xW );
+      }
+      else {
+        Ke += qp.B.transpose() * C * qp.B * qp.J0xW;
+        Pe -= qp.B.transpose() * S * qp.J0xW;
+      }
+    }
+  }
 
-        if ( sectionType == SectionType::PlaneStress ) {
+  template < int nDim, int nNodes >
+  template < typename MaterialType >
+  void DisplacementFiniteElement< nDim, nNodes >::computeStressForSection( SectionType   sectionType,
+                                                                           MaterialType& material,
+                                                                           mVector6d&    stress,
+                                                                           Voigt&        S,
+                                                                           CSized&       C,
+                                                                           const Voigt&  dE,
+                                                                           const double* time,
+                                                                           double        dT,
+                                                                           double&       pNewDT )
+  {
+    using namespace Marmot;
+    using namespace ContinuumMechanics::VoigtNotation;
 
-          S = reduce3DVoigt< ParentGeometryElement::voigtSize >( qp.managedStateVars->stress );
-          qp.material->computePlaneStress( S.data(), C.data(), dE.data(), time, dT, pNewDT );
-          qp.managedStateVars->stress = make3DVoigt< ParentGeometryElement::voigtSize >( S );
-        }
+    // a qualified call is bound statically, and can be inlined for a concrete material type
+    constexpr bool isBound = !std::is_same_v< MaterialType, MarmotMaterialHypoElastic >;
 
-        else if ( sectionType == SectionType::PlaneStrain ) {
+    auto computeStress = [&]( double* S_, double* C_, const double* dE_ ) {
+      if constexpr ( isBound )
+        material.MaterialType::computeStress( S_, C_, dE_, time, dT, pNewDT );
+      else
+        material.computeStress( S_, C_, dE_, time, dT, pNewDT );
+    };
 
-          Vector6d dE6 = planeVoigtToVoigt( dE );
-          Matrix6d C66;
+    material.resetStatus();
 
-          Vector6d S6 = qp.managedStateVars->stress;
-          qp.material->computeStress( S6.data(), C66.data(), dE6.data(), time, dT, pNewDT );
-          qp.managedStateVars->stress = S6;
+    if constexpr ( nDim == 1 ) {
 
-          S = reduce3DVoigt< ParentGeometryElement::voigtSize >( S6 );
-          C = ContinuumMechanics::PlaneStrain::getPlaneStrainTangent( C66 );
-        }
-      }
+      S = reduce3DVoigt< ParentGeometryElement::voigtSize >( stress );
+      if constexpr ( isBound )
+        material.MaterialType::computeUniaxialStress( S.data(), C.data(), dE.data(), time, dT, pNewDT );
+      else
+        material.computeUniaxialStress( S.data(), C.data(), dE.data(), time, dT, pNewDT );
+      stress = make3DVoigt< ParentGeometryElement::voigtSize >( S );
+    }
 
-      else if constexpr ( nDim == 3 ) {
-        if ( sectionType == SectionType::Solid ) {
+    else if constexpr ( nDim == 2 ) {
 
-          S = qp.managedStateVars->stress;
-          qp.material->computeStress( S.data(), C.data(), dE.data(), time, dT, pNewDT );
-          qp.managedStateVars->stress = S;
-        }
+      if ( sectionType == SectionType::PlaneStress ) {
+
+        S = reduce3DVoigt< ParentGeometryElement::voigtSize >( stress );
+        if constexpr ( isBound )
+          material.MaterialType::computePlaneStress( S.data(), C.data(), dE.data(), time, dT, pNewDT );
+        else
+          material.computePlaneStress( S.data(), C.data(), dE.data(), time, dT, pNewDT );
+        stress = make3DVoigt< ParentGeometryElement::voigtSize >( S );
       }
 
-      qp.managedStateVars->strain += make3DVoigt< ParentGeometryElement::voigtSize >( dE );
+      else if ( sectionType == SectionType::PlaneStrain ) {
 
-      if ( pNewDT < 1.0 )
-        return;
+        Vector6d dE6 = planeVoigtToVoigt( dE );
+        Matrix6d C66;
+
+        Vector6d S6 = stress;
+        computeStress( S6.data(), C66.data(), dE6.data() );
+        stress = S6;
+
+        S = reduce3DVoigt< ParentGeometryElement::voigtSize >( S6 );
+        C = ContinuumMechanics::PlaneStrain::getPlaneStrainTangent( C66 );
+      }
+    }
+
+    else if constexpr ( nDim == 3 ) {
+      if ( sectionType == SectionType::Solid ) {
 
-      Ke += B.transpose() * C * B * qp.J0xW;
-      Pe -= B.transpose() * S * qp.J0xW;
+        S = stress;
+        computeStress( S.data(), C.data(), dE.data() );
+        stress = S;
+      }
     }
+
+    // a material may signal a cutback only by its status
+    if ( !material.getStatus().isSuccess() )
+      pNewDT = std::min( pNewDT, material.getStatus().suggestedDTFactor );
   }
 
   template < int nDim, int nNodes >
@@ -617,33 +925,124 @@ namespace Marmot::Elements {
     Map< RhsSized >                              Pe( P_ );
     const Map< const Matrix< double, nDim, 1 > > f( load );
 
-    for ( const auto& qp : qps )
-      Pe += this->NB( this->N( qp.xi ) ).transpose() * f * qp.J0xW;
+    for ( size_t i = 0; i < qps.size(); i++ )
+      Pe += this->NB( Map< const NSized >( referenceTable.getN( i ) ) ).transpose() * f * qps[i].J0xW;
+  }
+
+  template < int nDim, int nNodes >
+  const typename DisplacementFiniteElement< nDim, nNodes >::ScalarMassMatrix& DisplacementFiniteElement<
+    nDim,
+    nNodes >::getScalarMassMatrix()
+  {
+    if ( !hasScalarMassMatrix ) {
+      scalarMassMatrix.setZero();
+
+      for ( size_t i = 0; i < qps.size(); i++ ) {
+        const auto&                                     qp = qps[i];
+        const Map< const Matrix< double, nNodes, 1 > > N( referenceTable.getN( i ) );
+        scalarMassMatrix += N * N.transpose() * ( qp.detJ * qp.weight * qp.material->getDensity() );
+      }
+
+      hasScalarMassMatrix = true;
+    }
+
+    return scalarMassMatrix;
   }
 
   template < int nDim, int nNodes >
   void DisplacementFiniteElement< nDim, nNodes >::computeConsistentInertia( double* M )
   {
+    const ScalarMassMatrix& m = getScalarMassMatrix();
+
     Map< KeSizedMatrix > Me( M );
     Me.setZero();
 
-    for ( const auto& qp : qps ) {
-      const auto   N_  = this->NB( this->N( qp.xi ) );
-      const double rho = qp.material->getDensity();
-      Me += N_.transpose() * N_ * qp.detJ * qp.weight * rho;
-    }
+    for ( int b = 0; b < nNodes; b++ )
+      for ( int a = 0; a < nNodes; a++ )
+        Me.template block< nDim, nDim >( a * nDim, b * nDim ).diagonal().setConstant( m( a, b ) );
   }
   template < int nDim, int nNodes >
   void DisplacementFiniteElement< nDim, nNodes >::computeLumpedInertia( double* M )
   {
+    const ScalarMassMatrix& m = getScalarMassMatrix();
+
+    Matrix< double, nNodes, 1 > nodalMasses;
+    if ( lumpingScheme == HRZLumping )
+      // without density (e.g., quasi-static sections), the scaling is undefined and all masses vanish
+      nodalMasses = m.trace() != 0.0 ? ( m.diagonal() * ( m.sum() / m.trace() ) ).eval()
+                                     : Matrix< double, nNodes, 1 >::Zero().eval();
+    else
+      nodalMasses = m.rowwise().sum();
+
     Map< RhsSized > Me( M );
-    Me.setZero();
+    for ( int a = 0; a < nNodes; a++ )
+      Me.template segment< nDim >( a * nDim ).setConstant( nodalMasses( a ) );
+  }
 
-    KeSizedMatrix CMM;
-    CMM.setZero();
-    computeConsistentInertia( CMM.data() );
+  template < int nDim, int nNodes >
+  void DisplacementFiniteElement< nDim, nNodes >::computeYourselfDynamic( const double*            QTotal,
+                                                                          const double*            dQ,
+                                                                          const double*            V,
+                                                                          const double*            A,
+                                                                          double*                  Pe_,
+                                                                          double*                  Ke_,
+                                                                          const double*            time,
+                                                                          double                   dT,
+                                                                          double&                  pNewDT,
+                                                                          const NewmarkParameters& parameters )
+  {
+    Map< KeSizedMatrix > Ke( Ke_ );
+    Map< RhsSized >      Pe( Pe_ );
+
+    const double weightF = 1.0 - parameters.alphaF;
+    const double weightM = 1.0 - parameters.alphaM;
+
+    // velocities and accelerations at the end of the increment
+    RhsSized vNew = Map< const RhsSized >( V );
+    RhsSized aNew = Map< const RhsSized >( A );
+    double   c0;
+    for ( int i = 0; i < sizeLoadVector; i++ )
+      TimeIntegration::newmarkBetaIntegration< 1 >( &dQ[i],
+                                                    &vNew( i ),
+                                                    &aNew( i ),
+                                                    dT,
+                                                    parameters.beta,
+                                                    parameters.gamma,
+                                                    &c0 );
+    const double c1 = parameters.beta != 0 ? parameters.gamma / ( parameters.beta * std::max( dT, 1e-16 ) ) : 0.0;
+
+    // the static part is accumulated in place, unless it must be weighted or is needed for the damping forces
+    if ( weightF == 1.0 && parameters.rayleighStiffness == 0.0 )
+      computeYourself( QTotal, dQ, Pe_, Ke_, time, dT, pNewDT );
+    else {
+      KeSizedMatrix K = KeSizedMatrix::Zero();
+      RhsSized      P = RhsSized::Zero();
+      computeYourself( QTotal, dQ, P.data(), K.data(), time, dT, pNewDT );
+      if ( pNewDT < 1.0 )
+        return;
+
+      Ke += weightF * ( 1.0 + c1 * parameters.rayleighStiffness ) * K;
+      Pe += weightF * ( P - parameters.rayleighStiffness * ( K * vNew ) );
+    }
+
+    if ( pNewDT < 1.0 )
+      return;
+
+    // inertia and mass proportional damping, using the scalar mass matrix for all directions
+    const ScalarMassMatrix& m  = getScalarMassMatrix();
+    const double            cM = weightM * c0 + weightF * c1 * parameters.rayleighMass;
 
-    Me = CMM.rowwise().sum();
+    using NodalField = Matrix< double, nDim, nNodes >;
+
+    const NodalField inertia = weightM * Map< const NodalField >( aNew.data() ) +
+                               parameters.alphaM * Map< const NodalField >( A ) +
+                               weightF * parameters.rayleighMass * Map< const NodalField >( vNew.data() );
+
+    Map< NodalField >( Pe_ ) -= inertia * m;
+
+    for ( int b = 0; b < nNodes; b++ )
+      for ( int a = 0; a < nNodes; a++ )
+        Ke.template block< nDim, nDim >( a * nDim, b * nDim ).diagonal().array() += cM * m( a, b );
   }
 
   template < int nDim, int nNodes >
@@ -678,4 +1077,41 @@ namespace Marmot::Elements {
   {
     return qps.size();
   }
+
+  template < int nDim, int nNodes >
+  MarmotElement::StateFieldAccessor DisplacementFiniteElement< nDim, nNodes >::resolveStateField(
+    const std::string& stateName )
+  {
+    const StateView view   = this->getStateView( stateName, 0 );
+    const auto      offset = view.stateLocation - qps[0].managedStateVars->data();
+
+    if ( offset < 0 || offset + view.stateSize > qps[0].getNumberOfRequiredStateVars() )
+      return { stateName, -1, view.stateSize };
+
+    return { stateName, static_cast< int >( offset ), view.stateSize };
+  }
+
+  template < int nDim, int nNodes >
+  void DisplacementFiniteElement< nDim, nNodes >::gatherStateField( const StateFieldAccessor& accessor,
+                                                                    double*                   values )
+  {
+    if ( accessor.offset < 0 ) {
+      MarmotElement::gatherStateField( accessor, values );
+      return;
+    }
+
+    for ( const auto& qp : qps )
+      values = std::copy_n( qp.managedStateVars->data() + accessor.offset, accessor.size, values );
+  }
+
+  template < int nDim, int nNodes >
+  void DisplacementFiniteElement< nDim, nNodes >::gatherCoordinatesAtQuadraturePoints( double* coordinates )
+  {
+    const Map< const Matrix< double, nDim, nNodes > > nodeCoordinates( this->coordinates.data() );
+
+    for ( size_t i = 0; i < qps.size(); i++ ) {
+      const Map< const NSized > N( referenceTable.getN( i ) );
+      Map< XiSized >( coordinates + i * nDim ) = nodeCoordinates * N.transpose();
+    }
+  }
 } // namespace Marmot::Elements
@@ -0,0 +1,705 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ * Magdalena Schreter magdalena.schreter@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+#pragma once
+#include "Marmot/DisplacementFiniteElement.h"
+#include "Marmot/MarmotElementBlock.h"
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace Marmot::Elements {
+
+  /**
+   * @class Marmot::Elements::ElementBlock< DisplacementFiniteElement< nDim, nNodes > >
+   * @brief Block of small strain displacement elements with contiguous quadrature point data.
+   * @details Node coordinates, Jacobian determinants, integration weights \f$J_0 w\f$ and shape function derivatives
+   * \f$\frac{\partial N}{\partial \boldsymbol{x}}\f$ of all elements are stored in one array per quantity, indexed by
+   * element and quadrature point; the B-operator is assembled on the fly from the derivatives. The state variables of
+   * all elements are provided as one contiguous array with the same per-element layout as for
+   * DisplacementFiniteElement, so that both can be used interchangeably by the host. Like for the elements, a pair of
+   * state variable arrays can be assigned instead, see assignStateVarsDoubleBuffered.
+   *
+   * All elements share the quadrature rule, the section assumption, the element properties and the material section.
+   * The element vectors (QTotal, dQ, Pe) and matrices (Ke) of all elements are passed as contiguous arrays, element by
+   * element.
+   */
+  template < int nDim, int nNodes >
+  class ElementBlock< DisplacementFiniteElement< nDim, nNodes > > {
+
+  public:
+    using Element               = DisplacementFiniteElement< nDim, nNodes >;
+    using SectionType           = typename Element::SectionType;
+    using ParentGeometryElement = typename Element::ParentGeometryElement;
+    using XiSized               = typename Element::XiSized;
+    using JacobianSized         = typename Element::JacobianSized;
+    using dNdXiSized            = typename Element::dNdXiSized;
+    using BSized                = typename Element::BSized;
+    using RhsSized              = typename Element::RhsSized;
+    using KeSizedMatrix         = typename Element::KeSizedMatrix;
+    using CSized                = typename Element::CSized;
+    using Voigt                 = typename Element::Voigt;
+    using QPStateVarManager     = typename Element::QuadraturePoint::QPStateVarManager;
+
+    static constexpr int sizeLoadVector = Element::sizeLoadVector;
+    static constexpr int nCoordinates   = Element::nCoordinates;
+    static constexpr int nVoigt         = static_cast< int >( ParentGeometryElement::voigtSize );
+
+    /** Number of elements computed simultaneously by computeBatch, one element per SIMD lane. */
+    static constexpr int batchSize = 4;
+    /** Batches are used for small elements only (e.g., quad4, tetra4, hexa8), as their lane arrays live on the
+     * stack. */
+    static constexpr bool isBatched = sizeLoadVector <= 24;
+
+    /** Element labels (IDs) used for logging and material creation. */
+    const std::vector< int > elementLabels;
+    /** Section assumption applied to all elements. */
+    const SectionType sectionType;
+
+    /**
+     * @brief Construct a block of elements with a common quadrature rule and section assumption.
+     * @param elementLabels Unique labels of the elements in the block.
+     * @param integrationType Integration (quadrature) rule.
+     * @param sectionType Section assumption (1D/2D/3D).
+     */
+    ElementBlock( const std::vector< int >&                   elementLabels,
+                  FiniteElement::Quadrature::IntegrationTypes integrationType,
+                  SectionType                                 sectionType );
+
+    /** @brief Number of elements in the block. */
+    int getNumberOfElements() const { return nElements; }
+
+    /** @brief Number of quadrature points per element. */
+    int getNumberOfQuadraturePoints() const { return nQuadraturePoints; }
+
+    /** @brief Number of required state variables per element. */
+    int getNumberOfRequiredStateVars() const { return nQuadraturePoints * nStateVarsPerQuadraturePoint; }
+
+    /** @brief Copy the node coordinates of all elements, element by element. */
+    void assignNodeCoordinates( const double* coordinates );
+
+    /** @brief Assign the element properties common to all elements (e.g., thickness in 2D, area in 1D). */
+    void assignProperty( const ElementProperties& elementProperties );
+
+    /** @brief Assign the material section and instantiate the materials of all quadrature points. */
+    void assignProperty( const MarmotMaterialSection& section );
+
+    /**
+     * @brief Map the state variables of all elements.
+     * @param stateVars Contiguous state variables of all elements, element by element.
+     * @param nStateVarsPerElement Number of state variables per element, see getNumberOfRequiredStateVars().
+     */
+    void assignStateVars( double* stateVars, int nStateVarsPerElement );
+
+    /**
+     * @brief Map a pair of state variable arrays of all elements: the working state and the state at the begin of the
+     * increment.
+     * @details Stress, strain and the material state variables are computed from the old state, which is never
+     * modified, see DisplacementFiniteElement::assignStateVarsDoubleBuffered.
+     * @param stateVars Contiguous working state variables of all elements, element by element.
+     * @param stateVarsOld Contiguous state variables of all elements at the begin of the increment.
+     * @param nStateVarsPerElement Number of state variables per element, see getNumberOfRequiredStateVars().
+     */
+    void assignStateVarsDoubleBuffered( double* stateVars, const double* stateVarsOld, int nStateVarsPerElement );
+
+    /** @brief Swap the pair of state variable arrays to accept an increment, see MarmotElement::swapStateBuffers. */
+    void swapStateBuffers();
+
+    /** @brief Precompute the geometry-related quantities (dNdX, detJ, J0xW) of all quadrature points. */
+    void initializeYourself();
+
+    /** @brief Initialize the materials of all quadrature points; only MarmotMaterialInitialization is supported. */
+    void setInitialConditions( MarmotElement::StateTypes state, const double* values );
+
+    /**
+     * @brief Compute internal forces and tangent stiffness matrices of all elements.
+     * @details Equivalent to DisplacementFiniteElement::computeYourself for each element. Small elements are
+     * computed in batches of batchSize elements, see computeBatch, and the remaining elements one by one. If a material
+     * requests a cutback (pNewDT<1), the routine returns early.
+     * @param QTotal Total displacement vectors of all elements.
+     * @param dQ Incremental displacement vectors of all elements.
+     * @param Pe Internal force vectors of all elements (accumulated).
+     * @param Ke Tangent stiffness matrices of all elements (accumulated).
+     * @param time Time data forwarded to materials.
+     * @param dT Time increment.
+     * @param pNewDT Suggested scaling of dT by the materials.
+     */
+    void computeYourself( const double* QTotal,
+                          const double* dQ,
+                          double*       Pe,
+                          double*       Ke,
+                          const double* time,
+                          double        dT,
+                          double&       pNewDT );
+
+    /**
+     * @brief Compute internal force and tangent stiffness of a single element of the block.
+     * @param element Index of the element in the block.
+     * @param QTotal Total displacement vector of the element.
+     * @param dQ Incremental displacement vector of the element.
+     * @param Pe Internal force vector of the element (accumulated).
+     * @param Ke Tangent stiffness matrix of the element (accumulated).
+     * @param time Time data forwarded to materials.
+     * @param dT Time increment.
+     * @param pNewDT Suggested scaling of dT by the material.
+     */
+    void computeElement( int           element,
+                         const double* QTotal,
+                         const double* dQ,
+                         double*       Pe,
+                         double*       Ke,
+                         const double* time,
+                         double        dT,
+                         double&       pNewDT );
+
+    /**
+     * @brief Compute internal forces and tangent stiffness matrices of batchSize consecutive elements simultaneously.
+     * @details The kinematics \f$\Delta\boldsymbol{\varepsilon} = \boldsymbol{B} \Delta\boldsymbol{q}\f$, the
+     * internal forces \f$\boldsymbol{B}^T \boldsymbol{S}\f$ and the stiffness \f$\boldsymbol{B}^T \boldsymbol{C}
+     * \boldsymbol{B}\f$ are evaluated on lane arrays, where the innermost index is the element in the batch. The
+     * per-element matrices are too small to be vectorized efficiently, but the loops over the lanes are, without
+     * resorting to intrinsics. As in FiniteElement::Spatial3D::addBTransposeCB, the B-operator is not formed; the
+     * products are evaluated node by node from the lane arrays of the shape function derivatives, using only the
+     * nonzero entries of the B-operator (see BPattern). Materials are called element by element. If a material
+     * requests a cutback, the routine returns early without accumulating into Pe and Ke.
+     * @param firstElement Index of the first element of the batch in the block.
+     * @param QTotal Total displacement vectors of the elements of the batch.
+     * @param dQ Incremental displacement vectors of the elements of the batch.
+     * @param Pe Internal force vectors of the elements of the batch (accumulated).
+     * @param Ke Tangent stiffness matrices of the elements of the batch (accumulated).
+     * @param time Time data forwarded to materials.
+     * @param dT Time increment.
+     * @param pNewDT Suggested scaling of dT by the materials.
+     */
+    void computeBatch( int           firstElement,
+                       const double* QTotal,
+                       const double* dQ,
+                       double*       Pe,
+                       double*       Ke,
+                       const double* time,
+                       double        dT,
+                       double&       pNewDT );
+
+    /** @brief Status of the last computeYourself, with the index of the failing element in the block. */
+    const Marmot::Status& getStatus() const { return status; }
+
+    /** @brief Access a named state view at a quadrature point of an element. */
+    StateView getStateView( const std::string& stateName, int element, int qpNumber );
+
+    /**
+     * @brief Gather a state at all quadrature points of all elements, ordered by elements and quadrature points.
+     * @details The state is resolved by name once, and then copied with the stride of the state variables of a
+     * quadrature point.
+     */
+    void gatherStateField( const std::string& stateName, double* values );
+
+    /** @brief Gather the physical coordinates at all quadrature points of all elements. */
+    void gatherCoordinatesAtQuadraturePoints( double* coordinates );
+
+  private:
+    const int nElements;
+    const int nQuadraturePoints;
+    int       nStateVarsPerQuadraturePoint;
+
+    ParentGeometryElement geometry;
+
+    /* quadrature rule with N and dNdXi at the quadrature points */
+    const FiniteElement::ReferenceElement::TableView& referenceTable;
+
+    /* element data, indexed by element */
+    std::vector< double > coordinates;
+    std::vector< double > elementProperties;
+
+    /* quadrature point data, indexed by element * nQuadraturePoints + qp */
+    std::vector< dNdXiSized >                                  dNdX;
+    std::vector< double >                                      detJ;
+    std::vector< double >                                      J0xW;
+    std::vector< std::unique_ptr< MarmotMaterialHypoElastic > > materials;
+    double*                                                    stateVars;
+    const double*                                              stateVarsOld;
+
+    Marmot::Status status;
+
+    /* stress and strain are located at the beginning of the state of a quadrature point, cf. QPStateVarManager */
+    static constexpr int stressOffset = 0;
+    static constexpr int strainOffset = 6;
+
+    /* reset stress and strain of a quadrature point to the begin of the increment, if a pair of arrays is assigned */
+    void restoreStressAndStrain( int qp );
+
+    /* nonzero entry of the B-operator of a node: row (Voigt component), column (displacement component) and value
+     * (derivative of the shape function in direction), cf. FiniteElement::Spatial3D::B */
+    struct BEntry {
+      int voigt;
+      int component;
+      int direction;
+    };
+
+    static constexpr int nBEntries = nDim == 1 ? 1 : nDim == 2 ? 4 : 9;
+
+    static constexpr std::array< BEntry, nBEntries > BPattern = [] {
+      if constexpr ( nDim == 1 )
+        return std::array< BEntry, nBEntries >{ { { 0, 0, 0 } } };
+      else if constexpr ( nDim == 2 )
+        return std::array< BEntry, nBEntries >{ { { 0, 0, 0 }, { 1, 1, 1 }, { 2, 0, 1 }, { 2, 1, 0 } } };
+      else
+        return std::array< BEntry, nBEntries >{ { { 0, 0, 0 },
+                                                  { 1, 1, 1 },
+                                                  { 2, 2, 2 },
+                                                  { 3, 0, 1 },
+                                                  { 3, 1, 0 },
+                                                  { 4, 0, 2 },
+                                                  { 4, 2, 0 },
+                                                  { 5, 1, 2 },
+                                                  { 5, 2, 1 } } };
+    }();
+  };
+
+  template < int nDim, int nNodes >
+  ElementBlock< DisplacementFiniteElement< nDim, nNodes > >::ElementBlock(
+    const std::vector< int >&                   elementLabels,
+    FiniteElement::Quadrature::IntegrationTypes integrationType,
+    SectionType                                 sectionType )
+    : elementLabels( elementLabels ),
+      sectionType( sectionType ),
+      nElements( elementLabels.size() ),
+      nQuadraturePoints(
+        FiniteElement::ReferenceElement::getTable< nDim, nNodes >( integrationType ).nQuadraturePoints ),
+      nStateVarsPerQuadraturePoint( QPStateVarManager::getNumberOfRequiredStateVarsQuadraturePointOnly() ),
+      referenceTable( FiniteElement::ReferenceElement::getTable< nDim, nNodes >( integrationType ) ),
+      coordinates( nElements * nCoordinates, 0.0 ),
+      dNdX( nElements * nQuadraturePoints ),
+      detJ( nElements * nQuadraturePoints, 0.0 ),
+      J0xW( nElements * nQuadraturePoints, 0.0 ),
+      materials( nElements * nQuadraturePoints ),
+      stateVars( nullptr ),
+      stateVarsOld( nullptr )
+  {
+  }
+
+  template < int nDim, int nNodes >
+  void ElementBlock< DisplacementFiniteElement< nDim, nNodes > >::assignNodeCoordinates( const double* coordinates_ )
+  {
+    std::copy( coordinates_, coordinates_ + coordinates.size(), coordinates.begin() );
+  }
+
+  template < int nDim, int nNodes >
+  void ElementBlock< DisplacementFiniteElement< nDim, nNodes > >::assignProperty(
+    const ElementProperties& elementPropertiesInfo )
+  {
+    elementProperties.assign( elementPropertiesInfo.elementProperties,
+                              elementPropertiesInfo.elementProperties + elementPropertiesInfo.nElementProperties );
+  }
+
+  template < int nDim, int nNodes >
+  void ElementBlock< DisplacementFiniteElement< nDim, nNodes > >::assignProperty( const MarmotMaterialSection& section )
+  {
+    for ( int e = 0; e < nElements; e++ )
+      for ( int i = 0; i < nQuadraturePoints; i++ ) {
+        auto& material = materials[e * nQuadraturePoints + i];
+        material       = std::unique_ptr< MarmotMaterialHypoElastic >( dynamic_cast< MarmotMaterialHypoElastic* >(
+          MarmotLibrary::MarmotMaterialFactory::createMaterial( section, elementLabels[e] ) ) );
+
+        if ( !material )
+          throw std::invalid_argument( MakeString()
+                                       << __PRETTY_FUNCTION__
+                                       << ": invalid material assigned; cannot cast to MarmotMaterialHypoElastic!" );
+      }
+
+    nStateVarsPerQuadraturePoint = QPStateVarManager::getNumberOfRequiredStateVarsQuadraturePointOnly() +
+                                   materials[0]->getNumberOfRequiredStateVars();
+  }
+
+  template < int nDim, int nNodes >
+  void ElementBlock< DisplacementFiniteElement< nDim, nNodes > >::assignStateVars( double* stateVars_,
+                                                                                  int     nStateVarsPerElement )
+  {
+    if ( nStateVarsPerElement != getNumberOfRequiredStateVars() )
+      throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << ": " << nStateVarsPerElement
+                                                << " state variables per element provided, but "
+                                                << getNumberOfRequiredStateVars() << " are required" );
+
+    stateVars    = stateVars_;
+    stateVarsOld = nullptr;
+
+    const int nMaterialStateVars = nStateVarsPerQuadraturePoint -
+                                   QPStateVarManager::getNumberOfRequiredStateVarsQuadraturePointOnly();
+    for ( size_t i = 0; i < materials.size(); i++ )
+      materials[i]->assignStateVars( stateVars + i * nStateVarsPerQuadraturePoint +
+                                       QPStateVarManager::getNumberOfRequiredStateVarsQuadraturePointOnly(),
+                                     nMaterialStateVars );
+  }
+
+  template < int nDim, int nNodes >
+  void ElementBlock< DisplacementFiniteElement< nDim, nNodes > >::assignStateVarsDoubleBuffered(
+    double*       stateVars_,
+    const double* stateVarsOld_,
+    int           nStateVarsPerElement )
+  {
+    if ( nStateVarsPerElement != getNumberOfRequiredStateVars() )
+      throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << ": " << nStateVarsPerElement
+                                                << " state variables per element provided, but "
+                                                << getNumberOfRequiredStateVars() << " are required" );
+
+    stateVars    = stateVars_;
+    stateVarsOld = stateVarsOld_;
+
+    const int nQpOnlyStateVars   = QPStateVarManager::getNumberOfRequiredStateVarsQuadraturePointOnly();
+    const int nMaterialStateVars = nStateVarsPerQuadraturePoint - nQpOnlyStateVars;
+    for ( size_t i = 0; i < materials.size(); i++ )
+      materials[i]->assignStateVarsDoubleBuffered( stateVars + i * nStateVarsPerQuadraturePoint + nQpOnlyStateVars,
+                                                   stateVarsOld + i * nStateVarsPerQuadraturePoint + nQpOnlyStateVars,
+                                                   nMaterialStateVars );
+  }
+
+  template < int nDim, int nNodes >
+  void ElementBlock< DisplacementFiniteElement< nDim, nNodes > >::swapStateBuffers()
+  {
+    if ( !stateVarsOld )
+      throw std::logic_error( MakeString() << __PRETTY_FUNCTION__ << ": no pair of state variables assigned" );
+
+    // the host owns both arrays writable
+    assignStateVarsDoubleBuffered( const_cast< double* >( stateVarsOld ), stateVars, getNumberOfRequiredStateVars() );
+  }
+
+  template < int nDim, int nNodes >
+  void ElementBlock< DisplacementFiniteElement< nDim, nNodes > >::restoreStressAndStrain( int qp )
+  {
+    if ( stateVarsOld )
+      std::copy_n( stateVarsOld + qp * nStateVarsPerQuadraturePoint,
+                   QPStateVarManager::getNumberOfRequiredStateVarsQuadraturePointOnly(),
+                   stateVars + qp * nStateVarsPerQuadraturePoint );
+  }
+
+  template < int nDim, int nNodes >
+  void ElementBlock< DisplacementFiniteElement< nDim, nNodes > >::initializeYourself()
+  {
+    for ( int e = 0; e < nElements; e++ ) {
+      geometry.assignNodeCoordinates( &coordinates[e * nCoordinates] );
+
+      // for affine geometry, the Jacobian is computed and inverted only once per element
+      const JacobianSized J0    = geometry.Jacobian( Map< const dNdXiSized >( referenceTable.getdNdXi( 0 ) ) );
+      const JacobianSized J0Inv = J0.inverse();
+      const bool isAffine = FiniteElement::ReferenceElement::isAffine< nDim, nNodes >( referenceTable,
+                                                                                       geometry.coordinates.data(),
+                                                                                       J0 );
+
+      for ( int i = 0; i < nQuadraturePoints; i++ ) {
+        const int                     qp = e * nQuadraturePoints + i;
+        const Map< const dNdXiSized > dNdXi( referenceTable.getdNdXi( i ) );
+        const JacobianSized           J = isAffine ? J0 : geometry.Jacobian( dNdXi );
+
+        dNdX[qp] = geometry.dNdX( dNdXi, isAffine ? J0Inv : JacobianSized( J.inverse() ) );
+        detJ[qp] = J.determinant();
+        J0xW[qp] = referenceTable.weights[i] * detJ[qp];
+
+        if constexpr ( nDim == 1 || nDim == 2 )
+          J0xW[qp] *= elementProperties[0]; // cross section or thickness
+
+        if ( !materials[qp] )
+          continue;
+
+        if constexpr ( nDim == 3 )
+          materials[qp]->setCharacteristicElementLength( std::cbrt( 8 * detJ[qp] ) );
+        if constexpr ( nDim == 2 )
+          materials[qp]->setCharacteristicElementLength( std::sqrt( 4 * detJ[qp] ) );
+        if constexpr ( nDim == 1 )
+          materials[qp]->setCharacteristicElementLength( 2 * detJ[qp] );
+      }
+    }
+  }
+
+  template < int nDim, int nNodes >
+  void ElementBlock< DisplacementFiniteElement< nDim, nNodes > >::setInitialConditions( MarmotElement::StateTypes state,
+                                                                                       const double* values )
+  {
+    if ( state != MarmotElement::MarmotMaterialInitialization )
+      throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << ": invalid initial condition" );
+
+    for ( auto& material : materials )
+      material->initializeYourself();
+  }
+
+  template < int nDim, int nNodes >
+  void ElementBlock< DisplacementFiniteElement< nDim, nNodes > >::computeYourself( const double* QTotal,
+                                                                                  const double* dQ,
+                                                                                  double*       Pe,
+                                                                                  double*       Ke,
+                                                                                  const double* time,
+                                                                                  double        dT,
+                                                                                  double&       pNewDT )
+  {
+    Tracing::ScopedSpan span( "computeBlock", "element" );
+
+    status = {};
+
+    int e = 0;
+
+    if constexpr ( isBatched )
+      for ( ; e + batchSize <= nElements; e += batchSize ) {
+        computeBatch( e,
+                      QTotal + e * sizeLoadVector,
+                      dQ + e * sizeLoadVector,
+                      Pe + e * sizeLoadVector,
+                      Ke + e * sizeLoadVector * sizeLoadVector,
+                      time,
+                      dT,
+                      pNewDT );
+
+        if ( pNewDT < 1.0 )
+          return;
+      }
+
+    for ( ; e < nElements; e++ ) {
+      computeElement( e,
+                      QTotal + e * sizeLoadVector,
+                      dQ + e * sizeLoadVector,
+                      Pe + e * sizeLoadVector,
+                      Ke + e * sizeLoadVector * sizeLoadVector,
+                      time,
+                      dT,
+                      pNewDT );
+
+      if ( pNewDT < 1.0 )
+        return;
+    }
+  }
+
+  template < int nDim, int nNodes >
+  void ElementBlock< DisplacementFiniteElement< nDim, nNodes > >::computeElement( int           element,
+                                                                                 const double* QTotal_,
+                                                                                 const double* dQ_,
+                                                                                 double*       Pe_,
+                                                                                 double*       Ke_,
+                                                                                 const double* time,
+                                                                                 double        dT,
+                                                                                 double&       pNewDT )
+  {
+    using namespace ContinuumMechanics::VoigtNotation;
+
+    Map< const RhsSized > dQ( dQ_ );
+    Map< KeSizedMatrix >  Ke( Ke_ );
+    Map< RhsSized >       Pe( Pe_ );
+
+    Voigt  S, dE;
+    CSized C;
+
+    for ( int i = 0; i < nQuadraturePoints; i++ ) {
+      const int qp          = element * nQuadraturePoints + i;
+      double*   qpStateVars = stateVars + qp * nStateVarsPerQuadraturePoint;
+
+      mVector6d stress( qpStateVars + stressOffset );
+      mVector6d strain( qpStateVars + strainOffset );
+
+      const BSized B = geometry.B( dNdX[qp] );
+      dE             = B * dQ;
+
+      restoreStressAndStrain( qp );
+      Element::computeStressForSection( sectionType, *materials[qp], stress, S, C, dE, time, dT, pNewDT );
+
+      strain += make3DVoigt< ParentGeometryElement::voigtSize >( dE );
+
+      if ( pNewDT < 1.0 ) {
+        status         = Status::atQuadraturePoint( materials[qp]->getStatus(), pNewDT, i );
+        status.element = element;
+        return;
+      }
+
+      Ke += B.transpose() * C * B * J0xW[qp];
+      Pe -= B.transpose() * S * J0xW[qp];
+    }
+  }
+
+  template < int nDim, int nNodes >
+  void ElementBlock< DisplacementFiniteElement< nDim, nNodes > >::computeBatch( int           firstElement,
+                                                                               const double* QTotal,
+                                                                               const double* dQ,
+                                                                               double*       Pe,
+                                                                               double*       Ke,
+                                                                               const double* time,
+                                                                               double        dT,
+                                                                               double&       pNewDT )
+  {
+    using namespace ContinuumMechanics::VoigtNotation;
+
+    constexpr int nDof = sizeLoadVector;
+    constexpr int W    = batchSize;
+
+    /* lane arrays, the last index is the element in the batch */
+    alignas( 64 ) double dQL[nDof][W];
+    alignas( 64 ) double PeL[nDof][W]       = {};
+    alignas( 64 ) double KeL[nDof][nDof][W] = {};
+    alignas( 64 ) double dNdXL[nDim][nNodes][W];
+    alignas( 64 ) double CBL[nVoigt][nDof][W];
+    alignas( 64 ) double dEL[nVoigt][W];
+    alignas( 64 ) double SL[nVoigt][W];
+    alignas( 64 ) double CL[nVoigt][nVoigt][W];
+    alignas( 64 ) double J0xWL[W];
+
+    for ( int k = 0; k < nDof; k++ )
+      for ( int l = 0; l < W; l++ )
+        dQL[k][l] = dQ[l * nDof + k];
+
+    Voigt  S, dE;
+    CSized C;
+
+    for ( int i = 0; i < nQuadraturePoints; i++ ) {
+
+      // gather the shape function derivatives
+      for ( int l = 0; l < W; l++ ) {
+        const int qp = ( firstElement + l ) * nQuadraturePoints + i;
+        for ( int d = 0; d < nDim; d++ )
+          for ( int a = 0; a < nNodes; a++ )
+            dNdXL[d][a][l] = dNdX[qp]( d, a );
+        J0xWL[l] = J0xW[qp];
+      }
+
+      // kinematics, node by node
+      for ( int v = 0; v < nVoigt; v++ )
+        for ( int l = 0; l < W; l++ )
+          dEL[v][l] = 0.0;
+      for ( int a = 0; a < nNodes; a++ )
+        for ( const BEntry& b : BPattern )
+          for ( int l = 0; l < W; l++ )
+            dEL[b.voigt][l] += dNdXL[b.direction][a][l] * dQL[nDim * a + b.component][l];
+
+      // materials, element by element
+      for ( int l = 0; l < W; l++ ) {
+        const int qp          = ( firstElement + l ) * nQuadraturePoints + i;
+        double*   qpStateVars = stateVars + qp * nStateVarsPerQuadraturePoint;
+
+        mVector6d stress( qpStateVars + stressOffset );
+        mVector6d strain( qpStateVars + strainOffset );
+
+        for ( int v = 0; v < nVoigt; v++ )
+          dE( v ) = dEL[v][l];
+
+        restoreStressAndStrain( qp );
+        Element::computeStressForSection( sectionType, *materials[qp], stress, S, C, dE, time, dT, pNewDT );
+
+        strain += make3DVoigt< ParentGeometryElement::voigtSize >( dE );
+
+        if ( pNewDT < 1.0 ) {
+          status         = Status::atQuadraturePoint( materials[qp]->getStatus(), pNewDT, i );
+          status.element = firstElement + l;
+          return;
+        }
+
+        for ( int v = 0; v < nVoigt; v++ ) {
+          SL[v][l] = S( v ) * J0xWL[l];
+          for ( int w = 0; w < nVoigt; w++ )
+            CL[v][w][l] = C( v, w ) * J0xWL[l];
+        }
+      }
+
+      // B^T S, node by node
+      for ( int a = 0; a < nNodes; a++ )
+        for ( const BEntry& b : BPattern )
+          for ( int l = 0; l < W; l++ )
+            PeL[nDim * a + b.component][l] -= dNdXL[b.direction][a][l] * SL[b.voigt][l];
+
+      // C B, node by node
+      for ( int v = 0; v < nVoigt; v++ )
+        for ( int k = 0; k < nDof; k++ )
+          for ( int l = 0; l < W; l++ )
+            CBL[v][k][l] = 0.0;
+      for ( int a = 0; a < nNodes; a++ )
+        for ( const BEntry& b : BPattern )
+          for ( int v = 0; v < nVoigt; v++ )
+            for ( int l = 0; l < W; l++ )
+              CBL[v][nDim * a + b.component][l] += CL[v][b.voigt][l] * dNdXL[b.direction][a][l];
+
+      // B^T (C B), column by column and node by node
+      for ( int m = 0; m < nDof; m++ )
+        for ( int a = 0; a < nNodes; a++ )
+          for ( const BEntry& b : BPattern )
+            for ( int l = 0; l < W; l++ )
+              KeL[m][nDim * a + b.component][l] += dNdXL[b.direction][a][l] * CBL[b.voigt][m][l];
+    }
+
+    // scatter into the (column major) element vectors and matrices
+    for ( int l = 0; l < W; l++ ) {
+      for ( int k = 0; k < nDof; k++ )
+        Pe[l * nDof + k] += PeL[k][l];
+      for ( int m = 0; m < nDof; m++ )
+        for ( int k = 0; k < nDof; k++ )
+          Ke[l * nDof * nDof + m * nDof + k] += KeL[m][k][l];
+    }
+  }
+
+  template < int nDim, int nNodes >
+  StateView ElementBlock< DisplacementFiniteElement< nDim, nNodes > >::getStateView( const std::string& stateName,
+                                                                                    int                element,
+                                                                                    int                qpNumber )
+  {
+    const int               qp = element * nQuadraturePoints + qpNumber;
+    const QPStateVarManager managedStateVars( stateVars + qp * nStateVarsPerQuadraturePoint,
+                                              nStateVarsPerQuadraturePoint );
+
+    if ( managedStateVars.contains( stateName ) )
+      return managedStateVars.getStateView( stateName );
+
+    return materials[qp]->getStateView( stateName );
+  }
+
+  template < int nDim, int nNodes >
+  void ElementBlock< DisplacementFiniteElement< nDim, nNodes > >::gatherStateField( const std::string& stateName,
+                                                                                   double*            values )
+  {
+    const StateView view   = getStateView( stateName, 0, 0 );
+    const auto      offset = view.stateLocation - stateVars;
+    const int       nQps   = nElements * nQuadraturePoints;
+
+    if ( offset < 0 || offset + view.stateSize > nStateVarsPerQuadraturePoint ) {
+      for ( int e = 0; e < nElements; e++ )
+        for ( int i = 0; i < nQuadraturePoints; i++ )
+          values = std::copy_n( getStateView( stateName, e, i ).stateLocation, view.stateSize, values );
+      return;
+    }
+
+    const double* source = stateVars + offset;
+    for ( int qp = 0; qp < nQps; qp++, source += nStateVarsPerQuadraturePoint )
+      values = std::copy_n( source, view.stateSize, values );
+  }
+
+  template < int nDim, int nNodes >
+  void ElementBlock< DisplacementFiniteElement< nDim, nNodes > >::gatherCoordinatesAtQuadraturePoints(
+    double* qpCoordinates )
+  {
+    for ( int e = 0; e < nElements; e++ ) {
+      const Map< const Matrix< double, nDim, nNodes > > nodeCoordinates( &coordinates[e * nCoordinates] );
+
+      for ( int i = 0; i < nQuadraturePoints; i++, qpCoordinates += nDim ) {
+        const Map< const Matrix< double, nNodes, 1 > > N( referenceTable.getN( i ) );
+        Map< Matrix< double, nDim, 1 > >               x( qpCoordinates );
+        x = nodeCoordinates * N;
+      }
+    }
+  }
+
+} // namespace Marmot::Elements
@@ -0,0 +1,82 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ * Magdalena Schreter magdalena.schreter@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+#pragma once
+#include "Marmot/DisplacementFiniteElement.h"
+#include <typeinfo>
+
+namespace Marmot::Elements {
+
+  /**
+   * @class DisplacementFiniteElementBoundMaterial
+   * @brief DisplacementFiniteElement bound at compile time to the concrete material type Material.
+   *
+   * The materials of the quadrature points are called by qualified (statically bound) calls instead of virtual
+   * functions, such that the constitutive call can be inlined into the loop over the quadrature points, provided
+   * that its definition is visible (e.g., with interprocedural optimization, see the CMake option
+   * MARMOT_BOUND_MATERIAL_ELEMENTS). The plane stress and uniaxial stress wrappers of MarmotMaterialHypoElastic
+   * still call computeStress virtually within their iterations.
+   *
+   * The materials are created by the MarmotMaterialFactory as usual, and a material section of any other material
+   * type is rejected in assignProperty.
+   */
+  template < int nDim, int nNodes, typename Material >
+  class DisplacementFiniteElementBoundMaterial : public DisplacementFiniteElement< nDim, nNodes > {
+
+    static_assert( std::is_base_of_v< MarmotMaterialHypoElastic, Material >,
+                   "elements can only be bound to hypoelastic materials" );
+
+  public:
+    using BaseElement = DisplacementFiniteElement< nDim, nNodes >;
+    using BaseElement::BaseElement;
+    using BaseElement::assignProperty;
+
+    /** @brief Create the materials, which must be of type Material. */
+    void assignProperty( const MarmotMaterialSection& section )
+    {
+      BaseElement::assignProperty( section );
+
+      for ( const auto& qp : this->qps )
+        if ( typeid( *qp.material ) != typeid( Material ) )
+          throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << ": material code " << section.materialCode
+                                                    << " does not match the material type of the element" );
+    }
+
+    /** @brief DisplacementFiniteElement::computeYourself with statically bound materials. */
+    void computeYourself( const double* QTotal,
+                          const double* dQ,
+                          double*       Pe,
+                          double*       Ke,
+                          const double* time,
+                          double        dT,
+                          double&       pNewdT )
+    {
+      this->template computeYourselfWithMaterial< Material >( QTotal, dQ, Pe, Ke, time, dT, pNewdT );
+    }
+  };
+
+} // namespace Marmot::Elements
@@ -0,0 +1,111 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ * Magdalena Schreter magdalena.schreter@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+#pragma once
+#include "Marmot/DisplacementFiniteElement.h"
+
+namespace Marmot::Elements {
+
+  /**
+   * @class DisplacementFiniteElementC3D8R
+   * @brief Hexa8 with one-point integration and Flanagan-Belytschko hourglass stabilization.
+   *
+   * The material is evaluated only at the center of the element. The four hourglass modes, which are not resisted
+   * by the one-point quadrature, are controlled by the stabilization vectors
+   * \f[
+   * \boldsymbol{\gamma}_\alpha = \frac{1}{8} \left( \boldsymbol{h}_\alpha - ( \boldsymbol{h}_\alpha \cdot
+   * \boldsymbol{x}_i ) \frac{\partial \boldsymbol{N}}{\partial x_i} \right),
+   * \f]
+   * with the base vectors \f$\boldsymbol{h}_\alpha\f$ of the modes \f$\xi\eta, \eta\zeta, \zeta\xi, \xi\eta\zeta\f$,
+   * which are orthogonal to all linear displacement fields, such that the patch test is passed. The generalized
+   * hourglass forces \f$\boldsymbol{Q}_\alpha\f$ are integrated in rate form,
+   * \f[
+   * \Delta \boldsymbol{Q}_\alpha = \kappa\, \frac{\mathrm{tr}_3(\mathbb{C})}{3}\, \frac{V}{3}\, \left\|
+   * \frac{\partial \boldsymbol{N}}{\partial \boldsymbol{x}} \right\|^2 \boldsymbol{\gamma}_\alpha \cdot \Delta
+   * \boldsymbol{U},
+   * \f]
+   * with the mean of the normal diagonal entries of the current material tangent \f$\mathbb{C}\f$ (i.e.,
+   * \f$\lambda+2\mu\f$ for isotropic elasticity) and the scaling factor \f$\kappa\f$. They are stored in 12 additional
+   * state variables of the element, after those of the quadrature point.
+   */
+  class DisplacementFiniteElementC3D8R : public DisplacementFiniteElement< 3, 8 > {
+
+  public:
+    using BaseElement = DisplacementFiniteElement< 3, 8 >;
+
+    static constexpr int nHourglassModes     = 4;
+    static constexpr int nHourglassStateVars = nHourglassModes * 3;
+
+    /** Scaling factor \f$\kappa\f$ of the hourglass stiffness. */
+    double hourglassScaling = 0.05;
+
+    /** Stabilization vectors \f$\boldsymbol{\gamma}_\alpha\f$, row by row. */
+    Matrix< double, nHourglassModes, 8 > gamma;
+
+    /** Geometric part of the hourglass stiffness, \f$ V\, \| \partial \boldsymbol{N} / \partial \boldsymbol{x} \|^2
+     * / 3 \f$. */
+    double hourglassGeometryFactor;
+
+    /** Generalized hourglass forces \f$\boldsymbol{Q}_\alpha\f$, column by column. */
+    Map< Matrix< double, 3, nHourglassModes > > hourglassForces;
+
+    /** Generalized hourglass forces at the begin of the increment, the same as #hourglassForces unless a pair of state
+     * variable arrays is assigned. */
+    Map< const Matrix< double, 3, nHourglassModes > > hourglassForcesOld;
+
+    DisplacementFiniteElementC3D8R( int elementID );
+
+    /** @brief State variables of the quadrature point and the generalized hourglass forces. */
+    int getNumberOfRequiredStateVars();
+
+    void assignStateVars( double* stateVars, int nStateVars );
+
+    void assignStateVarsDoubleBuffered( double* stateVars, const double* stateVarsOld, int nStateVars );
+
+    /** @brief Swap the pair of state vectors, including the generalized hourglass forces. */
+    void swapStateBuffers();
+
+    /** @brief Compute the kinematics of the quadrature point and the stabilization vectors. */
+    void initializeYourself();
+
+    /**
+     * @brief Compute internal force and tangent stiffness, including the hourglass stabilization.
+     * @details See DisplacementFiniteElement::computeYourself.
+     */
+    void computeYourself( const double* QTotal,
+                          const double* dQ,
+                          double*       Pe,
+                          double*       Ke,
+                          const double* time,
+                          double        dT,
+                          double&       pNewDT );
+
+    /** @brief Access to the states of the quadrature point, or to the "hourglass forces" of the element. */
+    StateView getStateView( const std::string& stateName, int qpNumber );
+  };
+
+} // namespace Marmot::Elements
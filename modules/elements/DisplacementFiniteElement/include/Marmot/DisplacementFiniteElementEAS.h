@@ -0,0 +1,338 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ * Magdalena Schreter magdalena.schreter@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+#pragma once
+#include "Marmot/DisplacementFiniteElement.h"
+#include "Marmot/MarmotEnhancedAssumedStrain.h"
+
+namespace Marmot::Elements {
+
+  /**
+   * @class DisplacementFiniteElementEAS
+   * @brief Displacement element with enhanced assumed strains, e.g., quad4 with SimoRifaiEAS5 or hexa8 with
+   * DeBorstEAS9.
+   *
+   * The strain increment at a quadrature point is enhanced by
+   * \f[
+   * \Delta\boldsymbol{\varepsilon} = \mathbf{B}\, \Delta\mathbf{u} + \mathbf{G}\, \Delta\boldsymbol{\alpha},\qquad
+   * \mathbf{G} = \frac{\det \boldsymbol{J}_0}{\det \boldsymbol{J}}\, \mathbf{F}_0^{-\mathsf{T}}\,
+   * \mathbf{E}(\boldsymbol{\xi}),
+   * \f]
+   * with the interpolation \f$\mathbf{E}\f$ of the enhanced parameters \f$\boldsymbol{\alpha}\f$ and the
+   * transformation \f$\mathbf{F}_0\f$ evaluated at the element center. The enhanced parameters are condensed on element
+   * level: in computeYourself, they are determined for the given displacement increment by a local Newton scheme until
+   * the enhanced residual \f$\mathbf{h} = \sum_{qp} \mathbf{G}^\mathsf{T} \boldsymbol{\sigma}\, J_0 w\f$ vanishes, and
+   * the condensed tangent \f$\mathbf{K}_{uu} - \mathbf{K}_{u\alpha} \mathbf{K}_{\alpha\alpha}^{-1}
+   * \mathbf{K}_{\alpha u}\f$ is returned. All matrices have a fixed size.
+   *
+   * The parameters \f$\boldsymbol{\alpha}\f$ and the condensation operator \f$\mathbf{K}_{\alpha\alpha}^{-1}
+   * \mathbf{K}_{\alpha u}\f$ are stored in the element state after the states of the quadrature points. The latter
+   * provides the predictor \f$\Delta\boldsymbol{\alpha} = - \mathbf{K}_{\alpha\alpha}^{-1} \mathbf{K}_{\alpha u}\,
+   * \Delta\mathbf{u}\f$ of the next increment, which is exact for linear materials, such that a single evaluation of
+   * the materials is required.
+   */
+  template < int nDim, int nNodes, FiniteElement::EAS::EASType easType >
+  class DisplacementFiniteElementEAS : public DisplacementFiniteElement< nDim, nNodes > {
+
+  public:
+    using BaseElement = DisplacementFiniteElement< nDim, nNodes >;
+    using typename BaseElement::CSized;
+    using typename BaseElement::JacobianSized;
+    using typename BaseElement::KeSizedMatrix;
+    using typename BaseElement::QuadraturePoint;
+    using typename BaseElement::RhsSized;
+    using typename BaseElement::SectionType;
+    using typename BaseElement::Voigt;
+    using typename BaseElement::XiSized;
+
+    static_assert( FiniteElement::EAS::EASTraits< easType >::nDim == nDim, "EAS type for a different dimension" );
+    static_assert( !BaseElement::hasCompactKinematics, "EAS elements require the B-operator" );
+
+    static constexpr int sizeLoadVector = BaseElement::sizeLoadVector;
+    static constexpr int nVoigt         = BaseElement::ParentGeometryElement::voigtSize;
+    static constexpr int nEAS           = FiniteElement::EAS::EASTraits< easType >::nParameters;
+    static constexpr int nEASStateVars  = nEAS + nEAS * sizeLoadVector;
+
+    using GSized          = Matrix< double, nVoigt, nEAS >;
+    using EASVector       = Matrix< double, nEAS, 1 >;
+    using KaaSized        = Matrix< double, nEAS, nEAS >;
+    using KauSized        = Matrix< double, nEAS, sizeLoadVector >;
+    using KuaSized        = Matrix< double, sizeLoadVector, nEAS >;
+    using StateVarsVector = Matrix< double, Dynamic, 1 >;
+
+    /**
+     * Maximum number of iterations and tolerances of the local Newton scheme for the enhanced parameters. The scheme
+     * has converged if the norm of the enhanced residual is below the relative tolerance times the norm of the internal
+     * forces, or below the absolute tolerance (in units of the internal forces), such that unloaded elements converge.
+     */
+    int    maxEASIterations     = 10;
+    double easRelativeTolerance = 1e-10;
+    double easAbsoluteTolerance = 1e-12;
+
+    /** Enhanced strain operators of the quadrature points. */
+    std::vector< GSized > G;
+
+    /** Enhanced parameters \f$\boldsymbol{\alpha}\f$. */
+    Map< EASVector > alpha;
+
+    /** Condensation operator \f$\mathbf{K}_{\alpha\alpha}^{-1} \mathbf{K}_{\alpha u}\f$ of the last increment. */
+    Map< KauSized > condensation;
+
+    DisplacementFiniteElementEAS( int                                         elementID,
+                                  FiniteElement::Quadrature::IntegrationTypes integrationType,
+                                  SectionType                                 sectionType );
+
+    /** @brief State variables of the quadrature points, the enhanced parameters and the condensation operator. */
+    int getNumberOfRequiredStateVars();
+
+    void assignStateVars( double* stateVars, int nStateVars );
+
+    void assignStateVarsDoubleBuffered( double* stateVars, const double* stateVarsOld, int nStateVars );
+
+    /** @brief Swap the pair of state vectors, including the enhanced parameters and the condensation operator. */
+    void swapStateBuffers();
+
+    /** @brief Compute the kinematics of the quadrature points and the enhanced strain operators. */
+    void initializeYourself();
+
+    /**
+     * @brief Compute internal force and condensed tangent stiffness.
+     * @details If the local Newton scheme does not converge, a cutback is requested (pNewDT = 0.5).
+     */
+    void computeYourself( const double* QTotal,
+                          const double* dQ,
+                          double*       Pe,
+                          double*       Ke,
+                          const double* time,
+                          double        dT,
+                          double&       pNewDT );
+
+  private:
+    /**
+     * States of the quadrature points and their values at the begin of computeYourself. The quadrature points compute
+     * from the copy as their old state variables, such that the iterations of the local Newton scheme do not restore
+     * the states. No copy is made if the host assigns a pair of state variable arrays.
+     */
+    Map< StateVarsVector > qpStateVars;
+    StateVarsVector        qpStateVarsBackup;
+
+    /** Enhanced parameters and condensation operator at the begin of the increment. */
+    const double* easStateVarsOld;
+  };
+
+  template < int nDim, int nNodes, FiniteElement::EAS::EASType easType >
+  DisplacementFiniteElementEAS< nDim, nNodes, easType >::DisplacementFiniteElementEAS(
+    int                                         elementID,
+    FiniteElement::Quadrature::IntegrationTypes integrationType,
+    SectionType                                 sectionType )
+    : BaseElement( elementID, integrationType, sectionType ),
+      G( this->qps.size() ),
+      alpha( nullptr ),
+      condensation( nullptr ),
+      qpStateVars( nullptr, 0 ),
+      easStateVarsOld( nullptr )
+  {
+  }
+
+  template < int nDim, int nNodes, FiniteElement::EAS::EASType easType >
+  int DisplacementFiniteElementEAS< nDim, nNodes, easType >::getNumberOfRequiredStateVars()
+  {
+    return BaseElement::getNumberOfRequiredStateVars() + nEASStateVars;
+  }
+
+  template < int nDim, int nNodes, FiniteElement::EAS::EASType easType >
+  void DisplacementFiniteElementEAS< nDim, nNodes, easType >::assignStateVars( double* stateVars, int nStateVars )
+  {
+    const int nQpStateVars = nStateVars - nEASStateVars;
+
+    qpStateVarsBackup.resize( nQpStateVars );
+    BaseElement::assignStateVarsDoubleBuffered( stateVars, qpStateVarsBackup.data(), nQpStateVars );
+
+    new ( &qpStateVars ) Map< StateVarsVector >( stateVars, nQpStateVars );
+    new ( &alpha ) Map< EASVector >( stateVars + nQpStateVars );
+    new ( &condensation ) Map< KauSized >( stateVars + nQpStateVars + nEAS );
+
+    easStateVarsOld = alpha.data();
+  }
+
+  template < int nDim, int nNodes, FiniteElement::EAS::EASType easType >
+  void DisplacementFiniteElementEAS< nDim, nNodes, easType >::assignStateVarsDoubleBuffered( double*       stateVars,
+                                                                                             const double* stateVarsOld,
+                                                                                             int           nStateVars )
+  {
+    const int nQpStateVars = nStateVars - nEASStateVars;
+
+    qpStateVarsBackup.resize( 0 );
+    BaseElement::assignStateVarsDoubleBuffered( stateVars, stateVarsOld, nQpStateVars );
+
+    new ( &qpStateVars ) Map< StateVarsVector >( stateVars, nQpStateVars );
+    new ( &alpha ) Map< EASVector >( stateVars + nQpStateVars );
+    new ( &condensation ) Map< KauSized >( stateVars + nQpStateVars + nEAS );
+
+    easStateVarsOld = stateVarsOld + nQpStateVars;
+  }
+
+  template < int nDim, int nNodes, FiniteElement::EAS::EASType easType >
+  void DisplacementFiniteElementEAS< nDim, nNodes, easType >::swapStateBuffers()
+  {
+    if ( qpStateVarsBackup.size() > 0 )
+      throw std::logic_error( MakeString() << __PRETTY_FUNCTION__ << ": no pair of state variables assigned" );
+
+    const int     nQpStateVars = qpStateVars.size();
+    const double* stateVars    = qpStateVars.data();
+    // the host owns both arrays writable
+    double* stateVarsOld = const_cast< double* >( easStateVarsOld ) - nQpStateVars;
+
+    BaseElement::swapStateBuffers();
+
+    new ( &qpStateVars ) Map< StateVarsVector >( stateVarsOld, nQpStateVars );
+    new ( &alpha ) Map< EASVector >( stateVarsOld + nQpStateVars );
+    new ( &condensation ) Map< KauSized >( stateVarsOld + nQpStateVars + nEAS );
+
+    easStateVarsOld = stateVars + nQpStateVars;
+  }
+
+  template < int nDim, int nNodes, FiniteElement::EAS::EASType easType >
+  void DisplacementFiniteElementEAS< nDim, nNodes, easType >::initializeYourself()
+  {
+    BaseElement::initializeYourself();
+
+    const JacobianSized                    J0     = this->Jacobian( this->dNdXi( XiSized::Zero() ) );
+    const Matrix< double, nVoigt, nVoigt > F0InvT = FiniteElement::EAS::F< nDim >( J0 ).inverse().transpose();
+    const double                           detJ0  = J0.determinant();
+
+    for ( size_t i = 0; i < this->qps.size(); i++ ) {
+      const QuadraturePoint& qp = this->qps[i];
+      G[i]                      = detJ0 / qp.detJ * F0InvT * FiniteElement::EAS::EASInterpolation< easType >( qp.xi );
+    }
+  }
+
+  template < int nDim, int nNodes, FiniteElement::EAS::EASType easType >
+  void DisplacementFiniteElementEAS< nDim, nNodes, easType >::computeYourself( const double* QTotal_,
+                                                                               const double* dQ_,
+                                                                               double*       Pe_,
+                                                                               double*       Ke_,
+                                                                               const double* time,
+                                                                               double        dT,
+                                                                               double&       pNewDT )
+  {
+    using namespace ContinuumMechanics::VoigtNotation;
+
+    this->countEvent( PerformanceCounters::ComputeYourselfCalls );
+    Tracing::ScopedSpan span( "computeYourself", "element", this->elementCode );
+
+    Map< const RhsSized > dQ( dQ_ );
+    Map< KeSizedMatrix >  Ke( Ke_ );
+    Map< RhsSized >       Pe( Pe_ );
+
+    Voigt  S, dE;
+    CSized C;
+
+    KeSizedMatrix Kuu;
+    KuaSized      Kua;
+    KauSized      Kau;
+    KaaSized      Kaa;
+    RhsSized      Pu;
+    EASVector     h;
+
+    const Map< const EASVector > alphaOld( easStateVarsOld );
+    const Map< const KauSized >  condensationOld( easStateVarsOld + nEAS );
+
+    // predictor from the condensation operator of the last increment
+    EASVector dAlpha = -condensationOld * dQ;
+
+    if ( qpStateVarsBackup.size() > 0 )
+      qpStateVarsBackup = qpStateVars;
+
+    this->status = {};
+
+    for ( int iteration = 0;; iteration++ ) {
+
+      if ( iteration == maxEASIterations ) {
+        pNewDT = 0.5;
+        this->requestCutback( Status::cutback( Status::NotConverged, pNewDT ) );
+        return;
+      }
+
+      Kuu.setZero();
+      Kua.setZero();
+      Kau.setZero();
+      Kaa.setZero();
+      Pu.setZero();
+      h.setZero();
+
+      for ( size_t i = 0; i < this->qps.size(); i++ ) {
+        QuadraturePoint& qp = this->qps[i];
+
+        dE = qp.B * dQ + G[i] * dAlpha;
+
+        qp.restoreStressAndStrain();
+        BaseElement::computeStressForSection( this->sectionType,
+                                              *qp.material,
+                                              qp.managedStateVars->stress,
+                                              S,
+                                              C,
+                                              dE,
+                                              time,
+                                              dT,
+                                              pNewDT );
+
+        qp.managedStateVars->strain += make3DVoigt< BaseElement::ParentGeometryElement::voigtSize >( dE );
+
+        if ( pNewDT < 1.0 ) {
+          this->requestCutback( Status::atQuadraturePoint( qp.material->getStatus(), pNewDT, i ) );
+          return;
+        }
+
+        const Matrix< double, nVoigt, sizeLoadVector > CB = C * qp.B * qp.J0xW;
+        const GSized                                   CG = C * G[i] * qp.J0xW;
+
+        Kuu += qp.B.transpose() * CB;
+        Kua += qp.B.transpose() * CG;
+        Kau += G[i].transpose() * CB;
+        Kaa += G[i].transpose() * CG;
+        Pu -= qp.B.transpose() * S * qp.J0xW;
+        h += G[i].transpose() * S * qp.J0xW;
+      }
+
+      const double hNorm = h.norm();
+      if ( hNorm <= easRelativeTolerance * Pu.norm() || hNorm <= easAbsoluteTolerance )
+        break;
+
+      dAlpha -= Kaa.partialPivLu().solve( h );
+    }
+
+    const auto KaaLU = Kaa.partialPivLu();
+
+    condensation = KaaLU.solve( Kau );
+    alpha        = alphaOld + dAlpha;
+
+    Ke += Kuu - Kua * condensation;
+    Pe += Pu + Kua * KaaLU.solve( h );
+  }
+
+} // namespace Marmot::Elements
@@ -18,4 +18,10 @@ if ( DEPENDECIES_FULLFILLED )
     include_directories(${CMAKE_CURRENT_LIST_DIR}/include)
     file(GLOB sources_material "${CMAKE_CURRENT_LIST_DIR}/src/*.cpp")
     list(APPEND sources ${sources_material})
+
+    # elements bound to shipped materials, see DisplacementFiniteElementBoundMaterial.h
+    if ( MARMOT_BOUND_MATERIAL_ELEMENTS AND "LinearElastic" IN_LIST INSTALLED_MODULES AND "VonMises" IN_LIST INSTALLED_MODULES )
+        add_compile_definitions(MARMOT_ENABLE_BOUND_MATERIAL_ELEMENTS)
+        message("----> registering elements bound to LinearElastic and VonMises")
+    endif()
 endif()
@@ -0,0 +1,134 @@
+#include "Marmot/DisplacementFiniteElementC3D8R.h"
+#include "Marmot/MarmotPerformanceCounters.h"
+#include "Marmot/MarmotTracing.h"
+
+namespace Marmot::Elements {
+
+  DisplacementFiniteElementC3D8R::DisplacementFiniteElementC3D8R( int elementID )
+    : BaseElement( elementID, FiniteElement::Quadrature::IntegrationTypes::ReducedIntegration, SectionType::Solid ),
+      gamma( Matrix< double, nHourglassModes, 8 >::Zero() ),
+      hourglassGeometryFactor( 0.0 ),
+      hourglassForces( nullptr ),
+      hourglassForcesOld( nullptr )
+  {
+  }
+
+  int DisplacementFiniteElementC3D8R::getNumberOfRequiredStateVars()
+  {
+    return BaseElement::getNumberOfRequiredStateVars() + nHourglassStateVars;
+  }
+
+  void DisplacementFiniteElementC3D8R::assignStateVars( double* stateVars, int nStateVars )
+  {
+    BaseElement::assignStateVars( stateVars, nStateVars - nHourglassStateVars );
+    new ( &hourglassForces ) Map< Matrix< double, 3, nHourglassModes > >( stateVars + nStateVars -
+                                                                          nHourglassStateVars );
+    new ( &hourglassForcesOld ) Map< const Matrix< double, 3, nHourglassModes > >( hourglassForces.data() );
+  }
+
+  void DisplacementFiniteElementC3D8R::assignStateVarsDoubleBuffered( double*       stateVars,
+                                                                      const double* stateVarsOld,
+                                                                      int           nStateVars )
+  {
+    BaseElement::assignStateVarsDoubleBuffered( stateVars, stateVarsOld, nStateVars - nHourglassStateVars );
+    new ( &hourglassForces ) Map< Matrix< double, 3, nHourglassModes > >( stateVars + nStateVars -
+                                                                          nHourglassStateVars );
+    new ( &hourglassForcesOld ) Map< const Matrix< double, 3, nHourglassModes > >( stateVarsOld + nStateVars -
+                                                                                   nHourglassStateVars );
+  }
+
+  void DisplacementFiniteElementC3D8R::swapStateBuffers()
+  {
+    BaseElement::swapStateBuffers();
+
+    // the host owns both arrays writable
+    double* hourglassForcesData = const_cast< double* >( hourglassForcesOld.data() );
+    new ( &hourglassForcesOld ) Map< const Matrix< double, 3, nHourglassModes > >( hourglassForces.data() );
+    new ( &hourglassForces ) Map< Matrix< double, 3, nHourglassModes > >( hourglassForcesData );
+  }
+
+  void DisplacementFiniteElementC3D8R::initializeYourself()
+  {
+    BaseElement::initializeYourself();
+
+    const Map< const dNdXiSized > dNdXi( referenceTable.getdNdXi( 0 ) );
+    const dNdXiSized              dNdX = this->dNdX( dNdXi, this->Jacobian( dNdXi ).inverse() );
+
+    // base vectors xi*eta, eta*zeta, zeta*xi and xi*eta*zeta, evaluated at the nodes
+    const Map< const Matrix< double, 3, 8 > > X( referenceTable.nodeCoordinates );
+    Matrix< double, nHourglassModes, 8 >      h;
+    h.row( 0 ) = X.row( 0 ).cwiseProduct( X.row( 1 ) );
+    h.row( 1 ) = X.row( 1 ).cwiseProduct( X.row( 2 ) );
+    h.row( 2 ) = X.row( 2 ).cwiseProduct( X.row( 0 ) );
+    h.row( 3 ) = h.row( 0 ).cwiseProduct( X.row( 2 ) );
+
+    const Map< const Matrix< double, 3, 8 > > x( this->coordinates.data() );
+
+    gamma = ( h - h * x.transpose() * dNdX ) / 8;
+
+    const double volume     = 8 * qps[0].detJ;
+    hourglassGeometryFactor = volume * dNdX.squaredNorm() / 3;
+  }
+
+  void DisplacementFiniteElementC3D8R::computeYourself( const double* QTotal_,
+                                                        const double* dQ_,
+                                                        double*       Pe_,
+                                                        double*       Ke_,
+                                                        const double* time,
+                                                        double        dT,
+                                                        double&       pNewDT )
+  {
+    using namespace ContinuumMechanics::VoigtNotation;
+
+    countEvent( PerformanceCounters::ComputeYourselfCalls );
+    Tracing::ScopedSpan span( "computeYourself", "element", elementCode );
+
+    Map< const RhsSized > dQ( dQ_ );
+    Map< KeSizedMatrix >  Ke( Ke_ );
+    Map< RhsSized >       Pe( Pe_ );
+
+    QuadraturePoint& qp = qps[0];
+
+    status = {};
+
+    Voigt       S;
+    CSized      C;
+    const Voigt dE = qp.B * dQ;
+
+    qp.restoreStressAndStrain();
+    computeStressForSection( sectionType, *qp.material, qp.managedStateVars->stress, S, C, dE, time, dT, pNewDT );
+
+    qp.managedStateVars->strain += dE;
+
+    if ( pNewDT < 1.0 ) {
+      requestCutback( Status::atQuadraturePoint( qp.material->getStatus(), pNewDT, 0 ) );
+      return;
+    }
+
+    Ke += qp.B.transpose() * C * qp.B * qp.J0xW;
+    Pe -= qp.B.transpose() * S * qp.J0xW;
+
+    // hourglass stabilization, with the stiffness following the current material tangent
+    const double k = hourglassScaling * C.diagonal().head< 3 >().mean() * hourglassGeometryFactor;
+
+    const Map< const Matrix< double, 3, 8 > > dU( dQ_ );
+    hourglassForces = hourglassForcesOld + k * dU * gamma.transpose();
+
+    Map< Matrix< double, 3, 8 > > P( Pe_ );
+    P -= hourglassForces * gamma;
+
+    const Matrix< double, 8, 8 > gammaTGamma = k * gamma.transpose() * gamma;
+    for ( int a = 0; a < 8; a++ )
+      for ( int b = 0; b < 8; b++ )
+        Ke.block< 3, 3 >( 3 * a, 3 * b ).diagonal().array() += gammaTGamma( a, b );
+  }
+
+  StateView DisplacementFiniteElementC3D8R::getStateView( const std::string& stateName, int qpNumber )
+  {
+    if ( stateName == "hourglass forces" )
+      return { hourglassForces.data(), nHourglassStateVars };
+
+    return BaseElement::getStateView( stateName, qpNumber );
+  }
+
+} // namespace Marmot::Elements
@@ -1,18 +1,26 @@
 #include "Marmot/DisplacementFiniteElement.h"
+#include "Marmot/DisplacementFiniteElementC3D8R.h"
+#include "Marmot/DisplacementFiniteElementEAS.h"
 #include "Marmot/Marmot.h"
 #include "Marmot/MarmotFiniteElement.h"
 #include "Marmot/MarmotFiniteElementSpatialWrapper.h"
+#ifdef MARMOT_ENABLE_BOUND_MATERIAL_ELEMENTS
+#include "Marmot/DisplacementFiniteElementBoundMaterial.h"
+#include "Marmot/LinearElastic.h"
+#include "Marmot/VonMises.h"
+#endif
 
 namespace Marmot::Elements::Registration {
 
   enum DisplacementElementCode {
 
     /* TAG explanation
-     * XXXX
-     * ||||___    4: type of element
-     * |||____    3: active fields
-     * ||_____    2: number of nodes
-     * |______    1: number of nodes
+     * XXXXX
+     * |||||___    5: type of element
+     * ||||____    4: active fields
+     * |||_____    3: number of nodes
+     * ||______    2: number of nodes
+     * |_______    1: variant (optional)
      *
      * active fields:   0: displacement,
      *
@@ -24,6 +32,11 @@ namespace Marmot::Elements::Registration {
      *                  6: 3D red. integration
      *                  7: 2D full integration, plane strain
      *                  8: 2D red. integration, plane strain
+     *
+     * variant:         1: enhanced assumed strain
+     *                  2: 14 point rule of Irons
+     *                  3: bound to LinearElastic
+     *                  4: bound to VonMises
      * */
 
     // Truss 2D
@@ -31,17 +44,36 @@ namespace Marmot::Elements::Registration {
     // Plane stress 2D
     CPS4  = 402,
     CPS8R = 805,
+    // with SimoRifaiEAS5
+    CPS4EAS5 = 10402,
 
     // Plane Strain 2D
     CPE4  = 407,
     CPE8R = 808,
     CPE8  = 807,
+    // with SimoRifaiEAS5
+    CPE4EAS5 = 10407,
 
     // Solid
     C3D8   = 803,
     C3D8R  = 806,
     C3D20  = 2003,
-    C3D20R = 2006
+    C3D20R = 2006,
+    // with DeBorstEAS9
+    C3D8EAS9 = 10803,
+    // with the 14 point rule of Irons
+    C3D20I14 = 22003,
+
+    // bound to LinearElastic
+    CPS4_LINEARELASTIC  = 30402,
+    CPE4_LINEARELASTIC  = 30407,
+    C3D8_LINEARELASTIC  = 30803,
+    C3D20_LINEARELASTIC = 32003,
+    // bound to VonMises
+    CPS4_VONMISES  = 40402,
+    CPE4_VONMISES  = 40407,
+    C3D8_VONMISES  = 40803,
+    C3D20_VONMISES = 42003,
   };
 
   template < class T,
@@ -54,6 +86,7 @@ namespace Marmot::Elements::Registration {
 
   using namespace MarmotLibrary;
   using namespace Marmot::FiniteElement::Quadrature;
+  using namespace Marmot::FiniteElement;
 
   const static bool CPS4_isRegistered = MarmotElementFactory::
     registerElement( "CPS4",
@@ -98,6 +131,32 @@ namespace Marmot::Elements::Registration {
                                                  DisplacementFiniteElement< 3, 8 >::SectionType::Solid );
     } );
 
+  const static bool CPS4EAS5_isRegistered = MarmotElementFactory::
+    registerElement( "CPS4EAS5",
+                     DisplacementElementCode::CPS4EAS5,
+                     makeFactoryFunction< DisplacementFiniteElementEAS< 2, 4, EAS::SimoRifaiEAS5 >,
+                                          FullIntegration,
+                                          DisplacementFiniteElement< 2, 4 >::PlaneStress >() );
+
+  const static bool CPE4EAS5_isRegistered = MarmotElementFactory::
+    registerElement( "CPE4EAS5",
+                     DisplacementElementCode::CPE4EAS5,
+                     makeFactoryFunction< DisplacementFiniteElementEAS< 2, 4, EAS::SimoRifaiEAS5 >,
+                                          FullIntegration,
+                                          DisplacementFiniteElement< 2, 4 >::PlaneStrain >() );
+
+  const static bool C3D8EAS9_isRegistered = MarmotElementFactory::
+    registerElement( "C3D8EAS9",
+                     DisplacementElementCode::C3D8EAS9,
+                     makeFactoryFunction< DisplacementFiniteElementEAS< 3, 8, EAS::DeBorstEAS9 >,
+                                          FullIntegration,
+                                          DisplacementFiniteElement< 3, 8 >::Solid >() );
+
+  const static bool C3D8R_isRegistered = MarmotLibrary::MarmotElementFactory::
+    registerElement( "C3D8R", DisplacementElementCode::C3D8R, []( int elementID ) -> MarmotElement* {
+      return new DisplacementFiniteElementC3D8R( elementID );
+    } );
+
   const static bool C3D20_isRegistered = MarmotLibrary::MarmotElementFactory::
     registerElement( "C3D20", DisplacementElementCode::C3D20, []( int elementID ) -> MarmotElement* {
       return new DisplacementFiniteElement< 3,
@@ -114,12 +173,22 @@ namespace Marmot::Elements::Registration {
                                                      DisplacementFiniteElement< 3, 20 >::SectionType::Solid );
     } );
 
+  const static bool C3D20I14_isRegistered = MarmotElementFactory::
+    registerElement( "C3D20I14",
+                     DisplacementElementCode::C3D20I14,
+                     makeFactoryFunction< DisplacementFiniteElement< 3, 20 >,
+                                          IronsIntegration,
+                                          DisplacementFiniteElement< 3, 20 >::Solid >() );
+
   MarmotElement* generateT2D2( int elementID )
   {
     auto uelT2D2 = std::unique_ptr< MarmotElement >(
       new DisplacementFiniteElement< 1, 2 >( elementID,
                                              Marmot::FiniteElement::Quadrature::IntegrationTypes::FullIntegration,
                                              DisplacementFiniteElement< 1, 2 >::SectionType::UniaxialStress ) );
+    // events are counted by the wrapped element
+    uelT2D2->elementCode = DisplacementElementCode::T2D2;
+
     constexpr static int indicesToBeWrapped[] = { 0, 1 };
     constexpr static int nIndicesToBeWrapped  = 2;
     return new MarmotElementSpatialWrapper( 2, 1, 2, 2, indicesToBeWrapped, nIndicesToBeWrapped, std::move( uelT2D2 ) );
@@ -128,4 +197,68 @@ namespace Marmot::Elements::Registration {
     T2D2_isRegistered = MarmotLibrary::MarmotElementFactory::registerElement( "T2D2",
                                                                               DisplacementElementCode::T2D2,
                                                                               generateT2D2 );
+
+#ifdef MARMOT_ENABLE_BOUND_MATERIAL_ELEMENTS
+  template < int nDim, int nNodes, typename Material >
+  using Bound = DisplacementFiniteElementBoundMaterial< nDim, nNodes, Material >;
+
+  using Materials::LinearElastic;
+  using Materials::VonMisesModel;
+
+  const static bool CPS4_LINEARELASTIC_isRegistered = MarmotElementFactory::
+    registerElement( "CPS4_LINEARELASTIC",
+                     DisplacementElementCode::CPS4_LINEARELASTIC,
+                     makeFactoryFunction< Bound< 2, 4, LinearElastic >,
+                                          FullIntegration,
+                                          DisplacementFiniteElement< 2, 4 >::PlaneStress >() );
+
+  const static bool CPE4_LINEARELASTIC_isRegistered = MarmotElementFactory::
+    registerElement( "CPE4_LINEARELASTIC",
+                     DisplacementElementCode::CPE4_LINEARELASTIC,
+                     makeFactoryFunction< Bound< 2, 4, LinearElastic >,
+                                          FullIntegration,
+                                          DisplacementFiniteElement< 2, 4 >::PlaneStrain >() );
+
+  const static bool C3D8_LINEARELASTIC_isRegistered = MarmotElementFactory::
+    registerElement( "C3D8_LINEARELASTIC",
+                     DisplacementElementCode::C3D8_LINEARELASTIC,
+                     makeFactoryFunction< Bound< 3, 8, LinearElastic >,
+                                          FullIntegration,
+                                          DisplacementFiniteElement< 3, 8 >::Solid >() );
+
+  const static bool C3D20_LINEARELASTIC_isRegistered = MarmotElementFactory::
+    registerElement( "C3D20_LINEARELASTIC",
+                     DisplacementElementCode::C3D20_LINEARELASTIC,
+                     makeFactoryFunction< Bound< 3, 20, LinearElastic >,
+                                          FullIntegration,
+                                          DisplacementFiniteElement< 3, 20 >::Solid >() );
+
+  const static bool CPS4_VONMISES_isRegistered = MarmotElementFactory::
+    registerElement( "CPS4_VONMISES",
+                     DisplacementElementCode::CPS4_VONMISES,
+                     makeFactoryFunction< Bound< 2, 4, VonMisesModel >,
+                                          FullIntegration,
+                                          DisplacementFiniteElement< 2, 4 >::PlaneStress >() );
+
+  const static bool CPE4_VONMISES_isRegistered = MarmotElementFactory::
+    registerElement( "CPE4_VONMISES",
+                     DisplacementElementCode::CPE4_VONMISES,
+                     makeFactoryFunction< Bound< 2, 4, VonMisesModel >,
+                                          FullIntegration,
+                                          DisplacementFiniteElement< 2, 4 >::PlaneStrain >() );
+
+  const static bool C3D8_VONMISES_isRegistered = MarmotElementFactory::
+    registerElement( "C3D8_VONMISES",
+                     DisplacementElementCode::C3D8_VONMISES,
+                     makeFactoryFunction< Bound< 3, 8, VonMisesModel >,
+                                          FullIntegration,
+                                          DisplacementFiniteElement< 3, 8 >::Solid >() );
+
+  const static bool C3D20_VONMISES_isRegistered = MarmotElementFactory::
+    registerElement( "C3D20_VONMISES",
+                     DisplacementElementCode::C3D20_VONMISES,
+                     makeFactoryFunction< Bound< 3, 20, VonMisesModel >,
+                                          FullIntegration,
+                                          DisplacementFiniteElement< 3, 20 >::Solid >() );
+#endif
 } // namespace Marmot::Elements::Registration
@@ -3,3 +3,24 @@ SET(CURR_TEST_SOURCE_DIR "${CMAKE_CURRENT_LIST_DIR}/test")
 
 # Tests for DisplacementFiniteElement
 add_marmot_test("TestDisplacementFiniteElement" "${CURR_TEST_SOURCE_DIR}/TestDisplacementFiniteElement.cpp")
+
+# Tests for ElementBlock< DisplacementFiniteElement >
+add_marmot_test("TestDisplacementFiniteElementBlock" "${CURR_TEST_SOURCE_DIR}/TestDisplacementFiniteElementBlock.cpp")
+
+# Tests for DisplacementFiniteElementC3D8R
+add_marmot_test("TestDisplacementFiniteElementC3D8R" "${CURR_TEST_SOURCE_DIR}/TestDisplacementFiniteElementC3D8R.cpp")
+
+# Tests for DisplacementFiniteElementEAS
+add_marmot_test("TestDisplacementFiniteElementEAS" "${CURR_TEST_SOURCE_DIR}/TestDisplacementFiniteElementEAS.cpp")
+
+# Tests for heap allocations in computeYourself of the registered elements and materials
+add_marmot_test("TestMarmotAllocationGuard" "${CURR_TEST_SOURCE_DIR}/TestMarmotAllocationGuard.cpp")
+
+# Tests for MarmotCheckpoint with DisplacementFiniteElement
+add_marmot_test("TestMarmotCheckpoint" "${CURR_TEST_SOURCE_DIR}/TestMarmotCheckpoint.cpp")
+
+# Tests for MarmotElementExecutor with DisplacementFiniteElement
+add_marmot_test("TestMarmotElementExecutor" "${CURR_TEST_SOURCE_DIR}/TestMarmotElementExecutor.cpp")
+
+# Tests for MarmotEnsightWriter with DisplacementFiniteElement
+add_marmot_test("TestMarmotEnsightWriter" "${CURR_TEST_SOURCE_DIR}/TestMarmotEnsightWriter.cpp")
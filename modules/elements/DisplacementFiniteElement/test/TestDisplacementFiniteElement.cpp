@@ -1,6 +1,8 @@
 #include "Marmot/DisplacementFiniteElement.h"
+#include "Marmot/DisplacementFiniteElementBoundMaterial.h"
 #include "Marmot/MarmotElementProperty.h"
 #include "Marmot/MarmotFiniteElement.h"
+#include "Marmot/MarmotMaterialRegistrationHelper.h"
 #include "Marmot/MarmotTesting.h"
 
 using namespace Marmot;
@@ -227,11 +229,397 @@ void testInitializeYourselfAndShapeFunctions()
   throwExceptionOnFailure( checkIfEqual( qp0.B( 2, 3 ), expected_dN2dx ), "Incorrect B(2,3) for QP0." );
 }
 
+/* Initialize an element and compare its kinematics with those computed at each quadrature point separately. */
+template < int nDim, int nNodes >
+bool initializeAndCompareKinematics( const std::vector< double >&                                 nodeCoordinates,
+                                     typename DisplacementFiniteElement< nDim, nNodes >::SectionType sectionType )
+{
+  using Element = DisplacementFiniteElement< nDim, nNodes >;
+
+  const auto intType = FiniteElement::Quadrature::IntegrationTypes::FullIntegration;
+
+  Element element( 1, intType, sectionType );
+  element.assignNodeCoordinates( nodeCoordinates.data() );
+
+  const static std::vector< double > matProps = { 10000.0, 0.2, 1 };
+  MarmotMaterialSection              materialSection( 1, matProps.data(), matProps.size() );
+  const static std::vector< double > elPropsVec = { 1.0 };
+  ElementProperties                  elProps( elPropsVec.data(), elPropsVec.size() );
+
+  element.assignProperty( elProps );
+  element.assignProperty( materialSection );
+
+  std::vector< double > stateVars( element.getNumberOfRequiredStateVars(), 0.0 );
+  element.assignStateVars( stateVars.data(), stateVars.size() );
+  element.initializeYourself();
+
+  MarmotGeometryElement< nDim, nNodes > geometry;
+  geometry.assignNodeCoordinates( nodeCoordinates.data() );
+
+  for ( size_t i = 0; i < element.qps.size(); i++ ) {
+    const auto& qp    = element.qps[i];
+    const auto  dNdXi = geometry.dNdXi( qp.xi );
+    const auto  J     = geometry.Jacobian( dNdXi );
+
+    throwExceptionOnFailure( checkIfEqual( qp.detJ, J.determinant(), 1e-14 ), "Incorrect detJ." );
+    throwExceptionOnFailure( checkIfEqual( Eigen::MatrixXd( qp.B ),
+                                           Eigen::MatrixXd( geometry.B( geometry.dNdX( dNdXi, J.inverse() ) ) ),
+                                           1e-12 ),
+                             "Incorrect B." );
+  }
+
+  return element.hasAffineGeometry;
+}
+
+void testAffineGeometry()
+{
+  using Quad4  = DisplacementFiniteElement< 2, 4 >;
+  using Tetra4 = DisplacementFiniteElement< 3, 4 >;
+  using Hexa8  = DisplacementFiniteElement< 3, 8 >;
+
+  // parallelogram and trapezoid
+  throwExceptionOnFailure( initializeAndCompareKinematics< 2, 4 >( { 0, 0, 2, 0, 2.5, 1, 0.5, 1 },
+                                                                   Quad4::SectionType::PlaneStrain ),
+                           "Parallelogram not detected as affine." );
+  throwExceptionOnFailure( !initializeAndCompareKinematics< 2, 4 >( { 0, 0, 2, 0, 1.5, 1, 0.5, 1 },
+                                                                    Quad4::SectionType::PlaneStrain ),
+                           "Trapezoid detected as affine." );
+
+  // straight-sided tetrahedron, with constant kinematics
+  throwExceptionOnFailure( initializeAndCompareKinematics< 3, 4 >( { 0.1, 0, 0, 1, 0.2, 0, 0.3, 1, 0, 0, 0.1, 2 },
+                                                                   Tetra4::SectionType::Solid ),
+                           "Tetrahedron not detected as affine." );
+
+  // sheared and distorted hexahedra
+  std::vector< double > hexa8 = { 0, 0, 0, 2, 0, 0, 2.5, 1, 0, 0.5, 1, 0, 0, 0, 1, 2, 0, 1, 2.5, 1, 1, 0.5, 1, 1 };
+  throwExceptionOnFailure( initializeAndCompareKinematics< 3, 8 >( hexa8, Hexa8::SectionType::Solid ),
+                           "Sheared hexahedron not detected as affine." );
+  hexa8[20] += 0.1;
+  throwExceptionOnFailure( !initializeAndCompareKinematics< 3, 8 >( hexa8, Hexa8::SectionType::Solid ),
+                           "Distorted hexahedron detected as affine." );
+}
+
+void testInertia()
+{
+  using Hexa20       = DisplacementFiniteElement< 3, 20 >;
+  const auto intType = FiniteElement::Quadrature::IntegrationTypes::FullIntegration;
+
+  // a sheared 2 x 1 x 1 brick
+  const double*         X = FiniteElement::ReferenceElement::getTable< 3, 20 >( intType ).nodeCoordinates;
+  std::vector< double > nodeCoordinates( 60 );
+  for ( int a = 0; a < 20; a++ ) {
+    nodeCoordinates[3 * a]     = 1 + X[3 * a] + 0.2 * X[3 * a + 1];
+    nodeCoordinates[3 * a + 1] = 0.5 * X[3 * a + 1];
+    nodeCoordinates[3 * a + 2] = 0.5 * X[3 * a + 2];
+  }
+
+  const double density = 7.85;
+  const double mass    = density * 2.0;
+
+  Hexa20 element( 1, intType, Hexa20::Solid );
+  element.assignNodeCoordinates( nodeCoordinates.data() );
+
+  const static std::vector< double > matProps = { 210000., 0.3, density };
+  MarmotMaterialSection              materialSection( 1, matProps.data(), matProps.size() );
+  const static std::vector< double > elPropsVec = { 1.0 };
+  ElementProperties                  elProps( elPropsVec.data(), elPropsVec.size() );
+  element.assignProperty( elProps );
+  element.assignProperty( materialSection );
+
+  std::vector< double > stateVars( element.getNumberOfRequiredStateVars(), 0.0 );
+  element.assignStateVars( stateVars.data(), stateVars.size() );
+  element.initializeYourself();
+
+  // consistent mass matrix, compared with the dense product at each quadrature point
+  MarmotGeometryElement< 3, 20 > geometry;
+  Eigen::MatrixXd                MReference = Eigen::MatrixXd::Zero( 60, 60 );
+  for ( const auto& qp : element.qps ) {
+    const auto NB = geometry.NB( geometry.N( qp.xi ) );
+    MReference += NB.transpose() * NB * qp.detJ * qp.weight * density;
+  }
+
+  Eigen::MatrixXd M( 60, 60 );
+  element.computeConsistentInertia( M.data() );
+  throwExceptionOnFailure( checkIfEqual( M, MReference, 1e-14 ), "Incorrect consistent mass matrix." );
+
+  // the cached mass matrix is reused
+  Eigen::MatrixXd MCached( 60, 60 );
+  element.computeConsistentInertia( MCached.data() );
+  throwExceptionOnFailure( checkIfEqual( MCached, MReference, 1e-14 ), "Incorrect cached mass matrix." );
+
+  Eigen::MatrixXd m( 60, 1 );
+  element.computeLumpedInertia( m.data() );
+  throwExceptionOnFailure( checkIfEqual( m, Eigen::MatrixXd( MReference.rowwise().sum() ), 1e-14 ),
+                           "Incorrect row sum lumped masses." );
+
+  // HRZ lumping preserves the total mass and results in positive masses
+  element.lumpingScheme = Hexa20::HRZLumping;
+  element.computeLumpedInertia( m.data() );
+  throwExceptionOnFailure( checkIfEqual( m.sum(), 3 * mass, 1e-12 ), "Incorrect total mass." );
+  throwExceptionOnFailure( m.minCoeff() > 0, "Non positive HRZ lumped masses." );
+  throwExceptionOnFailure( checkIfEqual( m( 0 ) / m( 3 * 8 ), MReference( 0, 0 ) / MReference( 3 * 8, 3 * 8 ), 1e-12 ),
+                           "HRZ lumped masses not proportional to the diagonal." );
+
+  // without density, e.g., in quasi-static sections, the HRZ lumped masses vanish
+  const static std::vector< double > matPropsWithoutDensity = { 210000., 0.3, 0. };
+  Hexa20                             elementWithoutDensity( 2, intType, Hexa20::Solid );
+  elementWithoutDensity.assignNodeCoordinates( nodeCoordinates.data() );
+  elementWithoutDensity.assignProperty( elProps );
+  elementWithoutDensity.assignProperty(
+    MarmotMaterialSection( 1, matPropsWithoutDensity.data(), matPropsWithoutDensity.size() ) );
+  elementWithoutDensity.assignStateVars( stateVars.data(), stateVars.size() );
+  elementWithoutDensity.initializeYourself();
+  elementWithoutDensity.lumpingScheme = Hexa20::HRZLumping;
+  elementWithoutDensity.computeLumpedInertia( m.data() );
+  throwExceptionOnFailure( m.isZero( 0.0 ), "Non zero HRZ lumped masses without density." );
+}
+
+void testDynamicTangent()
+{
+  using Hexa8        = DisplacementFiniteElement< 3, 8 >;
+  const auto intType = FiniteElement::Quadrature::IntegrationTypes::FullIntegration;
+
+  const std::vector< double > nodeCoordinates = { 0, 0, 0, 2, 0, 0, 2.5, 1, 0, 0.5, 1, 0,
+                                                  0, 0, 1, 2, 0, 1, 2.5, 1, 1, 0.5, 1, 1 };
+
+  const static std::vector< double > matProps = { 210000., 0.3, 7.85 };
+  MarmotMaterialSection              materialSection( 1, matProps.data(), matProps.size() );
+  const static std::vector< double > elPropsVec = { 1.0 };
+  ElementProperties                  elProps( elPropsVec.data(), elPropsVec.size() );
+
+  // one element for the fused evaluation, and one for the separate evaluations
+  std::vector< std::unique_ptr< Hexa8 > > elements;
+  std::vector< double >                   stateVars( 2 * 8 * 12, 0.0 );
+  for ( int e = 0; e < 2; e++ ) {
+    auto element = std::make_unique< Hexa8 >( e + 1, intType, Hexa8::Solid );
+    element->assignNodeCoordinates( nodeCoordinates.data() );
+    element->assignProperty( elProps );
+    element->assignProperty( materialSection );
+    throwExceptionOnFailure( element->getNumberOfRequiredStateVars() * 2 <= int( stateVars.size() ),
+                             "Unexpected number of state variables." );
+    element->assignStateVars( &stateVars[e * element->getNumberOfRequiredStateVars()],
+                              element->getNumberOfRequiredStateVars() );
+    element->initializeYourself();
+    elements.push_back( std::move( element ) );
+  }
+
+  // generalized-alpha with a spectral radius of 0.8 and Rayleigh damping
+  const double                     rho = 0.8;
+  MarmotElement::NewmarkParameters parameters;
+  parameters.alphaM            = ( 2 * rho - 1 ) / ( rho + 1 );
+  parameters.alphaF            = rho / ( rho + 1 );
+  parameters.gamma             = 0.5 - parameters.alphaM + parameters.alphaF;
+  parameters.beta              = 0.25 * std::pow( 1 - parameters.alphaM + parameters.alphaF, 2 );
+  parameters.rayleighMass      = 0.1;
+  parameters.rayleighStiffness = 1e-4;
+
+  const double    dT     = 1e-3;
+  const double    time[] = { 0.0, 0.0 };
+  Eigen::VectorXd dQ( 24 ), V( 24 ), A( 24 );
+  for ( int i = 0; i < 24; i++ ) {
+    dQ( i ) = 1e-4 * std::sin( 1.0 + i );
+    V( i )  = 0.1 * std::cos( 2.0 + i );
+    A( i )  = 10.0 * std::sin( 3.0 + i );
+  }
+
+  Eigen::MatrixXd P      = Eigen::MatrixXd::Zero( 24, 1 );
+  Eigen::MatrixXd K      = Eigen::MatrixXd::Zero( 24, 24 );
+  double          pNewDT = 1.0;
+  elements[0]->computeYourselfDynamic( dQ.data(),
+                                       dQ.data(),
+                                       V.data(),
+                                       A.data(),
+                                       P.data(),
+                                       K.data(),
+                                       time,
+                                       dT,
+                                       pNewDT,
+                                       parameters );
+
+  // reference from the static residual and tangent, and the dense mass matrix
+  Eigen::VectorXd PStatic = Eigen::VectorXd::Zero( 24 );
+  Eigen::MatrixXd KStatic = Eigen::MatrixXd::Zero( 24, 24 );
+  Eigen::MatrixXd M( 24, 24 );
+  elements[1]->computeYourself( dQ.data(), dQ.data(), PStatic.data(), KStatic.data(), time, dT, pNewDT );
+  elements[1]->computeConsistentInertia( M.data() );
+
+  const double          beta = parameters.beta, gamma = parameters.gamma;
+  const Eigen::VectorXd ANew = ( dQ - dT * V - 0.5 * dT * dT * ( 1 - 2 * beta ) * A ) / ( beta * dT * dT );
+  const Eigen::VectorXd VNew = V + dT * ( ( 1 - gamma ) * A + gamma * ANew );
+  const Eigen::MatrixXd C    = parameters.rayleighMass * M + parameters.rayleighStiffness * KStatic;
+
+  const double          c0 = 1. / ( beta * dT * dT ), c1 = gamma / ( beta * dT );
+  const Eigen::MatrixXd PReference = -M * ( ( 1 - parameters.alphaM ) * ANew + parameters.alphaM * A ) +
+                                     ( 1 - parameters.alphaF ) * ( PStatic - C * VNew );
+  const Eigen::MatrixXd KReference = ( 1 - parameters.alphaF ) * ( KStatic + c1 * C ) +
+                                     ( 1 - parameters.alphaM ) * c0 * M;
+
+  throwExceptionOnFailure( pNewDT == 1.0, "Unexpected cutback." );
+  throwExceptionOnFailure( checkIfEqual( P, PReference, 1e-8 * PReference.norm() ), "Incorrect dynamic residual." );
+  throwExceptionOnFailure( checkIfEqual( K, KReference, 1e-10 * KReference.norm() ), "Incorrect dynamic tangent." );
+}
+
+/* A linear elastic material, which signals a cutback only by its status if the strain increment exceeds a limit. */
+class CutbackMaterial : public MarmotMaterialHypoElastic {
+public:
+  using MarmotMaterialHypoElastic::MarmotMaterialHypoElastic;
+
+  int getNumberOfRequiredStateVars() override { return 0; }
+
+  StateView getStateView( const std::string& stateName ) override { return { nullptr, 0 }; }
+
+  void computeStress( double*       stress_,
+                      double*       dStressDDStrain_,
+                      const double* dStrain_,
+                      const double* timeOld,
+                      const double  dT,
+                      double&       pNewDT ) override
+  {
+    Eigen::Map< Marmot::Vector6d >       stress( stress_ );
+    Eigen::Map< Marmot::Matrix6d >       C( dStressDDStrain_ );
+    Eigen::Map< const Marmot::Vector6d > dStrain( dStrain_ );
+
+    C = materialProperties[0] * Marmot::Matrix6d::Identity();
+    stress += C * dStrain;
+
+    if ( dStrain.norm() > materialProperties[1] )
+      requestCutback( Status::InnerNewtonNotConverged, 0.3 );
+  }
+};
+
+/* Register the CutbackMaterial on the first request, after the static initialization of the factory. */
+int getCutbackMaterialCode()
+{
+  const static int  code = 999999;
+  const static bool isRegistered = MarmotLibrary::MarmotMaterialFactory::
+    registerMaterial( code, "CUTBACKTESTMATERIAL", makeDefaultMarmotMaterialFactoryFunction< CutbackMaterial >() );
+  return code;
+}
+
+void testCutbackStatus()
+{
+  using Quad4        = DisplacementFiniteElement< 2, 4 >;
+  const auto intType = FiniteElement::Quadrature::IntegrationTypes::FullIntegration;
+
+  const std::vector< double > nodeCoordinates = { 0, 0, 1, 0, 1, 1, 0, 1 };
+  const std::vector< double > elPropsVec      = { 1.0 };
+  ElementProperties           elProps( elPropsVec.data(), elPropsVec.size() );
+
+  // a displacement of the third node, such that the strain increments differ at the quadrature points
+  const std::vector< double > dQ     = { 0, 0, 0, 0, 1e-3, 0, 0, 0 };
+  const double                time[] = { 0.0, 0.0 };
+
+  auto compute = [&]( const std::vector< double >& matProps, std::vector< double >& strains, double& pNewDT ) {
+    Quad4 element( 1, intType, Quad4::PlaneStrain );
+    element.assignNodeCoordinates( nodeCoordinates.data() );
+    element.assignProperty( elProps );
+    element.assignProperty( MarmotMaterialSection( getCutbackMaterialCode(), matProps.data(), matProps.size() ) );
+
+    std::vector< double > stateVars( element.getNumberOfRequiredStateVars(), 0.0 );
+    element.assignStateVars( stateVars.data(), stateVars.size() );
+    element.initializeYourself();
+
+    Eigen::VectorXd P = Eigen::VectorXd::Zero( 8 );
+    Eigen::MatrixXd K = Eigen::MatrixXd::Zero( 8, 8 );
+    pNewDT            = 1.0;
+    element.computeYourself( dQ.data(), dQ.data(), P.data(), K.data(), time, 1.0, pNewDT );
+
+    for ( int qp = 0; qp < element.getNumberOfQuadraturePoints(); qp++ ) {
+      const Eigen::Map< const Marmot::Vector6d > strain( element.getStateView( "strain", qp ).stateLocation );
+      strains.push_back( strain.norm() );
+    }
+
+    return element.getStatus();
+  };
+
+  // without a limit, all quadrature points succeed
+  std::vector< double > strains;
+  double                pNewDT;
+  Status                status = compute( { 1000.0, 1.0 }, strains, pNewDT );
+  throwExceptionOnFailure( status.isSuccess() && pNewDT == 1.0, "Unexpected cutback." );
+
+  // with a limit below the largest strain increment, the cutback is signalled at its quadrature point
+  std::vector< double > sortedStrains = strains;
+  std::sort( sortedStrains.begin(), sortedStrains.end() );
+
+  const int    failingQp = std::max_element( strains.begin(), strains.end() ) - strains.begin();
+  const double limit     = 0.5 * ( sortedStrains[2] + sortedStrains[3] );
+
+  std::vector< double > unused;
+  status = compute( { 1000.0, limit }, unused, pNewDT );
+  throwExceptionOnFailure( pNewDT == 0.3, "Cutback by the material status not signalled by pNewDT." );
+  throwExceptionOnFailure( status.reason == Status::InnerNewtonNotConverged, "Incorrect reason of the cutback." );
+  throwExceptionOnFailure( status.suggestedDTFactor == 0.3, "Incorrect suggested time step factor." );
+  throwExceptionOnFailure( status.quadraturePoint == failingQp, "Incorrect failing quadrature point." );
+}
+
+void testBoundMaterial()
+{
+  using Quad4        = DisplacementFiniteElement< 2, 4 >;
+  using BoundQuad4   = DisplacementFiniteElementBoundMaterial< 2, 4, CutbackMaterial >;
+  const auto intType = FiniteElement::Quadrature::IntegrationTypes::FullIntegration;
+
+  const std::vector< double > nodeCoordinates = { 0, 0, 2, 0, 2.5, 1, 0.5, 1 };
+  const std::vector< double > elPropsVec      = { 1.0 };
+  const std::vector< double > matProps        = { 1000.0, 1.0 };
+  ElementProperties           elProps( elPropsVec.data(), elPropsVec.size() );
+  MarmotMaterialSection       materialSection( getCutbackMaterialCode(), matProps.data(), matProps.size() );
+
+  const std::vector< double > dQ     = { 0, 0, 1e-3, 0, 2e-3, 1e-3, 0, -1e-3 };
+  const double                time[] = { 0.0, 0.0 };
+
+  for ( auto sectionType : { Quad4::PlaneStress, Quad4::PlaneStrain } ) {
+    Quad4      element( 1, intType, sectionType );
+    BoundQuad4 boundElement( 2, intType, sectionType );
+
+    std::vector< std::vector< double > > stateVars;
+    for ( MarmotElement* e : std::vector< MarmotElement* >{ &element, &boundElement } ) {
+      e->assignNodeCoordinates( nodeCoordinates.data() );
+      e->assignProperty( elProps );
+      e->assignProperty( materialSection );
+      stateVars.emplace_back( e->getNumberOfRequiredStateVars(), 0.0 );
+      e->assignStateVars( stateVars.back().data(), stateVars.back().size() );
+      e->initializeYourself();
+    }
+
+    Eigen::VectorXd P = Eigen::VectorXd::Zero( 8 ), PBound = Eigen::VectorXd::Zero( 8 );
+    Eigen::MatrixXd K = Eigen::MatrixXd::Zero( 8, 8 ), KBound = Eigen::MatrixXd::Zero( 8, 8 );
+    double          pNewDT = 1.0;
+
+    element.computeYourself( dQ.data(), dQ.data(), P.data(), K.data(), time, 1.0, pNewDT );
+    boundElement.computeYourself( dQ.data(), dQ.data(), PBound.data(), KBound.data(), time, 1.0, pNewDT );
+
+    throwExceptionOnFailure( pNewDT == 1.0, "Unexpected cutback." );
+    throwExceptionOnFailure( checkIfEqual( Eigen::MatrixXd( PBound ), Eigen::MatrixXd( P ), 1e-12 ),
+                             "Internal forces of bound and unbound element differ." );
+    throwExceptionOnFailure( checkIfEqual( KBound, K, 1e-12 ), "Stiffness of bound and unbound element differ." );
+  }
+
+  // materials of another type are rejected
+  const std::vector< double > linearElasticProps = { 1000.0, 0.2 };
+  BoundQuad4                  boundElement( 3, intType, Quad4::PlaneStrain );
+  boundElement.assignNodeCoordinates( nodeCoordinates.data() );
+
+  bool isRejected = false;
+  try {
+    boundElement.assignProperty( MarmotMaterialSection( 1, linearElasticProps.data(), linearElasticProps.size() ) );
+  }
+  catch ( const std::invalid_argument& ) {
+    isRejected = true;
+  }
+  throwExceptionOnFailure( isRejected, "Material of another type not rejected." );
+}
+
 int main()
 {
   auto tests = std::vector< std::function< void() > >{ testInstantiationAndBasicProperties,
                                                        testStiffnessMatrixCalculationPlaneStress,
-                                                       testInitializeYourselfAndShapeFunctions };
+                                                       testInitializeYourselfAndShapeFunctions,
+                                                       testAffineGeometry,
+                                                       testInertia,
+                                                       testDynamicTangent,
+                                                       testCutbackStatus,
+                                                       testBoundMaterial };
 
   executeTestsAndCollectExceptions( tests );
 
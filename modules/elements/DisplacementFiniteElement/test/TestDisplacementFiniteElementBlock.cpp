@@ -0,0 +1,295 @@
+#include "Marmot/DisplacementFiniteElement.h"
+#include "Marmot/DisplacementFiniteElementBlock.h"
+#include "Marmot/MarmotElementProperty.h"
+#include "Marmot/MarmotTesting.h"
+
+using namespace Marmot;
+using namespace Marmot::Elements;
+using namespace Marmot::Testing;
+
+/* Compute a block of elements and the same elements individually, and compare the results. */
+template < int nDim, int nNodes >
+void compareBlockWithElements( const std::vector< double >&                                 nodeCoordinates,
+                               typename DisplacementFiniteElement< nDim, nNodes >::SectionType sectionType,
+                               const std::vector< double >&                                 matProps,
+                               int                                                          matCode )
+{
+  using Element = DisplacementFiniteElement< nDim, nNodes >;
+  using Block   = ElementBlock< Element >;
+
+  constexpr int nDof      = Element::sizeLoadVector;
+  const int     nElements = nodeCoordinates.size() / Element::nCoordinates;
+  const auto    intType   = FiniteElement::Quadrature::IntegrationTypes::FullIntegration;
+
+  std::vector< int > elementLabels( nElements );
+  for ( int e = 0; e < nElements; e++ )
+    elementLabels[e] = e + 1;
+
+  const std::vector< double > elPropsVec = { 0.5 };
+  ElementProperties           elProps( elPropsVec.data(), elPropsVec.size() );
+  MarmotMaterialSection       materialSection( matCode, matProps.data(), matProps.size() );
+
+  Block block( elementLabels, intType, sectionType );
+  block.assignNodeCoordinates( nodeCoordinates.data() );
+  block.assignProperty( elProps );
+  block.assignProperty( materialSection );
+
+  std::vector< double > blockStateVars( nElements * block.getNumberOfRequiredStateVars(), 0.0 );
+  block.assignStateVars( blockStateVars.data(), block.getNumberOfRequiredStateVars() );
+  block.initializeYourself();
+  block.setInitialConditions( MarmotElement::MarmotMaterialInitialization, nullptr );
+
+  std::vector< std::unique_ptr< Element > > elements;
+  std::vector< double >                     elementStateVars( blockStateVars.size(), 0.0 );
+  for ( int e = 0; e < nElements; e++ ) {
+    auto element = std::make_unique< Element >( elementLabels[e], intType, sectionType );
+    element->assignNodeCoordinates( &nodeCoordinates[e * Element::nCoordinates] );
+    element->assignProperty( elProps );
+    element->assignProperty( materialSection );
+
+    throwExceptionOnFailure( element->getNumberOfRequiredStateVars() == block.getNumberOfRequiredStateVars(),
+                             "Block and element require different numbers of state variables." );
+
+    element->assignStateVars( &elementStateVars[e * block.getNumberOfRequiredStateVars()],
+                              block.getNumberOfRequiredStateVars() );
+    element->initializeYourself();
+    element->setInitialConditions( MarmotElement::MarmotMaterialInitialization, nullptr );
+    elements.push_back( std::move( element ) );
+  }
+
+  throwExceptionOnFailure( materialSection.sectionData.use_count() ==
+                             1 + 2 * nElements * block.getNumberOfQuadraturePoints(),
+                           "Section data not shared by the materials of block and elements." );
+
+  Eigen::VectorXd dQ( nElements * nDof );
+  for ( int i = 0; i < dQ.size(); i++ )
+    dQ( i ) = 1e-4 * std::sin( 1.0 + i );
+  const Eigen::VectorXd QTotal = dQ;
+  const double          time[] = { 0.0, 0.0 };
+
+  Eigen::VectorXd PBlock      = Eigen::VectorXd::Zero( nElements * nDof );
+  Eigen::MatrixXd KBlock      = Eigen::MatrixXd::Zero( nDof, nElements * nDof );
+  double          pNewDTBlock = 1.0;
+  block.computeYourself( QTotal.data(), dQ.data(), PBlock.data(), KBlock.data(), time, 1.0, pNewDTBlock );
+
+  throwExceptionOnFailure( pNewDTBlock == 1.0, "Unexpected cutback in block." );
+
+  for ( int e = 0; e < nElements; e++ ) {
+    Eigen::MatrixXd P      = Eigen::MatrixXd::Zero( nDof, 1 );
+    Eigen::MatrixXd K      = Eigen::MatrixXd::Zero( nDof, nDof );
+    double          pNewDT = 1.0;
+    elements[e]->computeYourself( &QTotal( e * nDof ), &dQ( e * nDof ), P.data(), K.data(), time, 1.0, pNewDT );
+
+    throwExceptionOnFailure( checkIfEqual( Eigen::MatrixXd( PBlock.segment( e * nDof, nDof ) ), P, 1e-12 ),
+                             "Internal forces of block and element differ." );
+    throwExceptionOnFailure( checkIfEqual( Eigen::MatrixXd( KBlock.middleCols( e * nDof, nDof ) ), K, 1e-8 ),
+                             "Stiffness matrices of block and element differ." );
+
+    for ( int qp = 0; qp < block.getNumberOfQuadraturePoints(); qp++ ) {
+      const StateView blockStress   = block.getStateView( "stress", e, qp );
+      const StateView elementStress = elements[e]->getStateView( "stress", qp );
+      for ( int i = 0; i < 6; i++ )
+        throwExceptionOnFailure( checkIfEqual( blockStress.stateLocation[i], elementStress.stateLocation[i], 1e-12 ),
+                                 "Stress states of block and element differ." );
+    }
+  }
+
+  for ( size_t i = 0; i < blockStateVars.size(); i++ )
+    throwExceptionOnFailure( checkIfEqual( blockStateVars[i], elementStateVars[i], 1e-12 ),
+                             "State variables of block and elements differ." );
+
+  // bulk extraction of the strain and the quadrature point coordinates, compared with the per point accessors
+  const int                     nQps = nElements * block.getNumberOfQuadraturePoints();
+  std::vector< MarmotElement* > elementPointers;
+  for ( const auto& element : elements )
+    elementPointers.push_back( element.get() );
+
+  const MarmotElement::StateFieldAccessor strain = elements[0]->resolveStateField( "strain" );
+  throwExceptionOnFailure( strain.offset >= 0 && strain.size == 6, "Strain not resolved by an offset." );
+
+  Eigen::MatrixXd blockStrain( 6, nQps ), elementStrain( 6, nQps ), referenceStrain( 6, nQps );
+  block.gatherStateField( "strain", blockStrain.data() );
+  MarmotElement::gatherStateField( elementPointers.data(), nElements, strain, elementStrain.data() );
+
+  Eigen::MatrixXd blockCoordinates( nDim, nQps ), elementCoordinates( nDim, nQps ), referenceCoordinates( nDim, nQps );
+  block.gatherCoordinatesAtQuadraturePoints( blockCoordinates.data() );
+  MarmotElement::gatherCoordinatesAtQuadraturePoints( elementPointers.data(), nElements, elementCoordinates.data() );
+
+  for ( int e = 0; e < nElements; e++ ) {
+    const auto qpCoordinates = elements[e]->getCoordinatesAtQuadraturePoints();
+    for ( int qp = 0; qp < block.getNumberOfQuadraturePoints(); qp++ ) {
+      const int i = e * block.getNumberOfQuadraturePoints() + qp;
+      for ( int j = 0; j < 6; j++ )
+        referenceStrain( j, i ) = elements[e]->getStateView( "strain", qp ).stateLocation[j];
+      for ( int j = 0; j < nDim; j++ )
+        referenceCoordinates( j, i ) = qpCoordinates[qp][j];
+    }
+  }
+
+  throwExceptionOnFailure( checkIfEqual( blockStrain, referenceStrain, 1e-14 ), "Incorrect gathered block strains." );
+  throwExceptionOnFailure( checkIfEqual( elementStrain, referenceStrain, 1e-14 ), "Incorrect gathered strains." );
+  throwExceptionOnFailure( checkIfEqual( blockCoordinates, referenceCoordinates, 1e-12 ),
+                           "Incorrect gathered block coordinates." );
+  throwExceptionOnFailure( checkIfEqual( elementCoordinates, referenceCoordinates, 1e-12 ),
+                           "Incorrect gathered coordinates." );
+}
+
+void testQuad4PlaneStressBlock()
+{
+  // two distorted quadrilaterals
+  const std::vector< double > nodeCoordinates = { 0.0, 0.0, 6.0, 0.0, 8.0, 6.0, 2.0, 6.0,
+                                                  6.0, 0.0, 9.0, 1.0, 9.0, 5.0, 8.0, 6.0 };
+
+  compareBlockWithElements< 2, 4 >( nodeCoordinates,
+                                    DisplacementFiniteElement< 2, 4 >::SectionType::PlaneStress,
+                                    { 10000.0, 0.2, 1 },
+                                    1 );
+}
+
+void testHexa8SolidBlock()
+{
+  // unit cube and a sheared cube
+  const std::vector< double > nodeCoordinates = { 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1,
+                                                  0, 0, 0, 2, 0, 0, 2.5, 1, 0, 0.5, 1, 0, 0, 0, 1, 2, 0, 1, 2.5, 1, 1,
+                                                  0.5, 1, 1 };
+
+  // von Mises plasticity with a small yield stress, such that the return mapping is active
+  compareBlockWithElements< 3, 8 >( nodeCoordinates,
+                                    DisplacementFiniteElement< 3, 8 >::SectionType::Solid,
+                                    { 210000., 0.3, 5., 2100., 0., 20. },
+                                    2 );
+}
+
+/* Copy the node coordinates of an element n times, with each copy distorted differently. */
+std::vector< double > distortedCopies( const std::vector< double >& elementCoordinates, int nDim, int n )
+{
+  std::vector< double > nodeCoordinates;
+  for ( int e = 0; e < n; e++ )
+    for ( size_t i = 0; i < elementCoordinates.size(); i++ )
+      nodeCoordinates.push_back( elementCoordinates[i] * ( 1.0 + 0.1 * ( i % nDim ) * e ) + 0.05 * std::sin( e + i ) );
+  return nodeCoordinates;
+}
+
+void testQuad4PlaneStrainBatches()
+{
+  // one batch and one remaining element
+  const std::vector< double > nodeCoordinates = distortedCopies( { 0, 0, 1, 0, 1, 1, 0, 1 }, 2, 5 );
+
+  compareBlockWithElements< 2, 4 >( nodeCoordinates,
+                                    DisplacementFiniteElement< 2, 4 >::SectionType::PlaneStrain,
+                                    { 210000., 0.3, 5., 2100., 0., 20. },
+                                    2 );
+}
+
+void testTetra4SolidBatches()
+{
+  // one batch and two remaining elements
+  const std::vector< double > nodeCoordinates = distortedCopies( { 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1 }, 3, 6 );
+
+  compareBlockWithElements< 3, 4 >( nodeCoordinates,
+                                    DisplacementFiniteElement< 3, 4 >::SectionType::Solid,
+                                    { 210000., 0.3, 5., 2100., 0., 20. },
+                                    2 );
+}
+
+void testHexa8SolidBatches()
+{
+  // one batch and one remaining element
+  const std::vector< double > nodeCoordinates = distortedCopies( { 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0,
+                                                                   0, 0, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1 },
+                                                                 3,
+                                                                 5 );
+
+  compareBlockWithElements< 3, 8 >( nodeCoordinates,
+                                    DisplacementFiniteElement< 3, 8 >::SectionType::Solid,
+                                    { 210000., 0.3, 5., 2100., 0., 20. },
+                                    2 );
+}
+
+void testHexa8DoubleBufferedBatches()
+{
+  // with a pair of state variable arrays, repeated computations start from the old state without restoring it
+  using Element = DisplacementFiniteElement< 3, 8 >;
+  using Block   = ElementBlock< Element >;
+
+  constexpr int               nDof            = Element::sizeLoadVector;
+  const int                   nElements       = 5;
+  const std::vector< double > nodeCoordinates = distortedCopies( { 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0,
+                                                                   0, 0, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1 },
+                                                                 3,
+                                                                 nElements );
+  const std::vector< double > matProps        = { 210000., 0.3, 5., 2100., 0., 20. };
+  const std::vector< double > elPropsVec      = { 1.0 };
+  const std::vector< int >    elementLabels   = { 1, 2, 3, 4, 5 };
+
+  auto createBlock = [&]() {
+    auto block = std::make_unique< Block >( elementLabels,
+                                            FiniteElement::Quadrature::IntegrationTypes::FullIntegration,
+                                            Element::SectionType::Solid );
+    block->assignNodeCoordinates( nodeCoordinates.data() );
+    block->assignProperty( ElementProperties( elPropsVec.data(), elPropsVec.size() ) );
+    block->assignProperty( MarmotMaterialSection( 2, matProps.data(), matProps.size() ) );
+    return block;
+  };
+
+  auto single   = createBlock();
+  auto buffered = createBlock();
+
+  const int             nStateVars = single->getNumberOfRequiredStateVars();
+  std::vector< double > stateVars( nElements * nStateVars, 0.0 );
+  std::vector< double > stateVarsBuffered = stateVars, stateVarsOld = stateVars;
+  single->assignStateVars( stateVars.data(), nStateVars );
+  buffered->assignStateVarsDoubleBuffered( stateVarsBuffered.data(), stateVarsOld.data(), nStateVars );
+
+  for ( auto* block : { single.get(), buffered.get() } ) {
+    block->initializeYourself();
+    block->setInitialConditions( MarmotElement::MarmotMaterialInitialization, nullptr );
+  }
+
+  Eigen::VectorXd dQ( nElements * nDof );
+  for ( int i = 0; i < dQ.size(); i++ )
+    dQ( i ) = 1e-3 * std::sin( 1.0 + i );
+  const double time[] = { 0.0, 0.0 };
+
+  auto compute = [&]( Block& block, const Eigen::VectorXd& dQ_, Eigen::VectorXd& P ) {
+    Eigen::MatrixXd K      = Eigen::MatrixXd::Zero( nDof, nElements * nDof );
+    double          pNewDT = 1.0;
+    P                      = Eigen::VectorXd::Zero( nElements * nDof );
+    block.computeYourself( dQ_.data(), dQ_.data(), P.data(), K.data(), time, 1.0, pNewDT );
+    throwExceptionOnFailure( pNewDT == 1.0, "Unexpected cutback in block." );
+  };
+
+  for ( int increment = 0; increment < 3; increment++ ) {
+    Eigen::VectorXd P, PBuffered;
+    compute( *single, dQ, P );
+
+    // a discarded global iteration, followed by the converged one
+    const std::vector< double > stateVarsOldCopy = stateVarsOld;
+    compute( *buffered, 0.5 * dQ, PBuffered );
+    compute( *buffered, dQ, PBuffered );
+
+    throwExceptionOnFailure( stateVarsOld == stateVarsOldCopy, "Old state variables modified." );
+    throwExceptionOnFailure( checkIfEqual< double >( Eigen::MatrixXd( P ), Eigen::MatrixXd( PBuffered ), 1e-10 ),
+                             "Internal forces differ." );
+    for ( size_t i = 0; i < stateVars.size(); i++ )
+      throwExceptionOnFailure( checkIfEqual( stateVars[i], stateVarsBuffered[i], 1e-12 ), "State variables differ." );
+
+    // accept the increment by swapping the arrays
+    buffered->swapStateBuffers();
+    std::swap( stateVarsBuffered, stateVarsOld );
+  }
+}
+
+int main()
+{
+  auto tests = std::vector< std::function< void() > >{ testQuad4PlaneStressBlock,
+                                                       testHexa8SolidBlock,
+                                                       testQuad4PlaneStrainBatches,
+                                                       testTetra4SolidBatches,
+                                                       testHexa8SolidBatches,
+                                                       testHexa8DoubleBufferedBatches };
+
+  executeTestsAndCollectExceptions( tests );
+
+  return 0;
+}
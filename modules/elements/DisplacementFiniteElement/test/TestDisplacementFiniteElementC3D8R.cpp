@@ -0,0 +1,176 @@
+#include "Marmot/DisplacementFiniteElementC3D8R.h"
+#include "Marmot/Marmot.h"
+#include "Marmot/MarmotElementProperty.h"
+#include "Marmot/MarmotTesting.h"
+
+using namespace Marmot;
+using namespace Marmot::Elements;
+using namespace Marmot::Testing;
+
+/* A linear elastic C3D8R with its state variables, created through the element factory. */
+struct Hexa8 {
+  const std::vector< double >                       nodeCoordinates;
+  const std::vector< double >                       matProps   = { 210000., 0.3, 1 };
+  const std::vector< double >                       elPropsVec = { 1.0 };
+  std::unique_ptr< DisplacementFiniteElementC3D8R > element;
+  std::vector< double >                             stateVars;
+
+  Hexa8( const std::vector< double >& nodeCoordinates ) : nodeCoordinates( nodeCoordinates )
+  {
+    using MarmotLibrary::MarmotElementFactory;
+
+    const int code = MarmotElementFactory::getElementCodeFromName( "C3D8R" );
+    element        = std::unique_ptr< DisplacementFiniteElementC3D8R >(
+      dynamic_cast< DisplacementFiniteElementC3D8R* >( MarmotElementFactory::createElement( code, 1 ) ) );
+    throwExceptionOnFailure( element != nullptr, "C3D8R not registered." );
+
+    element->assignNodeCoordinates( this->nodeCoordinates.data() );
+    element->assignProperty( ElementProperties( elPropsVec.data(), elPropsVec.size() ) );
+    element->assignProperty( MarmotMaterialSection( 1, matProps.data(), matProps.size() ) );
+
+    stateVars.resize( element->getNumberOfRequiredStateVars(), 0.0 );
+    element->assignStateVars( stateVars.data(), stateVars.size() );
+    element->initializeYourself();
+    element->setInitialConditions( MarmotElement::MarmotMaterialInitialization, nullptr );
+  }
+
+  void compute( const Eigen::VectorXd& dQ, Eigen::VectorXd& P, Eigen::MatrixXd& K )
+  {
+    const double time[] = { 0.0, 0.0 };
+    double       pNewDT = 1.0;
+    P                   = Eigen::VectorXd::Zero( 24 );
+    K                   = Eigen::MatrixXd::Zero( 24, 24 );
+    element->computeYourself( dQ.data(), dQ.data(), P.data(), K.data(), time, 1.0, pNewDT );
+  }
+};
+
+const std::vector< double > distortedHexa = { 0,   0,   0,   2.0, 0.1, 0,   2.2, 1.3, 0.1, 0.1, 1.0, 0,
+                                              0.1, 0,   1.2, 2.1, 0,   1.0, 2.0, 1.1, 1.1, 0,   1.2, 1.0 };
+
+void testPatchTest()
+{
+  Hexa8 hexa( distortedHexa );
+
+  throwExceptionOnFailure( hexa.element->getNumberOfQuadraturePoints() == 1, "Incorrect number of quadrature points." );
+
+  // a linear displacement field is represented exactly and does not activate the hourglass stabilization
+  const Eigen::Matrix3d A = ( Eigen::Matrix3d() << 1, 2, 3, -1, 0.5, 2, 0.3, -2, 1 ).finished() * 1e-3;
+  Eigen::VectorXd       dQ( 24 );
+  for ( int a = 0; a < 8; a++ )
+    dQ.segment< 3 >( 3 * a ) = A * Eigen::Vector3d::Map( &distortedHexa[3 * a] );
+
+  Eigen::VectorXd P;
+  Eigen::MatrixXd K;
+  hexa.compute( dQ, P, K );
+
+  throwExceptionOnFailure( checkIfEqual( Eigen::MatrixXd( hexa.element->hourglassForces ),
+                                         Eigen::MatrixXd( Eigen::Matrix< double, 3, 4 >::Zero() ),
+                                         1e-12 ),
+                           "Hourglass forces for a linear displacement field." );
+
+  const StateView strain = hexa.element->getStateView( "strain", 0 );
+  throwExceptionOnFailure( checkIfEqual( strain.stateLocation[0], A( 0, 0 ), 1e-14 ) &&
+                             checkIfEqual( strain.stateLocation[3], A( 0, 1 ) + A( 1, 0 ), 1e-14 ),
+                           "Incorrect strain for a linear displacement field." );
+}
+
+void testHourglassModesAreStabilized()
+{
+  Hexa8 hexa( distortedHexa );
+
+  Eigen::VectorXd P;
+  Eigen::MatrixXd K;
+  hexa.compute( Eigen::VectorXd::Zero( 24 ), P, K );
+
+  // only the six rigid body modes remain
+  const Eigen::VectorXd eigenvalues = Eigen::SelfAdjointEigenSolver< Eigen::MatrixXd >( K ).eigenvalues();
+  int                   nZero       = 0;
+  for ( int i = 0; i < 24; i++ )
+    nZero += std::abs( eigenvalues( i ) ) < 1e-8 * eigenvalues.maxCoeff();
+
+  throwExceptionOnFailure( nZero == 6, "Singular stiffness matrix." );
+}
+
+void testTangentIsConsistent()
+{
+  Hexa8 hexa( distortedHexa );
+
+  Eigen::VectorXd dQ( 24 );
+  for ( int i = 0; i < 24; i++ )
+    dQ( i ) = 1e-4 * std::sin( 1.0 + i );
+
+  Eigen::VectorXd             P;
+  Eigen::MatrixXd             K;
+  const std::vector< double > initialStateVars = hexa.stateVars;
+  hexa.compute( dQ, P, K );
+
+  // linear elasticity: the internal forces are linear in the displacements
+  Eigen::MatrixXd KNumeric( 24, 24 );
+  for ( int j = 0; j < 24; j++ ) {
+    hexa.stateVars = initialStateVars;
+    Eigen::VectorXd dQPerturbed = dQ;
+    dQPerturbed( j ) += 1e-6;
+
+    Eigen::VectorXd PPerturbed;
+    Eigen::MatrixXd KPerturbed;
+    hexa.compute( dQPerturbed, PPerturbed, KPerturbed );
+    KNumeric.col( j ) = -( PPerturbed - P ) / 1e-6;
+  }
+
+  throwExceptionOnFailure( checkIfEqual( K, KNumeric, 1e-3 * K.cwiseAbs().maxCoeff() ),
+                           "Inconsistent tangent stiffness." );
+
+  // the hourglass forces are stored outside of the quadrature point state, and are gathered by name
+  const MarmotElement::StateFieldAccessor hourglassForces = hexa.element->resolveStateField( "hourglass forces" );
+  throwExceptionOnFailure( hourglassForces.offset == -1 && hourglassForces.size == 12,
+                           "Incorrect accessor of the hourglass forces." );
+
+  Eigen::MatrixXd gatheredForces( 3, 4 );
+  hexa.element->gatherStateField( hourglassForces, gatheredForces.data() );
+  throwExceptionOnFailure( checkIfEqual( gatheredForces, Eigen::MatrixXd( hexa.element->hourglassForces ), 1e-14 ),
+                           "Incorrect gathered hourglass forces." );
+}
+
+void testSwappedStateBuffers()
+{
+  // the hourglass forces are integrated in rate form, so accepting an increment must carry them over
+  Hexa8 single( distortedHexa );
+  Hexa8 buffered( distortedHexa );
+
+  std::vector< double > stateVarsOld = buffered.stateVars;
+  buffered.element->assignStateVarsDoubleBuffered( buffered.stateVars.data(), stateVarsOld.data(), stateVarsOld.size() );
+
+  Eigen::VectorXd dQ( 24 );
+  for ( int i = 0; i < 24; i++ )
+    dQ( i ) = 1e-4 * std::sin( 1.0 + i );
+
+  Eigen::VectorXd P, PBuffered;
+  Eigen::MatrixXd K, KBuffered;
+  for ( int increment = 0; increment < 3; increment++ ) {
+    single.compute( dQ, P, K );
+    buffered.compute( 2.0 * dQ, PBuffered, KBuffered );
+    buffered.compute( dQ, PBuffered, KBuffered );
+
+    throwExceptionOnFailure( checkIfEqual< double >( Eigen::MatrixXd( P ), Eigen::MatrixXd( PBuffered ), 1e-10 * P.norm() ),
+                             "Internal forces differ." );
+    throwExceptionOnFailure( checkIfEqual( Eigen::MatrixXd( single.element->hourglassForces ),
+                                           Eigen::MatrixXd( buffered.element->hourglassForces ),
+                                           1e-14 ),
+                             "Hourglass forces differ." );
+
+    buffered.element->swapStateBuffers();
+    std::swap( buffered.stateVars, stateVarsOld );
+  }
+}
+
+int main()
+{
+  auto tests = std::vector< std::function< void() > >{ testPatchTest,
+                                                       testHourglassModesAreStabilized,
+                                                       testTangentIsConsistent,
+                                                       testSwappedStateBuffers };
+
+  executeTestsAndCollectExceptions( tests );
+
+  return 0;
+}
@@ -0,0 +1,226 @@
+#include "Marmot/DisplacementFiniteElementEAS.h"
+#include "Marmot/MarmotElementProperty.h"
+#include "Marmot/MarmotTesting.h"
+
+using namespace Marmot;
+using namespace Marmot::Elements;
+using namespace Marmot::Testing;
+using namespace Marmot::FiniteElement;
+
+/* An element with its properties and state variables. */
+template < class Element >
+struct ElementWithState {
+  const std::vector< double > nodeCoordinates;
+  const std::vector< double > matProps;
+  const std::vector< double > elPropsVec = { 1.0 };
+  Element                     element;
+  std::vector< double >       stateVars;
+
+  ElementWithState( const std::vector< double >& nodeCoordinates,
+                    typename Element::SectionType sectionType,
+                    const std::vector< double >&  matProps,
+                    int                           matCode )
+    : nodeCoordinates( nodeCoordinates ),
+      matProps( matProps ),
+      element( 1, Quadrature::IntegrationTypes::FullIntegration, sectionType )
+  {
+    element.assignNodeCoordinates( this->nodeCoordinates.data() );
+    element.assignProperty( ElementProperties( elPropsVec.data(), elPropsVec.size() ) );
+    element.assignProperty( MarmotMaterialSection( matCode, this->matProps.data(), this->matProps.size() ) );
+
+    stateVars.resize( element.getNumberOfRequiredStateVars(), 0.0 );
+    element.assignStateVars( stateVars.data(), stateVars.size() );
+    element.initializeYourself();
+    element.setInitialConditions( MarmotElement::MarmotMaterialInitialization, nullptr );
+  }
+
+  void compute( const Eigen::VectorXd& dQ, Eigen::VectorXd& P, Eigen::MatrixXd& K )
+  {
+    const double time[] = { 0.0, 0.0 };
+    double       pNewDT = 1.0;
+    P                   = Eigen::VectorXd::Zero( dQ.size() );
+    K                   = Eigen::MatrixXd::Zero( dQ.size(), dQ.size() );
+    element.computeYourself( dQ.data(), dQ.data(), P.data(), K.data(), time, 1.0, pNewDT );
+    throwExceptionOnFailure( pNewDT == 1.0, "Unexpected cutback." );
+  }
+};
+
+using QuadEAS5 = DisplacementFiniteElementEAS< 2, 4, EAS::SimoRifaiEAS5 >;
+using HexaEAS9 = DisplacementFiniteElementEAS< 3, 8, EAS::DeBorstEAS9 >;
+
+const std::vector< double > distortedHexa = { 0,   0,   0,   2.0, 0.1, 0,   2.2, 1.3, 0.1, 0.1, 1.0, 0,
+                                              0.1, 0,   1.2, 2.1, 0,   1.0, 2.0, 1.1, 1.1, 0,   1.2, 1.0 };
+
+void testPatchTest()
+{
+  ElementWithState< HexaEAS9 > hexa( distortedHexa, HexaEAS9::SectionType::Solid, { 210000., 0.3, 1 }, 1 );
+
+  // a linear displacement field is represented exactly and does not activate the enhanced strains
+  const Eigen::Matrix3d A = ( Eigen::Matrix3d() << 1, 2, 3, -1, 0.5, 2, 0.3, -2, 1 ).finished() * 1e-3;
+  Eigen::VectorXd       dQ( 24 );
+  for ( int a = 0; a < 8; a++ )
+    dQ.segment< 3 >( 3 * a ) = A * Eigen::Vector3d::Map( &distortedHexa[3 * a] );
+
+  Eigen::VectorXd P;
+  Eigen::MatrixXd K;
+  hexa.compute( dQ, P, K );
+
+  throwExceptionOnFailure( checkIfEqual( Eigen::MatrixXd( hexa.element.alpha ),
+                                         Eigen::MatrixXd( HexaEAS9::EASVector::Zero() ),
+                                         1e-12 ),
+                           "Enhanced parameters for a linear displacement field." );
+
+  for ( int qp = 0; qp < hexa.element.getNumberOfQuadraturePoints(); qp++ ) {
+    const StateView strain = hexa.element.getStateView( "strain", qp );
+    throwExceptionOnFailure( checkIfEqual( strain.stateLocation[0], A( 0, 0 ), 1e-14 ) &&
+                               checkIfEqual( strain.stateLocation[4], A( 0, 2 ) + A( 2, 0 ), 1e-14 ),
+                             "Incorrect strain for a linear displacement field." );
+  }
+}
+
+void testBendingIsFreeOfLocking()
+{
+  // pure bending of a rectangle 2a x 2b, u_x = kappa x y, with the exact energy E kappa^2 (2a) (2b)^3 / 24
+  const double a = 5.0, b = 0.5, E = 1000.0, kappa = 1e-3;
+
+  const std::vector< double > nodeCoordinates = { -a, -b, a, -b, a, b, -a, b };
+  Eigen::VectorXd             dQ( 8 );
+  for ( int i = 0; i < 4; i++ )
+    dQ.segment< 2 >( 2 * i ) << kappa * nodeCoordinates[2 * i] * nodeCoordinates[2 * i + 1], 0;
+
+  const double exactEnergy = E * kappa * kappa * ( 2 * a ) * std::pow( 2 * b, 3 ) / 24;
+
+  Eigen::VectorXd P;
+  Eigen::MatrixXd K;
+
+  ElementWithState< QuadEAS5 > quadEAS( nodeCoordinates, QuadEAS5::SectionType::PlaneStress, { E, 0.0, 1 }, 1 );
+  quadEAS.compute( dQ, P, K );
+  throwExceptionOnFailure( checkIfEqual( 0.5 * dQ.dot( K * dQ ), exactEnergy, 1e-10 * exactEnergy ),
+                           "Incorrect bending energy of the EAS element." );
+  throwExceptionOnFailure( checkIfEqual( -0.5 * dQ.dot( P ), exactEnergy, 1e-10 * exactEnergy ),
+                           "Incorrect internal forces of the EAS element." );
+
+  // the standard element locks
+  ElementWithState< DisplacementFiniteElement< 2, 4 > > quad( nodeCoordinates,
+                                                              DisplacementFiniteElement< 2, 4 >::PlaneStress,
+                                                              { E, 0.0, 1 },
+                                                              1 );
+  quad.compute( dQ, P, K );
+  throwExceptionOnFailure( 0.5 * dQ.dot( K * dQ ) > 10 * exactEnergy, "Standard element does not lock." );
+}
+
+void testUnloadedElementConverges()
+{
+  ElementWithState< HexaEAS9 > hexa( distortedHexa, HexaEAS9::SectionType::Solid, { 210000., 0.3, 1 }, 1 );
+
+  Eigen::VectorXd dQ( 24 );
+  for ( int i = 0; i < 24; i++ )
+    dQ( i ) = 1e-3 * std::sin( 1.0 + i );
+
+  Eigen::VectorXd P;
+  Eigen::MatrixXd K;
+
+  // zero displacement in the first increment, and unloading to zero, where the internal forces vanish up to roundoff
+  hexa.compute( Eigen::VectorXd::Zero( 24 ), P, K );
+  throwExceptionOnFailure( P.isZero(), "Internal forces without displacement." );
+
+  hexa.compute( dQ, P, K );
+  hexa.compute( -dQ, P, K );
+  throwExceptionOnFailure( P.norm() < 1e-8, "Internal forces after unloading." );
+}
+
+void testCondensedTangentIsConsistent()
+{
+  // von Mises plasticity, such that the enhanced parameters are determined iteratively
+  ElementWithState< HexaEAS9 > hexa( distortedHexa,
+                                     HexaEAS9::SectionType::Solid,
+                                     { 210000., 0.3, 5., 2100., 0., 20. },
+                                     2 );
+
+  Eigen::VectorXd dQ( 24 );
+  for ( int i = 0; i < 24; i++ )
+    dQ( i ) = 1e-3 * std::sin( 1.0 + i );
+
+  Eigen::VectorXd             P;
+  Eigen::MatrixXd             K;
+  const std::vector< double > initialStateVars = hexa.stateVars;
+  hexa.compute( dQ, P, K );
+
+  Eigen::MatrixXd KNumeric( 24, 24 );
+  for ( int j = 0; j < 24; j++ ) {
+    Eigen::VectorXd dQPerturbed = dQ;
+    dQPerturbed( j ) += 1e-8;
+
+    hexa.stateVars = initialStateVars;
+    Eigen::VectorXd PPerturbed;
+    Eigen::MatrixXd KPerturbed;
+    hexa.compute( dQPerturbed, PPerturbed, KPerturbed );
+    KNumeric.col( j ) = -( PPerturbed - P ) / 1e-8;
+  }
+
+  throwExceptionOnFailure( checkIfEqual( K, KNumeric, 1e-4 * K.cwiseAbs().maxCoeff() ),
+                           "Inconsistent condensed tangent stiffness." );
+}
+
+void testDoubleBufferedStateVars()
+{
+  // with a pair of state variable arrays, repeated computations start from the old state without restoring it
+  const std::vector< double > matProps = { 210000., 0.3, 5., 2100., 0., 20. };
+
+  ElementWithState< HexaEAS9 > single( distortedHexa, HexaEAS9::SectionType::Solid, matProps, 2 );
+  ElementWithState< HexaEAS9 > buffered( distortedHexa, HexaEAS9::SectionType::Solid, matProps, 2 );
+
+  std::vector< double > stateVarsOld = buffered.stateVars;
+  buffered.element.assignStateVarsDoubleBuffered( buffered.stateVars.data(), stateVarsOld.data(), stateVarsOld.size() );
+
+  Eigen::VectorXd dQ( 24 );
+  for ( int i = 0; i < 24; i++ )
+    dQ( i ) = 1e-3 * std::sin( 1.0 + i );
+
+  Eigen::VectorXd P, PBuffered;
+  Eigen::MatrixXd K, KBuffered;
+
+  for ( int increment = 0; increment < 3; increment++ ) {
+    single.compute( dQ, P, K );
+
+    // a discarded global iteration, followed by the converged one
+    const std::vector< double > stateVarsOldCopy = stateVarsOld;
+    buffered.compute( 0.5 * dQ, PBuffered, KBuffered );
+    buffered.compute( dQ, PBuffered, KBuffered );
+
+    throwExceptionOnFailure( stateVarsOld == stateVarsOldCopy, "Old state variables modified." );
+    throwExceptionOnFailure( checkIfEqual< double >( Eigen::MatrixXd( P ), Eigen::MatrixXd( PBuffered ), 1e-9 * P.norm() ),
+                             "Internal forces differ." );
+    throwExceptionOnFailure( checkIfEqual< double >( K, KBuffered, 1e-9 * K.norm() ), "Tangent stiffness differs." );
+    throwExceptionOnFailure( checkIfEqual< double >( Eigen::Map< Eigen::MatrixXd >( single.stateVars.data(),
+                                                                                   single.stateVars.size(),
+                                                                                   1 ),
+                                                     Eigen::Map< Eigen::MatrixXd >( buffered.stateVars.data(),
+                                                                                   buffered.stateVars.size(),
+                                                                                   1 ),
+                                                     1e-10 ),
+                             "State variables differ." );
+
+    // accept the increment by swapping the arrays
+    buffered.element.swapStateBuffers();
+    std::swap( buffered.stateVars, stateVarsOld );
+
+    // a rejected increment after accepting leaves the accepted state untouched
+    const std::vector< double > acceptedStateVars = stateVarsOld;
+    buffered.compute( 3.0 * dQ, PBuffered, KBuffered );
+    throwExceptionOnFailure( stateVarsOld == acceptedStateVars, "Accepted state variables modified." );
+  }
+}
+
+int main()
+{
+  auto tests = std::vector< std::function< void() > >{ testPatchTest,
+                                                       testBendingIsFreeOfLocking,
+                                                       testUnloadedElementConverges,
+                                                       testCondensedTangentIsConsistent,
+                                                       testDoubleBufferedStateVars };
+
+  executeTestsAndCollectExceptions( tests );
+
+  return 0;
+}
@@ -0,0 +1,516 @@
+#include "Marmot/Marmot.h"
+#include "Marmot/MarmotElementProperty.h"
+#include "Marmot/MarmotMaterialHypoElastic.h"
+#include "Marmot/MarmotTesting.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <new>
+#include <set>
+#include <thread>
+
+/* Detection of heap allocations in hot paths (e.g., MarmotElement::computeYourself or
+ * MarmotMaterialHypoElastic::computeStress).
+ *
+ * Allocations of the current thread are counted while at least one AllocationScope is alive on this thread.
+ * Allocations of other threads are not affected. The hooks replace the global allocation functions of this test
+ * executable only. On glibc, malloc, calloc, realloc and the aligned variants are hooked as well, as Eigen allocates
+ * its dynamic matrices with std::malloc rather than operator new. Otherwise, only the replaceable global operator new
+ * is hooked. */
+namespace Marmot::Testing::AllocationGuard {
+
+  /** @brief Per-thread state of the guard; constant initialized, as it is accessed from the allocation hooks. */
+  struct ThreadState {
+    int      nActiveScopes;
+    long int nAllocations;
+    size_t   nBytes;
+    bool     isAsserting;
+  };
+
+  constinit thread_local ThreadState threadState = { 0, 0, 0, false };
+
+  /** @brief Called by the allocation hooks; aborts in asserting scopes, see AllocationScope. */
+  void onAllocation( size_t size );
+
+  /**
+   * @class AllocationScope
+   * @brief Counts the heap allocations of the current thread from its construction until end() is called or it is
+   * destructed. Scopes may be nested.
+   *
+   * In asserting mode, any allocation aborts the program with a message, such that the offending call stack can be
+   * inspected in a debugger. Otherwise, allocations are only counted.
+   */
+  class AllocationScope {
+  public:
+    enum Mode { Count, Assert };
+
+    explicit AllocationScope( Mode mode = Count )
+      : wasAsserting( threadState.isAsserting ),
+        allocationsAtBegin( threadState.nAllocations ),
+        bytesAtBegin( threadState.nBytes )
+    {
+      threadState.nActiveScopes += 1;
+      threadState.isAsserting = wasAsserting || mode == Assert;
+    }
+
+    AllocationScope( const AllocationScope& )            = delete;
+    AllocationScope& operator=( const AllocationScope& ) = delete;
+
+    ~AllocationScope() { end(); }
+
+    /** @brief Stop counting before the end of the scope; the counts are kept. */
+    void end()
+    {
+      if ( isEnded )
+        return;
+
+      nAllocations = threadState.nAllocations - allocationsAtBegin;
+      nBytes       = threadState.nBytes - bytesAtBegin;
+      isEnded      = true;
+
+      threadState.nActiveScopes -= 1;
+      threadState.isAsserting = wasAsserting;
+    }
+
+    /** @return Number of heap allocations within the scope. */
+    long int getNumberOfAllocations() const
+    {
+      return isEnded ? nAllocations : threadState.nAllocations - allocationsAtBegin;
+    }
+
+    /** @return Number of heap allocated bytes within the scope. */
+    size_t getNumberOfBytes() const { return isEnded ? nBytes : threadState.nBytes - bytesAtBegin; }
+
+  private:
+    const bool     wasAsserting;
+    const long int allocationsAtBegin;
+    const size_t   bytesAtBegin;
+    bool           isEnded      = false;
+    long int       nAllocations = 0;
+    size_t         nBytes       = 0;
+  };
+
+} // namespace Marmot::Testing::AllocationGuard
+
+namespace Marmot::Testing::AllocationGuard {
+
+  void onAllocation( size_t size )
+  {
+    if ( threadState.nActiveScopes == 0 )
+      return;
+
+    threadState.nAllocations += 1;
+    threadState.nBytes += size;
+
+    if ( threadState.isAsserting ) {
+      // no allocations and no exceptions here; we are inside the allocator
+      std::fprintf( stderr, "Marmot::Testing::AllocationGuard: heap allocation of %zu bytes in guarded scope\n", size );
+      std::abort();
+    }
+  }
+
+} // namespace Marmot::Testing::AllocationGuard
+
+#if defined( __GLIBC__ )
+#include <malloc.h>
+
+/* glibc permits replacing the malloc family; the original implementations remain accessible under their internal
+ * names. operator new is implemented on top of malloc, hence allocations are counted only once, in the hooks of the
+ * malloc family. */
+extern "C" {
+void* __libc_malloc( size_t size );
+void* __libc_calloc( size_t n, size_t size );
+void* __libc_realloc( void* ptr, size_t size );
+void* __libc_memalign( size_t alignment, size_t size );
+void  __libc_free( void* ptr );
+
+void* malloc( size_t size ) noexcept
+{
+  Marmot::Testing::AllocationGuard::onAllocation( size );
+  return __libc_malloc( size );
+}
+
+void* calloc( size_t n, size_t size ) noexcept
+{
+  Marmot::Testing::AllocationGuard::onAllocation( n * size );
+  return __libc_calloc( n, size );
+}
+
+void* realloc( void* ptr, size_t size ) noexcept
+{
+  Marmot::Testing::AllocationGuard::onAllocation( size );
+  return __libc_realloc( ptr, size );
+}
+
+void* memalign( size_t alignment, size_t size ) noexcept
+{
+  Marmot::Testing::AllocationGuard::onAllocation( size );
+  return __libc_memalign( alignment, size );
+}
+
+void* aligned_alloc( size_t alignment, size_t size ) noexcept
+{
+  Marmot::Testing::AllocationGuard::onAllocation( size );
+  return __libc_memalign( alignment, size );
+}
+
+int posix_memalign( void** ptr, size_t alignment, size_t size ) noexcept
+{
+  Marmot::Testing::AllocationGuard::onAllocation( size );
+  void* result = __libc_memalign( alignment, size );
+  if ( !result )
+    return ENOMEM;
+  *ptr = result;
+  return 0;
+}
+
+void free( void* ptr ) noexcept
+{
+  __libc_free( ptr );
+}
+}
+
+#define MARMOT_ALLOCATION_GUARD_COUNT_NEW( size )
+#else
+#define MARMOT_ALLOCATION_GUARD_COUNT_NEW( size ) Marmot::Testing::AllocationGuard::onAllocation( size )
+#endif
+
+void* operator new( size_t size )
+{
+  MARMOT_ALLOCATION_GUARD_COUNT_NEW( size );
+  if ( void* ptr = std::malloc( size ? size : 1 ) )
+    return ptr;
+  throw std::bad_alloc();
+}
+
+void* operator new[]( size_t size )
+{
+  return ::operator new( size );
+}
+
+void* operator new( size_t size, const std::nothrow_t& ) noexcept
+{
+  MARMOT_ALLOCATION_GUARD_COUNT_NEW( size );
+  return std::malloc( size ? size : 1 );
+}
+
+void* operator new[]( size_t size, const std::nothrow_t& tag ) noexcept
+{
+  return ::operator new( size, tag );
+}
+
+void* operator new( size_t size, std::align_val_t alignment )
+{
+  MARMOT_ALLOCATION_GUARD_COUNT_NEW( size );
+  const size_t align = static_cast< size_t >( alignment );
+  if ( void* ptr = std::aligned_alloc( align, ( ( size ? size : 1 ) + align - 1 ) / align * align ) )
+    return ptr;
+  throw std::bad_alloc();
+}
+
+void* operator new[]( size_t size, std::align_val_t alignment )
+{
+  return ::operator new( size, alignment );
+}
+
+void operator delete( void* ptr ) noexcept
+{
+  std::free( ptr );
+}
+
+void operator delete[]( void* ptr ) noexcept
+{
+  std::free( ptr );
+}
+
+void operator delete( void* ptr, size_t ) noexcept
+{
+  std::free( ptr );
+}
+
+void operator delete[]( void* ptr, size_t ) noexcept
+{
+  std::free( ptr );
+}
+
+void operator delete( void* ptr, std::align_val_t ) noexcept
+{
+  std::free( ptr );
+}
+
+void operator delete[]( void* ptr, std::align_val_t ) noexcept
+{
+  std::free( ptr );
+}
+
+void operator delete( void* ptr, size_t, std::align_val_t ) noexcept
+{
+  std::free( ptr );
+}
+
+void operator delete[]( void* ptr, size_t, std::align_val_t ) noexcept
+{
+  std::free( ptr );
+}
+
+#undef MARMOT_ALLOCATION_GUARD_COUNT_NEW
+
+using namespace Marmot::Testing;
+using namespace Marmot::Testing::AllocationGuard;
+using namespace MarmotLibrary;
+
+/* Hot paths which are known to be free of heap allocations; any allocation in these is treated as a regression. All
+ * other registered elements and materials are only reported. Known exemptions:
+ *  - CPS4_VONMISES and the plane stress and uniaxial stress states of materials with state variables: the iterations
+ *    of MarmotMaterialHypoElastic back up the state variables in a std::vector, which is only checked for 3D,
+ *  - ADLINEARELASTIC, ADVONMISES: the dual number vectors and matrices of the automatic differentiation are dynamic.
+ */
+const std::set< std::string > allocationFreeElements = { "C3D8",
+                                                         "C3D8R",
+                                                         "C3D8EAS9",
+                                                         "C3D20",
+                                                         "C3D20R",
+                                                         "C3D20I14",
+                                                         "CPE4",
+                                                         "CPE4EAS5",
+                                                         "CPE8",
+                                                         "CPE8R",
+                                                         "CPS4",
+                                                         "CPS4EAS5",
+                                                         "CPS8R",
+                                                         "T2D2",
+                                                         "C3D8_LINEARELASTIC",
+                                                         "C3D8_VONMISES",
+                                                         "C3D20_LINEARELASTIC",
+                                                         "C3D20_VONMISES",
+                                                         "CPE4_LINEARELASTIC",
+                                                         "CPE4_VONMISES",
+                                                         "CPS4_LINEARELASTIC" };
+
+const std::set< std::string > allocationFreeMaterials = { "B4",
+                                                          "LINEARELASTIC",
+                                                          "LINEARVISCOELASTICORTHOTROPICPOWERLAW",
+                                                          "LINEARVISCOELASTICPOWERLAW",
+                                                          "VONMISES" };
+
+// clang-format off
+/* Material properties for the registered materials, taken from the respective material tests. */
+const std::map< std::string, std::vector< double > > materialPropertiesByName = {
+  { "LINEARELASTIC",                         { 10000., 0.2, 1. } },
+  { "ADLINEARELASTIC",                       { 210000., 0.3 } },
+  { "VONMISES",                              { 210000., 0.3, 200., 2100., 20., 20. } },
+  { "ADVONMISES",                            { 210000., 0.3, 200., 2100., 20., 20. } },
+  { "LINEARVISCOELASTICPOWERLAW",            { 2e5, 0.2, 0.5, 0.1, 10, 1e-4, 1. } },
+  { "LINEARVISCOELASTICORTHOTROPICPOWERLAW", { 1., 2e5, 2e5, 2e5, 0.2, 0.2, 0.2, 2e5 / 2.4, 2e5 / 2.4, 2e5 / 2.4,
+                                               0.5, 0.1, 2, 10, 1e-4, 3.1622776601683795, 1.,
+                                               1., 0.5, 0., -0.5, 1., 1. } },
+  { "B4",                                    { 0.2, 20.6, 91., 4.8, 5.9, 0.1, 0.5, 12, 1e-5, 0., 3., 1.45, -4.5,
+                                               -0.0015, 90., 7., 1., 400., 11, 2e-4, -100., 1. } },
+  { "COMPRESSIBLENEOHOOKE",                  { 3500., 1500. } },
+};
+
+/* Nodal coordinates of the reference elements in their own dimension; all elements are shifted into the positive
+ * half space to provide valid geometries for axisymmetric elements. */
+const std::map< std::string, std::vector< std::vector< double > > > referenceCoordinatesByShape = {
+  { "bar2",   { { -1 }, { 1 } } },
+  { "quad4",  { { -1, -1 }, { 1, -1 }, { 1, 1 }, { -1, 1 } } },
+  { "quad8",  { { -1, -1 }, { 1, -1 }, { 1, 1 }, { -1, 1 },
+                {  0, -1 }, { 1,  0 }, { 0, 1 }, { -1, 0 } } },
+  { "hexa8",  { { -1, -1, -1 }, { 1, -1, -1 }, { 1, 1, -1 }, { -1, 1, -1 },
+                { -1, -1,  1 }, { 1, -1,  1 }, { 1, 1,  1 }, { -1, 1,  1 } } },
+  { "hexa20", { { -1, -1, -1 }, { 1, -1, -1 }, { 1, 1, -1 }, { -1, 1, -1 },
+                { -1, -1,  1 }, { 1, -1,  1 }, { 1, 1,  1 }, { -1, 1,  1 },
+                {  0, -1, -1 }, { 1,  0, -1 }, { 0, 1, -1 }, { -1, 0, -1 },
+                {  0, -1,  1 }, { 1,  0,  1 }, { 0, 1,  1 }, { -1, 0,  1 },
+                { -1, -1,  0 }, { 1, -1,  0 }, { 1, 1,  0 }, { -1, 1,  0 } } },
+};
+// clang-format on
+
+std::unique_ptr< MarmotMaterial > createMaterial( const std::string& materialName )
+{
+  const auto& properties = materialPropertiesByName.at( materialName );
+  return std::unique_ptr< MarmotMaterial >(
+    MarmotMaterialFactory::createMaterial( MarmotMaterialFactory::getMaterialCodeFromName( materialName ),
+                                           properties.data(),
+                                           properties.size(),
+                                           1 ) );
+}
+
+bool isMaterialRegistered( const std::string& materialName )
+{
+  const auto names = MarmotMaterialFactory::getRegisteredMaterialNames();
+  return std::find( names.begin(), names.end(), materialName ) != names.end();
+}
+
+void testAllocationScope()
+{
+  // counts are read before the checks, as the messages are allocated as well
+  {
+    AllocationScope scope;
+    auto            allocated         = std::make_unique< std::vector< double > >( 100 );
+    const long int  nAllocationsOfNew = scope.getNumberOfAllocations();
+
+    Eigen::VectorXd vector              = Eigen::VectorXd::Zero( 100 );
+    const long int  nAllocationsOfEigen = scope.getNumberOfAllocations();
+
+    AllocationScope nestedScope;
+    vector.resize( 200 );
+    nestedScope.end();
+
+    Eigen::Matrix< double, 6, 6 > fixedSize                 = Eigen::Matrix< double, 6, 6 >::Identity();
+    const long int                nAllocationsWithFixedSize = scope.getNumberOfAllocations();
+
+    scope.end();
+    std::vector< double > notCounted( 100 );
+
+    throwExceptionOnFailure( nAllocationsOfNew == 2, "operator new not counted" );
+    throwExceptionOnFailure( nAllocationsOfEigen == 3, "Eigen allocation not counted" );
+    throwExceptionOnFailure( nestedScope.getNumberOfAllocations() == 1, "nested scope not counted" );
+    throwExceptionOnFailure( nAllocationsWithFixedSize == 4, "fixed size matrix counted" );
+    throwExceptionOnFailure( scope.getNumberOfAllocations() == 4, "allocation after end counted" );
+    throwExceptionOnFailure( fixedSize.trace() == 6, "unexpected trace" );
+  }
+
+  // allocations of other threads are not counted
+  AllocationScope scope;
+  std::thread( [] { std::vector< double > allocated( 100 ); } ).join();
+  const long int nAllocationsWithThread = scope.getNumberOfAllocations();
+
+  std::vector< double > allocated( 100 );
+  scope.end();
+
+  throwExceptionOnFailure( scope.getNumberOfAllocations() == nAllocationsWithThread + 1,
+                           "allocation of current thread not counted" );
+}
+
+void testElements()
+{
+  std::cout << std::setw( 20 ) << "element" << std::setw( 24 ) << "material" << std::setw( 16 ) << "allocations"
+            << std::setw( 16 ) << "bytes" << std::endl;
+
+  for ( const std::string& elementName : MarmotElementFactory::getRegisteredElementNames() ) {
+    auto element = std::unique_ptr< MarmotElement >(
+      MarmotElementFactory::createElement( MarmotElementFactory::getElementCodeFromName( elementName ), 1 ) );
+
+    // elements bound to a material are named after it, e.g., C3D8_VONMISES
+    const auto        separator    = elementName.find( '_' );
+    const std::string materialName = separator != std::string::npos ? elementName.substr( separator + 1 )
+                                     : elementName.ends_with( "UL" ) ? "COMPRESSIBLENEOHOOKE"
+                                                                     : "LINEARELASTIC";
+    const auto        shape        = referenceCoordinatesByShape.find( element->getElementShape() );
+    if ( shape == referenceCoordinatesByShape.end() || !isMaterialRegistered( materialName ) ) {
+      std::cout << std::setw( 12 ) << elementName << ": skipped" << std::endl;
+      continue;
+    }
+
+    const int             nDim   = element->getNSpatialDimensions();
+    const int             nNodes = element->getNNodes();
+    std::vector< double > coordinates( nDim * nNodes, 1.5 );
+    for ( int i = 0; i < nNodes; i++ )
+      for ( size_t j = 0; j < shape->second[i].size(); j++ )
+        coordinates[i * nDim + j] += 0.5 * shape->second[i][j];
+
+    const std::vector< double > elementProperties  = { 1.0 };
+    const auto&                 materialProperties = materialPropertiesByName.at( materialName );
+
+    element->assignNodeCoordinates( coordinates.data() );
+    element->assignProperty( ElementProperties( elementProperties.data(), elementProperties.size() ) );
+    element->assignProperty( MarmotMaterialSection( MarmotMaterialFactory::getMaterialCodeFromName( materialName ),
+                                                    materialProperties.data(),
+                                                    materialProperties.size() ) );
+
+    std::vector< double > stateVars( element->getNumberOfRequiredStateVars(), 0.0 );
+    element->assignStateVars( stateVars.data(), stateVars.size() );
+    element->initializeYourself();
+
+    const int       nDof = element->getNDofPerElement();
+    Eigen::VectorXd dQ( nDof );
+    for ( int i = 0; i < nDof; i++ )
+      dQ( i ) = 1e-5 * ( i % 3 - 1 );
+    Eigen::VectorXd QTotal = dQ;
+    Eigen::VectorXd Pe     = Eigen::VectorXd::Zero( nDof );
+    Eigen::MatrixXd Ke     = Eigen::MatrixXd::Zero( nDof, nDof );
+    const double    time[] = { 0.0, 0.0 };
+    double          pNewDT = 1.0;
+
+    // the first call may perform lazy initializations
+    element->computeYourself( QTotal.data(), dQ.data(), Pe.data(), Ke.data(), time, 1.0, pNewDT );
+
+    AllocationScope scope;
+    element->computeYourself( QTotal.data(), dQ.data(), Pe.data(), Ke.data(), time, 1.0, pNewDT );
+    scope.end();
+
+    std::cout << std::setw( 20 ) << elementName << std::setw( 24 ) << materialName << std::setw( 16 )
+              << scope.getNumberOfAllocations() << std::setw( 16 ) << scope.getNumberOfBytes() << std::endl;
+
+    throwExceptionOnFailure( !allocationFreeElements.contains( elementName ) || scope.getNumberOfAllocations() == 0,
+                             "heap allocation in computeYourself of " + elementName );
+  }
+}
+
+void testMaterials()
+{
+  std::cout << std::setw( 40 ) << "material" << std::setw( 12 ) << "3D" << std::setw( 16 ) << "plane stress"
+            << std::setw( 16 ) << "uniaxial" << std::endl;
+
+  for ( const std::string& materialName : MarmotMaterialFactory::getRegisteredMaterialNames() ) {
+    if ( !materialPropertiesByName.contains( materialName ) ) {
+      std::cout << std::setw( 40 ) << materialName << ": skipped" << std::endl;
+      continue;
+    }
+
+    auto  material    = createMaterial( materialName );
+    auto* hypoElastic = dynamic_cast< MarmotMaterialHypoElastic* >( material.get() );
+    if ( !hypoElastic )
+      continue;
+
+    std::vector< double > stateVars( hypoElastic->getNumberOfRequiredStateVars(), 0.0 );
+    hypoElastic->assignStateVars( stateVars.data(), stateVars.size() );
+    hypoElastic->setCharacteristicElementLength( 1.0 );
+    hypoElastic->initializeYourself();
+
+    double       stress[6]           = { 0 };
+    double       dStressDDStrain[36] = { 0 };
+    const double dStrain[6]          = { 1e-5, -2e-6, -2e-6, 1e-6, 0, 0 };
+    const double timeOld[2]          = { 28.0, 28.0 };
+    double       pNewDT              = 1.0;
+
+    // the first call may perform lazy initializations
+    hypoElastic->computeStress( stress, dStressDDStrain, dStrain, timeOld, 1.0, pNewDT );
+
+    AllocationScope scope3D;
+    hypoElastic->computeStress( stress, dStressDDStrain, dStrain, timeOld, 1.0, pNewDT );
+    scope3D.end();
+
+    double          stress2D[3] = { 0 }, dStressDDStrain2D[9] = { 0 }, dStrain2D[3] = { 1e-5, -2e-6, 1e-6 };
+    AllocationScope scopePlaneStress;
+    hypoElastic->computePlaneStress( stress2D, dStressDDStrain2D, dStrain2D, timeOld, 1.0, pNewDT );
+    scopePlaneStress.end();
+
+    double          stress1D = 0, dStressDDStrain1D = 0, dStrain1D = 1e-5;
+    AllocationScope scopeUniaxial;
+    hypoElastic->computeUniaxialStress( &stress1D, &dStressDDStrain1D, &dStrain1D, timeOld, 1.0, pNewDT );
+    scopeUniaxial.end();
+
+    std::cout << std::setw( 40 ) << materialName << std::setw( 12 ) << scope3D.getNumberOfAllocations()
+              << std::setw( 16 ) << scopePlaneStress.getNumberOfAllocations() << std::setw( 16 )
+              << scopeUniaxial.getNumberOfAllocations() << std::endl;
+
+    throwExceptionOnFailure( !allocationFreeMaterials.contains( materialName ) || scope3D.getNumberOfAllocations() == 0,
+                             "heap allocation in computeStress of " + materialName );
+  }
+}
+
+int main()
+{
+  auto tests = std::vector< std::function< void() > >{ testAllocationScope, testElements, testMaterials };
+
+  executeTestsAndCollectExceptions( tests );
+
+  return 0;
+}
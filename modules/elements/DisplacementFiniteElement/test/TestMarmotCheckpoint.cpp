@@ -0,0 +1,229 @@
+#include "Marmot/Marmot.h"
+#include "Marmot/MarmotCheckpoint.h"
+#include "Marmot/MarmotElementProperty.h"
+#include "Marmot/MarmotTesting.h"
+#include <filesystem>
+#include <fstream>
+#include <memory>
+
+using namespace Marmot::Testing;
+using namespace Marmot::Checkpoint;
+using namespace MarmotLibrary;
+
+/* Two plane strain quadrilaterals, an elastic and a plastic one, sharing the element properties. */
+struct Model {
+  const std::vector< double > coordinates       = { 0, 0, 1, 0, 1, 1, 0, 1 };
+  const std::vector< double > elasticProperties = { 210000., 0.3, 1. };
+  const std::vector< double > plasticProperties = { 210000., 0.3, 5., 2100., 0., 20. };
+  const std::vector< double > thickness         = { 1.0 };
+
+  std::vector< std::unique_ptr< MarmotElement > > elements;
+  std::vector< std::vector< double > >            stateVars;
+  std::vector< MarmotMaterialSection >            sections;
+
+  Model()
+  {
+    sections.emplace_back( MarmotMaterialFactory::getMaterialCodeFromName( "LINEARELASTIC" ),
+                           elasticProperties.data(),
+                           elasticProperties.size() );
+    sections.emplace_back( MarmotMaterialFactory::getMaterialCodeFromName( "VONMISES" ),
+                           plasticProperties.data(),
+                           plasticProperties.size() );
+
+    for ( int e = 0; e < 2; e++ ) {
+      elements.emplace_back(
+        MarmotElementFactory::createElement( MarmotElementFactory::getElementCodeFromName( "CPE4" ), 10 + e ) );
+      elements[e]->assignNodeCoordinates( coordinates.data() );
+      elements[e]->assignProperty( ElementProperties( thickness.data(), thickness.size() ) );
+      elements[e]->assignProperty( sections[e] );
+      stateVars.emplace_back( elements[e]->getNumberOfRequiredStateVars(), 0.0 );
+      elements[e]->assignStateVars( stateVars[e].data(), stateVars[e].size() );
+      elements[e]->initializeYourself();
+    }
+  }
+};
+
+/* Compute an increment of a stretch of the element in x direction. */
+std::vector< double > computeIncrement( MarmotElement& element, double stretch )
+{
+  const std::vector< double > dQ     = { 0, 0, stretch, 0, stretch, 0, 0, 0 };
+  std::vector< double >       Pe     = std::vector< double >( 8, 0.0 );
+  std::vector< double >       Ke     = std::vector< double >( 64, 0.0 );
+  const double                time[] = { 0.0, 0.0 };
+  double                      pNewDT = 1.0;
+  element.computeYourself( dQ.data(), dQ.data(), Pe.data(), Ke.data(), time, 1.0, pNewDT );
+  return Pe;
+}
+
+void testCheckpointAndRestart()
+{
+  const std::string fileName = ( std::filesystem::temp_directory_path() / "TestMarmotCheckpoint.mcp" ).string();
+
+  Model model;
+  for ( auto& element : model.elements )
+    computeIncrement( *element, 1e-3 );
+
+  std::vector< ElementData > elementData;
+  for ( int e = 0; e < 2; e++ )
+    elementData.push_back( { model.elements[e].get(),
+                             10 + e,
+                             ElementProperties( model.thickness.data(), model.thickness.size() ),
+                             model.sections[e],
+                             model.stateVars[e].data(),
+                             int( model.stateVars[e].size() ) } );
+  writeCheckpoint( fileName, elementData, { "stress", "strain", "kappa" } );
+  throwExceptionOnFailure( !std::filesystem::exists( fileName + ".tmp" ), "temporary checkpoint file not renamed" );
+  const std::vector< std::vector< double > > checkpointedStateVars = model.stateVars;
+
+  {
+    CheckpointFile checkpoint( fileName );
+    throwExceptionOnFailure( checkpoint.getNumberOfElements() == 2, "incorrect number of elements" );
+
+    for ( int e = 0; e < 2; e++ ) {
+      const ElementRecord& record = checkpoint.getElementRecord( e );
+      throwExceptionOnFailure( record.elementCode == model.elements[e]->elementCode && record.elementLabel == 10 + e &&
+                                 record.materialCode == model.sections[e].materialCode,
+                               "incorrect element record" );
+
+      // the element properties are shared
+      throwExceptionOnFailure( checkpoint.getElementProperties( e ).elementProperties ==
+                                 checkpoint.getElementProperties( 0 ).elementProperties,
+                               "element properties not shared" );
+
+      const MarmotMaterialSection section = checkpoint.getMaterialSection( e );
+      throwExceptionOnFailure( section.nMaterialProperties == model.sections[e].nMaterialProperties &&
+                                 std::equal( section.materialProperties,
+                                             section.materialProperties + section.nMaterialProperties,
+                                             model.sections[e].materialProperties ),
+                               "incorrect material properties" );
+
+      // states are accessible by the layout descriptors
+      for ( int qp = 0; qp < 4; qp++ ) {
+        const StateView stress    = checkpoint.getStateView( e, "stress", qp );
+        const StateView reference = model.elements[e]->getStateView( "stress", qp );
+        throwExceptionOnFailure( stress.stateSize == 6 && std::equal( stress.stateLocation,
+                                                                      stress.stateLocation + 6,
+                                                                      reference.stateLocation ),
+                                 "incorrect stress" );
+      }
+    }
+
+    const StateView kappa = checkpoint.getStateView( 1, "kappa", 3 );
+    throwExceptionOnFailure( kappa.stateSize == 1 && kappa.stateLocation[0] > 0, "plastic state not recorded" );
+
+    bool isRecorded = true;
+    try {
+      checkpoint.getStateView( 0, "kappa", 0 );
+    }
+    catch ( const std::invalid_argument& ) {
+      isRecorded = false;
+    }
+    throwExceptionOnFailure( !isRecorded, "state recorded for an elastic material" );
+
+    // restarted elements continue with the same results as the original ones
+    for ( int e = 0; e < 2; e++ ) {
+      std::unique_ptr< MarmotElement > restarted( checkpoint.createElement( e ) );
+      restarted->assignNodeCoordinates( model.coordinates.data() );
+      restarted->initializeYourself();
+
+      const std::vector< double > P          = computeIncrement( *model.elements[e], 2e-3 );
+      const std::vector< double > PRestarted = computeIncrement( *restarted, 2e-3 );
+      throwExceptionOnFailure( P == PRestarted, "restarted element differs" );
+      throwExceptionOnFailure( std::equal( model.stateVars[e].begin(),
+                                           model.stateVars[e].end(),
+                                           checkpoint.getStateVars( e ) ),
+                               "restarted state differs" );
+    }
+  }
+
+  // the restarted computation did not modify the checkpoint
+  CheckpointFile checkpoint( fileName );
+  for ( int e = 0; e < 2; e++ )
+    throwExceptionOnFailure( std::equal( checkpointedStateVars[e].begin(),
+                                         checkpointedStateVars[e].end(),
+                                         checkpoint.getStateVars( e ) ),
+                             "checkpoint modified by the restart" );
+
+  std::filesystem::remove( fileName );
+}
+
+void testCorruptCheckpointIsRejected()
+{
+  const std::string fileName = ( std::filesystem::temp_directory_path() / "TestMarmotCheckpointCorrupt.mcp" ).string();
+
+  Model                      model;
+  std::vector< ElementData > elementData;
+  for ( int e = 0; e < 2; e++ )
+    elementData.push_back( { model.elements[e].get(),
+                             10 + e,
+                             ElementProperties( model.thickness.data(), model.thickness.size() ),
+                             model.sections[e],
+                             model.stateVars[e].data(),
+                             int( model.stateVars[e].size() ) } );
+
+  auto isRejected = [&]( auto corrupt ) {
+    writeCheckpoint( fileName, elementData, { "stress" } );
+
+    FileHeader header;
+    {
+      std::fstream file( fileName, std::ios::in | std::ios::out | std::ios::binary );
+      file.read( reinterpret_cast< char* >( &header ), sizeof( header ) );
+
+      ElementRecord record;
+      file.seekg( header.elementsOffset + sizeof( ElementRecord ) );
+      file.read( reinterpret_cast< char* >( &record ), sizeof( record ) );
+
+      corrupt( header, record );
+
+      file.seekp( 0 );
+      file.write( reinterpret_cast< const char* >( &header ), sizeof( header ) );
+      file.seekp( header.elementsOffset + sizeof( ElementRecord ) );
+      file.write( reinterpret_cast< const char* >( &record ), sizeof( record ) );
+    }
+
+    try {
+      CheckpointFile checkpoint( fileName );
+    }
+    catch ( const std::runtime_error& ) {
+      return true;
+    }
+    return false;
+  };
+
+  throwExceptionOnFailure( !isRejected( []( FileHeader&, ElementRecord& ) {} ), "valid checkpoint rejected" );
+  throwExceptionOnFailure( isRejected( []( FileHeader& header, ElementRecord& ) { header.nElements = 1 << 20; } ),
+                           "number of elements not checked" );
+  throwExceptionOnFailure( isRejected( []( FileHeader& header, ElementRecord& ) { header.layoutsOffset += 4; } ),
+                           "alignment of the layouts not checked" );
+  throwExceptionOnFailure( isRejected( []( FileHeader&, ElementRecord& record ) { record.layout = 99; } ),
+                           "layout index not checked" );
+  throwExceptionOnFailure( isRejected( []( FileHeader&, ElementRecord& record ) { record.nMaterialProperties = 99; } ),
+                           "property range not checked" );
+  throwExceptionOnFailure( isRejected( []( FileHeader&, ElementRecord& record ) { record.stateVarsOffset += 1; } ),
+                           "state range not checked" );
+  throwExceptionOnFailure( isRejected( []( FileHeader&, ElementRecord& record ) { record.nQuadraturePoints = 99; } ),
+                           "states of the quadrature points not checked" );
+
+  // accessors check the element index
+  writeCheckpoint( fileName, elementData );
+  CheckpointFile checkpoint( fileName );
+  bool           isIndexChecked = false;
+  try {
+    checkpoint.getStateVars( 2 );
+  }
+  catch ( const std::invalid_argument& ) {
+    isIndexChecked = true;
+  }
+  throwExceptionOnFailure( isIndexChecked, "element index not checked" );
+
+  std::filesystem::remove( fileName );
+}
+
+int main()
+{
+  auto tests = std::vector< std::function< void() > >{ testCheckpointAndRestart, testCorruptCheckpointIsRejected };
+
+  executeTestsAndCollectExceptions( tests );
+
+  return 0;
+}
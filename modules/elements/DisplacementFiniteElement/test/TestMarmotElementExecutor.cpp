@@ -0,0 +1,185 @@
+#include "Marmot/Marmot.h"
+#include "Marmot/MarmotElementExecutor.h"
+#include "Marmot/MarmotElementProperty.h"
+#include "Marmot/MarmotTesting.h"
+#include <memory>
+
+using namespace Marmot::Testing;
+using namespace Marmot::Execution;
+using namespace MarmotLibrary;
+
+/* A strip of nx x 2 plane strain quadrilaterals with alternating elastic and plastic materials, such that the cost of
+ * the elements varies. */
+struct Mesh {
+  static constexpr int nx = 25, ny = 2, nDofPerElement = 8;
+
+  std::vector< std::unique_ptr< MarmotElement > > elements;
+  std::vector< std::vector< double > >            stateVars;
+  std::vector< std::vector< int > >               dofIndices;
+  std::vector< double >                           QTotal, dQ, Pe, Ke;
+
+  /* elements and materials keep pointers to their properties */
+  const std::vector< double > elasticProperties = { 210000., 0.3, 1. };
+  const std::vector< double > plasticProperties = { 210000., 0.3, 5., 2100., 0., 20. };
+  const std::vector< double > thickness         = { 1.0 };
+
+  int getNumberOfElements() const { return nx * ny; }
+  int getNumberOfDofs() const { return ( nx + 1 ) * ( ny + 1 ) * 2; }
+
+  Mesh()
+  {
+    for ( int j = 0; j < ny; j++ )
+      for ( int i = 0; i < nx; i++ ) {
+        auto element = std::unique_ptr< MarmotElement >(
+          MarmotElementFactory::createElement( MarmotElementFactory::getElementCodeFromName( "CPE4" ),
+                                               elements.size() + 1 ) );
+
+        const int             nodes[] = { j * ( nx + 1 ) + i,
+                                          j * ( nx + 1 ) + i + 1,
+                                          ( j + 1 ) * ( nx + 1 ) + i + 1,
+                                          ( j + 1 ) * ( nx + 1 ) + i };
+        std::vector< double > coordinates;
+        std::vector< int >    indices;
+        for ( int node : nodes ) {
+          const double x = node % ( nx + 1 ), y = node / ( nx + 1 );
+          coordinates.insert( coordinates.end(), { x + 0.1 * std::sin( y ), y + 0.1 * std::sin( x ) } );
+          indices.insert( indices.end(), { 2 * node, 2 * node + 1 } );
+        }
+
+        const bool  isPlastic    = ( i + j ) % 2 == 0;
+        const auto& properties   = isPlastic ? plasticProperties : elasticProperties;
+        const int   materialCode = MarmotMaterialFactory::getMaterialCodeFromName( isPlastic ? "VONMISES"
+                                                                                             : "LINEARELASTIC" );
+
+        element->assignNodeCoordinates( coordinates.data() );
+        element->assignProperty( ElementProperties( thickness.data(), thickness.size() ) );
+        element->assignProperty( MarmotMaterialSection( materialCode, properties.data(), properties.size() ) );
+        stateVars.emplace_back( element->getNumberOfRequiredStateVars(), 0.0 );
+        element->assignStateVars( stateVars.back().data(), stateVars.back().size() );
+        element->initializeYourself();
+
+        elements.push_back( std::move( element ) );
+        dofIndices.push_back( indices );
+      }
+
+    dQ.resize( getNumberOfElements() * nDofPerElement );
+    for ( int e = 0; e < getNumberOfElements(); e++ )
+      for ( int i = 0; i < nDofPerElement; i++ )
+        dQ[e * nDofPerElement + i] = 1e-3 * dofIndices[e][i] / getNumberOfDofs();
+    QTotal = dQ;
+    Pe.assign( dQ.size(), 0.0 );
+    Ke.assign( dQ.size() * nDofPerElement, 0.0 );
+  }
+
+  /* Compute all elements with the executor. */
+  double execute( ElementExecutor& executor, std::vector< double >& P, bool isDeterministic )
+  {
+    std::vector< MarmotElement* > elementPointers;
+    std::vector< const double* >  QTotalPointers, dQPointers;
+    std::vector< double* >        PePointers, KePointers;
+    std::vector< const int* >     dofIndexPointers;
+    for ( int e = 0; e < getNumberOfElements(); e++ ) {
+      elementPointers.push_back( elements[e].get() );
+      QTotalPointers.push_back( &QTotal[e * nDofPerElement] );
+      dQPointers.push_back( &dQ[e * nDofPerElement] );
+      PePointers.push_back( &Pe[e * nDofPerElement] );
+      KePointers.push_back( &Ke[e * nDofPerElement * nDofPerElement] );
+      dofIndexPointers.push_back( dofIndices[e].data() );
+    }
+
+    const ElementExecutor::ElementBuffers buffers  = { elementPointers.data(),
+                                                       getNumberOfElements(),
+                                                       QTotalPointers.data(),
+                                                       dQPointers.data(),
+                                                       PePointers.data(),
+                                                       KePointers.data() };
+    const ElementExecutor::Assembly       assembly = { dofIndexPointers.data(),
+                                                       P.data(),
+                                                       getNumberOfDofs(),
+                                                       isDeterministic };
+
+    const double time[] = { 0.0, 0.0 };
+    double       pNewDT = 1.0;
+    executor.computeYourself( buffers, time, 1.0, pNewDT, &assembly );
+    return pNewDT;
+  }
+
+  /* Compute all elements sequentially and assemble in the order of the elements. */
+  double computeSequentially( std::vector< double >& P )
+  {
+    const double time[] = { 0.0, 0.0 };
+    double       pNewDT = 1.0;
+    for ( int e = 0; e < getNumberOfElements(); e++ ) {
+      elements[e]->computeYourself( &QTotal[e * nDofPerElement],
+                                    &dQ[e * nDofPerElement],
+                                    &Pe[e * nDofPerElement],
+                                    &Ke[e * nDofPerElement * nDofPerElement],
+                                    time,
+                                    1.0,
+                                    pNewDT );
+      for ( int i = 0; i < nDofPerElement; i++ )
+        P[dofIndices[e][i]] += Pe[e * nDofPerElement + i];
+    }
+    return pNewDT;
+  }
+};
+
+void testExecutorMatchesSequentialComputation()
+{
+  Mesh                  reference;
+  std::vector< double > PReference( reference.getNumberOfDofs(), 0.0 );
+  reference.computeSequentially( PReference );
+
+  for ( int nThreads : { 1, 3, 4 } )
+    for ( bool isDeterministic : { true, false } ) {
+      ElementExecutor       executor( nThreads, 2 );
+      Mesh                  mesh;
+      std::vector< double > P( mesh.getNumberOfDofs(), 0.0 );
+
+      throwExceptionOnFailure( mesh.execute( executor, P, isDeterministic ) == 1.0, "unexpected cutback" );
+
+      throwExceptionOnFailure( mesh.Pe == reference.Pe, "element forces differ from sequential computation" );
+      throwExceptionOnFailure( mesh.Ke == reference.Ke, "element stiffnesses differ from sequential computation" );
+      throwExceptionOnFailure( mesh.stateVars == reference.stateVars,
+                               "state variables differ from sequential computation" );
+
+      for ( size_t i = 0; i < P.size(); i++ )
+        throwExceptionOnFailure( isDeterministic ? P[i] == PReference[i]
+                                                 : checkIfEqual( P[i], PReference[i], 1e-10 ),
+                                 "assembled forces differ from sequential computation" );
+    }
+}
+
+void testExecutorIsReusable()
+{
+  ElementExecutor executor( 4 );
+  Mesh            mesh;
+
+  // repeated increments on the same pool
+  for ( int increment = 0; increment < 3; increment++ ) {
+    std::vector< double > P( mesh.getNumberOfDofs(), 0.0 );
+    std::fill( mesh.Pe.begin(), mesh.Pe.end(), 0.0 );
+    std::fill( mesh.Ke.begin(), mesh.Ke.end(), 0.0 );
+    throwExceptionOnFailure( mesh.execute( executor, P, true ) == 1.0, "unexpected cutback" );
+  }
+
+  Mesh reference;
+  for ( int increment = 0; increment < 3; increment++ ) {
+    std::vector< double > P( reference.getNumberOfDofs(), 0.0 );
+    std::fill( reference.Pe.begin(), reference.Pe.end(), 0.0 );
+    std::fill( reference.Ke.begin(), reference.Ke.end(), 0.0 );
+    reference.computeSequentially( P );
+  }
+
+  throwExceptionOnFailure( mesh.stateVars == reference.stateVars, "state variables differ after repeated increments" );
+}
+
+int main()
+{
+  auto tests = std::vector< std::function< void() > >{ testExecutorMatchesSequentialComputation,
+                                                       testExecutorIsReusable };
+
+  executeTestsAndCollectExceptions( tests );
+
+  return 0;
+}
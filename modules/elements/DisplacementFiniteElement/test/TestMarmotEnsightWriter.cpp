@@ -0,0 +1,227 @@
+#include "Marmot/Marmot.h"
+#include "Marmot/MarmotElementProperty.h"
+#include "Marmot/MarmotEnsightWriter.h"
+#include "Marmot/MarmotTesting.h"
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+using namespace Marmot::Testing;
+using namespace Marmot::Output;
+using namespace MarmotLibrary;
+
+/* A plane strain quad8 and a quad4 with different stiffnesses, deformed by a homogeneous strain. */
+struct Mesh {
+  const std::vector< double > nodeCoordinates = { 0, 0, 1, 0, 1, 1, 0, 1, 0.5, 0, 1, 0.5, 0.5, 1, 0, 0.5, 2, 0, 2, 1 };
+
+  const std::vector< std::vector< int > > connectivity = { { 0, 1, 2, 3, 4, 5, 6, 7 }, { 1, 8, 9, 2 } };
+  const std::vector< std::string >        names        = { "CPE8", "CPE4" };
+
+  /* elements and materials keep pointers to their properties */
+  const std::vector< std::vector< double > > materialProperties = { { 1000., 0.25, 1. }, { 2000., 0.25, 1. } };
+  const std::vector< double >                thickness          = { 1.0 };
+
+  std::vector< std::unique_ptr< MarmotElement > > elements;
+  std::vector< std::vector< double > >            coordinates, stateVars;
+  std::vector< double >                           displacements;
+
+  Mesh()
+  {
+    for ( size_t i = 0; i < nodeCoordinates.size(); i += 2 )
+      displacements.insert( displacements.end(),
+                            { 1e-3 * nodeCoordinates[i] + 2e-4 * nodeCoordinates[i + 1],
+                              -5e-4 * nodeCoordinates[i + 1] } );
+
+    for ( size_t e = 0; e < names.size(); e++ ) {
+      elements.emplace_back(
+        MarmotElementFactory::createElement( MarmotElementFactory::getElementCodeFromName( names[e] ), e + 1 ) );
+      MarmotElement& element = *elements.back();
+
+      std::vector< double > QTotal;
+      coordinates.emplace_back();
+      for ( int node : connectivity[e] )
+        for ( int i = 0; i < 2; i++ ) {
+          coordinates.back().push_back( nodeCoordinates[2 * node + i] );
+          QTotal.push_back( displacements[2 * node + i] );
+        }
+
+      element.assignNodeCoordinates( coordinates.back().data() );
+      element.assignProperty( ElementProperties( thickness.data(), thickness.size() ) );
+      element.assignProperty(
+        MarmotMaterialSection( MarmotMaterialFactory::getMaterialCodeFromName( "LINEARELASTIC" ),
+                               materialProperties[e].data(),
+                               materialProperties[e].size() ) );
+      stateVars.emplace_back( element.getNumberOfRequiredStateVars(), 0.0 );
+      element.assignStateVars( stateVars.back().data(), stateVars.back().size() );
+      element.initializeYourself();
+
+      std::vector< double > Pe( QTotal.size(), 0.0 ), Ke( QTotal.size() * QTotal.size(), 0.0 );
+      const double          time[] = { 0.0, 0.0 };
+      double                pNewDT = 1.0;
+      element.computeYourself( QTotal.data(), QTotal.data(), Pe.data(), Ke.data(), time, 1.0, pNewDT );
+    }
+  }
+};
+
+/* Sequential reader of the binary Ensight files. */
+struct Reader {
+  std::ifstream file;
+
+  Reader( const std::filesystem::path& fileName ) : file( fileName, std::ios::binary )
+  {
+    throwExceptionOnFailure( file.good(), MakeString() << "cannot open " << fileName );
+  }
+
+  std::string readString()
+  {
+    char buffer[80];
+    file.read( buffer, 80 );
+    return std::string( buffer, std::find( buffer, buffer + 80, '\0' ) );
+  }
+
+  template < typename T >
+  std::vector< T > read( int n )
+  {
+    std::vector< T > values( n );
+    file.read( reinterpret_cast< char* >( values.data() ), n * sizeof( T ) );
+    throwExceptionOnFailure( file.good(), "unexpected end of file" );
+    return values;
+  }
+
+  void expect( const std::string& string )
+  {
+    const std::string read = readString();
+    throwExceptionOnFailure( read == string,
+                             MakeString() << "expected '" << string << "' instead of '" << read << "'" );
+  }
+};
+
+void testEnsightWriter()
+{
+  Mesh                        mesh;
+  const std::filesystem::path directory = std::filesystem::temp_directory_path() / "TestMarmotEnsightWriter";
+  std::filesystem::remove_all( directory );
+
+  std::vector< MarmotElement* > elements;
+  std::vector< const int* >     connectivity;
+  for ( size_t e = 0; e < mesh.elements.size(); e++ ) {
+    elements.push_back( mesh.elements[e].get() );
+    connectivity.push_back( mesh.connectivity[e].data() );
+  }
+
+  {
+    EnsightWriter writer( directory.string(),
+                          "test",
+                          { mesh.nodeCoordinates.data(), 10, 2, elements.data(), 2, connectivity.data() } );
+    writer.addNodeField( "displacement", 2 );
+    writer.addElementField( "stress", "stress" );
+    writer.addElementField( "strain", "strain" );
+
+    std::vector< double > displacements = mesh.displacements;
+    const double*         nodeFields[]  = { displacements.data() };
+    writer.writeIncrement( 0.5, nodeFields );
+
+    // the first snapshot is already taken, the buffer can be modified while it is written
+    for ( double& u : displacements )
+      u *= 2;
+    writer.writeIncrement( 1.0, nodeFields );
+    writer.finish();
+
+    // the case file lists all fields for all steps, hence fields cannot be added later
+    bool isRejected = false;
+    try {
+      writer.addElementField( "stress2", "stress" );
+    }
+    catch ( const std::logic_error& ) {
+      isRejected = true;
+    }
+    throwExceptionOnFailure( isRejected, "field registered after the first increment" );
+  }
+
+  // case file with both increments
+  std::ifstream     caseFile( directory / "test.case" );
+  std::stringstream caseContent;
+  caseContent << caseFile.rdbuf();
+  for ( const std::string line : { "model: test.geo",
+                                   "vector per node: 1 displacement test.displacement.*****",
+                                   "tensor symm per element: 1 stress test.stress.*****",
+                                   "number of steps: 2",
+                                   "time values:\n0.5\n1\n" } )
+    throwExceptionOnFailure( caseContent.str().find( line ) != std::string::npos,
+                             MakeString() << "missing in case file: " << line );
+
+  // geometry with the elements grouped by shape
+  Reader geometry( directory / "test.geo" );
+  geometry.expect( "C Binary" );
+  geometry.readString();
+  geometry.readString();
+  geometry.expect( "node id off" );
+  geometry.expect( "element id off" );
+  geometry.expect( "part" );
+  throwExceptionOnFailure( geometry.read< int >( 1 )[0] == 1, "incorrect part number" );
+  geometry.readString();
+  geometry.expect( "coordinates" );
+  throwExceptionOnFailure( geometry.read< int >( 1 )[0] == 10, "incorrect number of nodes" );
+  const std::vector< float > coordinates = geometry.read< float >( 30 );
+  throwExceptionOnFailure( coordinates[8] == 2.0f && coordinates[19] == 1.0f && coordinates[29] == 0.0f,
+                           "incorrect coordinates" );
+  geometry.expect( "quad4" );
+  throwExceptionOnFailure( geometry.read< int >( 1 )[0] == 1, "incorrect number of quad4 elements" );
+  throwExceptionOnFailure( geometry.read< int >( 4 ) == std::vector< int >{ 2, 9, 10, 3 }, "incorrect quad4" );
+  geometry.expect( "quad8" );
+  throwExceptionOnFailure( geometry.read< int >( 1 )[0] == 1, "incorrect number of quad8 elements" );
+  throwExceptionOnFailure( geometry.read< int >( 8 ) == std::vector< int >{ 1, 2, 3, 4, 5, 6, 7, 8 },
+                           "incorrect quad8" );
+
+  // planar displacements of the second increment, component by component
+  Reader displacement( directory / "test.displacement.00001" );
+  displacement.expect( "displacement" );
+  displacement.expect( "part" );
+  displacement.read< int >( 1 );
+  displacement.expect( "coordinates" );
+  const std::vector< float > u = displacement.read< float >( 30 );
+  for ( int n = 0; n < 10; n++ )
+    for ( int i = 0; i < 3; i++ )
+      throwExceptionOnFailure( checkIfEqual( u[i * 10 + n], i < 2 ? 2 * mesh.displacements[2 * n + i] : 0.0, 1e-9 ),
+                               "incorrect displacement" );
+
+  // stress averaged over the quadrature points, in the order of the groups
+  Reader stress( directory / "test.stress.00000" );
+  stress.expect( "stress" );
+  stress.expect( "part" );
+  stress.read< int >( 1 );
+  for ( int e : { 1, 0 } ) {
+    stress.expect( mesh.elements[e]->getElementShape() );
+    const std::vector< float > values    = stress.read< float >( 6 );
+    const StateView            reference = mesh.elements[e]->getStateView( "stress", 0 );
+    for ( int i = 0; i < 6; i++ )
+      throwExceptionOnFailure( checkIfEqual( values[i], reference.stateLocation[i], 1e-5 ), "incorrect stress" );
+  }
+
+  // strain as symmetric tensor, i.e., with half the engineering shear strain
+  Reader strain( directory / "test.strain.00000" );
+  strain.expect( "strain" );
+  strain.expect( "part" );
+  strain.read< int >( 1 );
+  for ( int e : { 1, 0 } ) {
+    strain.expect( mesh.elements[e]->getElementShape() );
+    const std::vector< float > values    = strain.read< float >( 6 );
+    const StateView            reference = mesh.elements[e]->getStateView( "strain", 0 );
+    for ( int i = 0; i < 6; i++ )
+      throwExceptionOnFailure( checkIfEqual( values[i], ( i < 3 ? 1.0 : 0.5 ) * reference.stateLocation[i], 1e-9 ),
+                               "incorrect strain" );
+    throwExceptionOnFailure( checkIfEqual( values[3], 1e-4, 1e-9 ), "incorrect shear strain" );
+  }
+
+  std::filesystem::remove_all( directory );
+}
+
+int main()
+{
+  auto tests = std::vector< std::function< void() > >{ testEnsightWriter };
+
+  executeTestsAndCollectExceptions( tests );
+
+  return 0;
+}
@@ -460,10 +460,7 @@ namespace Marmot::Elements {
 
     for ( auto& qp : qps ) {
       qp.material = std::unique_ptr< Material >(
-        dynamic_cast< Material* >( MarmotLibrary::MarmotMaterialFactory::createMaterial( section.materialCode,
-                                                                                         section.materialProperties,
-                                                                                         section.nMaterialProperties,
-                                                                                         elLabel ) ) );
+        dynamic_cast< Material* >( MarmotLibrary::MarmotMaterialFactory::createMaterial( section, elLabel ) ) );
     }
   }
 
@@ -511,6 +508,9 @@ namespace Marmot::Elements {
   {
     using namespace Fastor;
 
+    countEvent( PerformanceCounters::ComputeYourselfCalls );
+    Tracing::ScopedSpan span( "computeYourself", "element", elementCode );
+
     const static Tensor< double, nDim, nDim > I(
       ( Eigen::Matrix< double, nDim, nDim >() << Eigen::Matrix< double, nDim, nDim >::Identity() ).finished().data() );
 
@@ -525,7 +525,10 @@ namespace Marmot::Elements {
 
     Eigen::Map< Eigen::VectorXd > rhs( rightHandSide, sizeLoadVector );
 
-    for ( auto& qp : qps ) {
+    status = {};
+
+    for ( size_t qpIndex = 0; qpIndex < qps.size(); qpIndex++ ) {
+      auto& qp = qps[qpIndex];
 
       using namespace Marmot::FastorIndices;
 
@@ -541,6 +544,8 @@ namespace Marmot::Elements {
 
       Material::ConstitutiveResponse< nDim > response;
       Material::AlgorithmicModuli< nDim >    tangents;
+
+      qp.material->resetStatus();
       try {
         if constexpr ( nDim == 2 ) {
 
@@ -593,7 +598,15 @@ namespace Marmot::Elements {
         }
       }
       catch ( const std::runtime_error& ) {
+        // materials not signalling a cutback by their status
         pNewDT = 0.25;
+        requestCutback(
+          Status::atQuadraturePoint( Status::cutback( Status::ExceptionCaught, pNewDT ), pNewDT, qpIndex ) );
+        return;
+      }
+      if ( const Status& materialStatus = qp.material->getStatus(); !materialStatus.isSuccess() ) {
+        pNewDT = materialStatus.suggestedDTFactor;
+        requestCutback( Status::atQuadraturePoint( materialStatus, pNewDT, qpIndex ) );
         return;
       }
       const auto dNdx = evaluate( einsum< ji, jA >( inv( F_np ), dNdX ) );
@@ -818,6 +831,9 @@ namespace Marmot::Elements {
 
     using namespace Fastor;
 
+    this->countEvent( PerformanceCounters::ComputeYourselfCalls );
+    Tracing::ScopedSpan span( "computeYourself", "element", this->elementCode );
+
     const static Tensor< double, nDim, nDim > I(
       ( Eigen::Matrix< double, nDim, nDim >() << Eigen::Matrix< double, nDim, nDim >::Identity() ).finished().data() );
 
@@ -832,7 +848,10 @@ namespace Marmot::Elements {
 
     Eigen::Map< Eigen::VectorXd > rhs( rightHandSide, sizeLoadVector );
 
-    for ( auto& qp : Parent::qps ) {
+    this->status = {};
+
+    for ( size_t qpIndex = 0; qpIndex < Parent::qps.size(); qpIndex++ ) {
+      auto& qp = Parent::qps[qpIndex];
 
       using namespace Marmot::FastorIndices;
 
@@ -870,11 +889,20 @@ namespace Marmot::Elements {
 
       deformation3D.F( 2, 2 ) = 1 + u_np[0] / r;
 
+      qp.material->resetStatus();
       try {
         qp.material->computePlaneStrain( response3D, algorithmicModuli3D, deformation3D, timeIncrement );
       }
       catch ( const std::runtime_error& ) {
+        // materials not signalling a cutback by their status
         pNewDT = 0.25;
+        this->requestCutback(
+          Status::atQuadraturePoint( Status::cutback( Status::ExceptionCaught, pNewDT ), pNewDT, qpIndex ) );
+        return;
+      }
+      if ( const Status& materialStatus = qp.material->getStatus(); !materialStatus.isSuccess() ) {
+        pNewDT = materialStatus.suggestedDTFactor;
+        this->requestCutback( Status::atQuadraturePoint( materialStatus, pNewDT, qpIndex ) );
         return;
       }
       response = { reduceTo2D< U, U >( response3D.tau ), response3D.rho, response3D.elasticEnergyDensity };
@@ -39,7 +39,7 @@ namespace Marmot::Materials {
     if ( nStateVars < getNumberOfRequiredStateVars() )
       throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << ": Not sufficient stateVars!" );
 
-    managedStateVars = std::make_unique< ADVonMisesModelStateVarManager >( stateVars );
+    bindStateVarManager( managedStateVars, stateVars );
     return MarmotMaterialHypoElasticAD::assignStateVars( stateVars, nStateVars );
   }
 
@@ -80,10 +80,18 @@ namespace Marmot::Materials {
       dual   dLambda( 0.0 );
       double dg_ddKappa( 0.0 );
 
-      while ( abs( g( (double)rhoTrial, kappa, (double)dKappa ) ) > ADVonMisesConstants::innerNewtonTol ) {
+      // start from the solution of the previous global iteration, if warm starting is enabled; the warm start seeds
+      // only the value, so at least one correction is required to propagate the derivatives w.r.t. the strain
+      bool isCorrectionRequired = warmStartInnerNewton( timeOld[1], dT, &dKappa.val, 1 );
+
+      Tracing::ScopedSpan innerNewtonSpan( "innerNewton", "material", materialCode );
+      while ( isCorrectionRequired ||
+              abs( g( (double)rhoTrial, kappa, (double)dKappa ) ) > ADVonMisesConstants::innerNewtonTol ) {
+        isCorrectionRequired = false;
 
         if ( counter == ADVonMisesConstants::nMaxInnerNewtonCycles ) {
           pNewDT = 0.25;
+          requestCutback( Status::InnerNewtonNotConverged, pNewDT );
           return;
         }
 
@@ -95,7 +103,10 @@ namespace Marmot::Materials {
         // update dKappa and iteration counter
         dKappa -= g( rhoTrial, kappa, dKappa ) / dg_ddKappa;
         counter += 1;
+        countInnerNewtonIteration();
       }
+      innerNewtonSpan.end();
+      storeInnerNewtonSolution( timeOld[1], dT, &dKappa.val, 1 );
 
       // compute plastic corrector
       dLambda = Constants::sqrt3_2 * dKappa;
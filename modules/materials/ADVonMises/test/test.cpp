@@ -1,5 +1,8 @@
+#include "Marmot/Marmot.h"
+#include "Marmot/MarmotMaterialHypoElastic.h"
 #include "Marmot/MarmotTesting.h"
 #include "Marmot/MarmotTypedefs.h"
+#include <memory>
 
 using namespace Marmot::Testing;
 
@@ -67,9 +70,71 @@ void testADVonMises()
   throwExceptionOnFailure( checkIfEqual< double >( history.back().stress, stressTarget, 1e-9 ),
                            "comparison with reference solution failed" );
 }
+
+void testADVonMisesWarmStart()
+{
+  // global iterations of an increment recompute the material point from the same state with converging strains;
+  // the last iteration repeats the strain, for which the warm start already satisfies the tolerance
+  std::vector< double > materialProperties = { 210000., 0.3, 200., 2100., 20., 20 };
+  const int             code = MarmotLibrary::MarmotMaterialFactory::getMaterialCodeFromName( "ADVONMISES" );
+
+  auto createMaterial = [&]() {
+    return std::unique_ptr< MarmotMaterialHypoElastic >(
+      dynamic_cast< MarmotMaterialHypoElastic* >( MarmotLibrary::MarmotMaterialFactory::
+                                                     createMaterial( code,
+                                                                     materialProperties.data(),
+                                                                     materialProperties.size(),
+                                                                     1 ) ) );
+  };
+
+  auto cold = createMaterial();
+  auto warm = createMaterial();
+  cold->setInnerNewtonWarmStart( false );
+  warm->setInnerNewtonWarmStart( true );
+
+  const int             nStateVars = cold->getNumberOfRequiredStateVars();
+  std::vector< double > stateVarsCold( nStateVars ), stateVarsWarm( nStateVars );
+  cold->assignStateVars( stateVarsCold.data(), nStateVars );
+  warm->assignStateVars( stateVarsWarm.data(), nStateVars );
+
+  Marmot::Matrix6d C, CWarm;
+  double           time[2] = { 0.0, 1.0 };
+  double           pNewDT  = 1.0;
+
+  int nIterationsCold = 0, nIterationsWarm = 0;
+
+  for ( int iteration = 0; iteration < 6; iteration++ ) {
+    Marmot::Vector6d dE;
+    dE << 0.004, -0.001, 0.002, 0.001, 0., 0.;
+    dE *= 1.0 + std::pow( 0.1, std::min( iteration, 4 ) + 1 );
+
+    // each iteration starts from the converged state of the previous increment
+    std::fill( stateVarsCold.begin(), stateVarsCold.end(), 0.0 );
+    std::fill( stateVarsWarm.begin(), stateVarsWarm.end(), 0.0 );
+
+    Marmot::Vector6d stress = Marmot::Vector6d::Zero(), stressWarm = Marmot::Vector6d::Zero();
+    cold->resetStatus();
+    warm->resetStatus();
+    cold->computeStress( stress.data(), C.data(), dE.data(), time, 1.0, pNewDT );
+    warm->computeStress( stressWarm.data(), CWarm.data(), dE.data(), time, 1.0, pNewDT );
+
+    nIterationsCold += cold->getNumberOfInnerNewtonIterations();
+    nIterationsWarm += warm->getNumberOfInnerNewtonIterations();
+
+    throwExceptionOnFailure( warm->getNumberOfInnerNewtonIterations() > 0, "no correction after the warm start" );
+    throwExceptionOnFailure( checkIfEqual< double >( stress, stressWarm, 1e-8 ), "stresses differ" );
+    throwExceptionOnFailure( checkIfEqual< double >( C, CWarm, 1e-6 ), "tangents differ" );
+    throwExceptionOnFailure( checkIfEqual( stateVarsCold[0], stateVarsWarm[0], 1e-14 ), "state variables differ" );
+  }
+
+  throwExceptionOnFailure( nIterationsWarm < nIterationsCold, "warm start does not save inner Newton iterations" );
+}
+
 int main()
 {
-  std::vector< std::function< void() > > tests = { testADVonMisesCoordinateInvariance, testADVonMises };
+  std::vector< std::function< void() > > tests = { testADVonMisesCoordinateInvariance,
+                                                   testADVonMises,
+                                                   testADVonMisesWarmStart };
 
   executeTestsAndCollectExceptions( tests );
 
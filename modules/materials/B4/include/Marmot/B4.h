@@ -190,7 +190,33 @@ namespace Marmot::Materials {
 
     StateView getStateView( const std::string& stateName );
 
+    std::shared_ptr< MarmotMaterialSectionData > createSectionData() override;
+
+  protected:
+    void beginIncrement( MarmotMaterialSectionData& sectionData, const double* time, double dT ) override;
+
   private:
+    /// \brief data shared by all materials of a section
+    struct SectionData : MarmotMaterialSectionData {
+      /// \brief compliance tensor with unit Young's modulus
+      Matrix6d CelUnitInv;
+      /// \brief retardation times of the Kelvin units representing drying creep
+      KelvinChain::Properties dryingCreepRetardationTimes;
+
+      /// \brief start time of the current increment in days
+      double tStartDays;
+      /// \brief time increment in days
+      double dTimeDays;
+      /// \brief factors of the Kelvin units representing basic creep for the current increment
+      KelvinChain::IncrementFactors basicCreepFactors;
+      /// \brief factors of the Kelvin units representing drying creep for the current increment
+      KelvinChain::IncrementFactors dryingCreepFactors;
+      /// \brief Young's modulus of the Kelvin units representing drying creep for the current increment
+      KelvinChain::Properties dryingCreepElasticModuli;
+      /// \brief shrinkage strain increment of the current increment
+      Vector6d shrinkageStrainIncrement;
+    };
+
     /// \brief material parameters for Solidification Theory
     SolidificationTheory::Parameters solidificationParameters;
     /**
@@ -74,6 +74,18 @@ namespace Marmot::Materials {
       const KelvinChainProperties&                           kelvinChainProperties,
       const Eigen::Ref< const KelvinChain::StateVarMatrix >& kelvinStateVars );
 
+    /// \brief creep strain increment and compliance components with precomputed factors of the Kelvin chain
+    Result computeCreepStrainIncrementAndComplianceComponents(
+      double                                                 tStartDays,
+      double                                                 dTimeDays,
+      double                                                 amplificationFactor,
+      const Marmot::Matrix6d&                                flowUnitCompliance,
+      const Marmot::Vector6d&                                stressOld,
+      const Parameters&                                      parameters,
+      const KelvinChainProperties&                           kelvinChainProperties,
+      const KelvinChain::IncrementFactors&                   kelvinChainFactors,
+      const Eigen::Ref< const KelvinChain::StateVarMatrix >& kelvinStateVars );
+
     /// \brief solidified volume function according to %Solidification Theory
     double solidifiedVolume( double timeInDays, Parameters params );
 
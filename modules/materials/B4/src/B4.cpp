@@ -72,11 +72,15 @@ namespace Marmot::Materials {
                           double&       pNewDT )
 
   {
+    countEvent( PerformanceCounters::ComputeStressCalls );
+    Tracing::ScopedSpan span( "computeStress", "material", materialCode );
+
     mVector6d nomStress( stress );
     Vector6d  dE( dStrain );
     mMatrix6d C( dStressDDStrain );
 
     if ( ( dE.array() == 0 ).all() && dT == 0 ) {
+      restoreStateVars();
       C = ContinuumMechanics::Elasticity::Isotropic::stiffnessTensor( 1e6 / q1, nu );
       return;
     }
@@ -86,43 +90,35 @@ namespace Marmot::Materials {
     Eigen::Ref< KelvinChain::mapStateVarMatrix > dryingCreepStateVars(
       ( stateVarManager->kelvinStateVars ).rightCols( nKelvinDrying ) );
 
-    const double dTimeDays  = dT * timeToDays;
-    const double tStartDays = ( time[1] - dT - castTime ) * timeToDays;
+    // the Kelvin chains at the begin of the increment, read from the old state variables instead of copying them
+    const Map< const KelvinChain::StateVarMatrix > kelvinStateVarsOld(
+      getStateVarAtBeginOfIncrement( stateVarManager->kelvinStateVars.data() ),
+      6,
+      nKelvinBasic + nKelvinDrying );
 
-    Matrix6d CelUnitInv = ContinuumMechanics::Elasticity::Isotropic::complianceTensor( 1.0, nu );
+    // quantities identical for all materials of the section, computed once per increment
+    const SectionData& sectionData = getSectionData< SectionData >( time, dT );
+    const Matrix6d&    CelUnitInv  = sectionData.CelUnitInv;
 
     // compute basic creep strains and compliance
     auto [basicCreepStrainIncrement, basicCreepUniaxialComplianceComponents] = SolidificationTheory::
-      computeCreepStrainIncrementAndComplianceComponents( tStartDays,
-                                                          dTimeDays,
+      computeCreepStrainIncrementAndComplianceComponents( sectionData.tStartDays,
+                                                          sectionData.dTimeDays,
                                                           1.0,
                                                           CelUnitInv,
                                                           nomStress,
                                                           solidificationParameters,
                                                           solidificationKelvinProperties,
-                                                          basicCreepStateVars );
-
-    // compute drying creep strains and compliancei
-    KelvinChain::Properties dryingCreepRetardationTimes = KelvinChain::generateRetardationTimes( nKelvinDrying,
-                                                                                                 minTauDrying,
-                                                                                                 sqrt( 10. ) );
-    double                  b                           = 8. * ( 1. - hEnv );
-    double xiZero = std::min( -1e-16, ( dryingStart - tStartDays - dTimeDays / 2. ) / dryingShrinkageHalfTime );
-
-    auto phiDrying = [&]( autodiff::Real< dryingCreepComplianceApproximationOrder, double > tau ) {
-      return phi( tau, b, xiZero );
-    };
-
-    KelvinChain::Properties dryingCreepElasticModuli = KelvinChain::computeElasticModuli<
-      dryingCreepComplianceApproximationOrder >( phiDrying, dryingCreepRetardationTimes );
+                                                          sectionData.basicCreepFactors,
+                                                          kelvinStateVarsOld.leftCols( nKelvinBasic ) );
 
+    // compute drying creep strains and compliance
     Vector6d dryingCreepStrainIncrement = Vector6d::Zero();
     double   dryingCreepCompliance      = 0;
 
-    KelvinChain::evaluateKelvinChain( dTimeDays / dryingShrinkageHalfTime,
-                                      dryingCreepElasticModuli,
-                                      dryingCreepRetardationTimes,
-                                      dryingCreepStateVars,
+    KelvinChain::evaluateKelvinChain( sectionData.dryingCreepFactors,
+                                      sectionData.dryingCreepElasticModuli,
+                                      kelvinStateVarsOld.rightCols( nKelvinDrying ),
                                       dryingCreepCompliance,
                                       dryingCreepStrainIncrement,
                                       1e-6 * q5 / exp( 4 ) );
@@ -131,46 +127,85 @@ namespace Marmot::Materials {
                                  basicCreepUniaxialComplianceComponents.viscoelastic +
                                  basicCreepUniaxialComplianceComponents.flow + dryingCreepCompliance;
 
-    // compute shrinkage strain increment
-    Vector6d
-      shrinkageStrainIncrement = Shrinkage::B4::computeShrinkageStrainIncrement( tStartDays,
-                                                                                 dTimeDays,
-                                                                                 ultimateAutogenousShrinkageStrain,
-                                                                                 autogenousShrinkageHalfTime,
-                                                                                 alpha,
-                                                                                 rt,
-                                                                                 ultimateDryingShrinkageStrain,
-                                                                                 dryingShrinkageHalfTime,
-                                                                                 1. - hEnv * hEnv * hEnv,
-                                                                                 dryingStart );
-
     C                    = ContinuumMechanics::Elasticity::Isotropic::stiffnessTensor( 1. / effectiveCompliance, nu );
-    Vector6d deltaStress = C *
-                           ( dE - basicCreepStrainIncrement - dryingCreepStrainIncrement - shrinkageStrainIncrement );
+    Vector6d deltaStress = C * ( dE - basicCreepStrainIncrement - dryingCreepStrainIncrement -
+                                 sectionData.shrinkageStrainIncrement );
     nomStress = nomStress + deltaStress;
 
-    KelvinChain::updateStateVarMatrix( dTimeDays / dryingShrinkageHalfTime,
-                                       dryingCreepElasticModuli,
-                                       dryingCreepRetardationTimes,
+    KelvinChain::updateStateVarMatrix( sectionData.dryingCreepFactors,
+                                       sectionData.dryingCreepElasticModuli,
+                                       kelvinStateVarsOld.rightCols( nKelvinDrying ),
                                        dryingCreepStateVars,
                                        deltaStress,
                                        CelUnitInv );
 
-    KelvinChain::updateStateVarMatrix( dTimeDays,
+    KelvinChain::updateStateVarMatrix( sectionData.basicCreepFactors,
                                        solidificationKelvinProperties.elasticModuli,
-                                       solidificationKelvinProperties.retardationTimes,
+                                       kelvinStateVarsOld.leftCols( nKelvinBasic ),
                                        basicCreepStateVars,
                                        deltaStress,
                                        CelUnitInv );
     return;
   }
 
+  std::shared_ptr< MarmotMaterialSectionData > B4::createSectionData()
+  {
+    auto sectionData                         = std::make_shared< SectionData >();
+    sectionData->CelUnitInv                  = ContinuumMechanics::Elasticity::Isotropic::complianceTensor( 1.0, nu );
+    sectionData->dryingCreepRetardationTimes = KelvinChain::generateRetardationTimes( nKelvinDrying,
+                                                                                      minTauDrying,
+                                                                                      sqrt( 10. ) );
+    return sectionData;
+  }
+
+  void B4::beginIncrement( MarmotMaterialSectionData& sectionData_, const double* time, double dT )
+  {
+    auto& sectionData = static_cast< SectionData& >( sectionData_ );
+
+    const double dTimeDays  = dT * timeToDays;
+    const double tStartDays = ( time[1] - dT - castTime ) * timeToDays;
+
+    sectionData.tStartDays = tStartDays;
+    sectionData.dTimeDays  = dTimeDays;
+
+    sectionData.basicCreepFactors = KelvinChain::computeIncrementFactors( dTimeDays,
+                                                                          solidificationKelvinProperties
+                                                                            .retardationTimes );
+
+    // drying creep compliance of the increment
+    double b      = 8. * ( 1. - hEnv );
+    double xiZero = std::min( -1e-16, ( dryingStart - tStartDays - dTimeDays / 2. ) / dryingShrinkageHalfTime );
+
+    auto phiDrying = [&]( autodiff::Real< dryingCreepComplianceApproximationOrder, double > tau ) {
+      return phi( tau, b, xiZero );
+    };
+
+    sectionData.dryingCreepElasticModuli = KelvinChain::computeElasticModuli<
+      dryingCreepComplianceApproximationOrder >( phiDrying, sectionData.dryingCreepRetardationTimes );
+
+    sectionData.dryingCreepFactors = KelvinChain::computeIncrementFactors( dTimeDays / dryingShrinkageHalfTime,
+                                                                           sectionData.dryingCreepRetardationTimes );
+
+    // compute shrinkage strain increment
+    sectionData.shrinkageStrainIncrement = Shrinkage::B4::
+      computeShrinkageStrainIncrement( tStartDays,
+                                       dTimeDays,
+                                       ultimateAutogenousShrinkageStrain,
+                                       autogenousShrinkageHalfTime,
+                                       alpha,
+                                       rt,
+                                       ultimateDryingShrinkageStrain,
+                                       dryingShrinkageHalfTime,
+                                       1. - hEnv * hEnv * hEnv,
+                                       dryingStart );
+  }
+
   void B4::assignStateVars( double* stateVars_, int nStateVars )
   {
     if ( nStateVars < getNumberOfRequiredStateVars() )
       throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << ": Not sufficient stateVars!" );
 
-    this->stateVarManager = std::make_unique< B4StateVarManager >( stateVars_, nKelvinBasic + nKelvinDrying );
+    bindStateVarManager( this->stateVarManager, stateVars_, nKelvinBasic + nKelvinDrying );
 
     MarmotMaterial::assignStateVars( stateVars_, nStateVars );
   }
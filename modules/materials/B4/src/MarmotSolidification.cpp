@@ -36,6 +36,29 @@ namespace Marmot::Materials {
       const KelvinChainProperties&                           kelvinChainProperties,
       const Eigen::Ref< const KelvinChain::StateVarMatrix >& kelvinStateVars )
     {
+      return computeCreepStrainIncrementAndComplianceComponents(
+        tStartDays,
+        dTimeDays,
+        amplificationFactor,
+        flowUnitCompliance,
+        stressOld,
+        parameters,
+        kelvinChainProperties,
+        KelvinChain::computeIncrementFactors( dTimeDays, kelvinChainProperties.retardationTimes ),
+        kelvinStateVars );
+    }
+
+    Result computeCreepStrainIncrementAndComplianceComponents(
+      double                                                 tStartDays,
+      double                                                 dTimeDays,
+      double                                                 amplificationFactor,
+      const Marmot::Matrix6d&                                flowUnitCompliance,
+      const Marmot::Vector6d&                                stressOld,
+      const Parameters&                                      parameters,
+      const KelvinChainProperties&                           kelvinChainProperties,
+      const KelvinChain::IncrementFactors&                   kelvinChainFactors,
+      const Eigen::Ref< const KelvinChain::StateVarMatrix >& kelvinStateVars )
+    {
 
       Vector6d                     dECreep = Vector6d::Zero();
       UniaxialComplianceComponents complianceComponents;
@@ -53,9 +76,8 @@ namespace Marmot::Materials {
 
       complianceComponents.viscoelastic = parameters.q2 / ( v * kelvinChainProperties.E0 ) * amplificationFactor * 1e-6;
 
-      KelvinChain::evaluateKelvinChain( dTimeDays,
+      KelvinChain::evaluateKelvinChain( kelvinChainFactors,
                                         kelvinChainProperties.elasticModuli,
-                                        kelvinChainProperties.retardationTimes,
                                         kelvinStateVars,
                                         complianceComponents.viscoelastic,
                                         dECreep,
@@ -1,3 +1,6 @@
+#include "Marmot/Marmot.h"
+#include "Marmot/MarmotElementProperty.h"
+#include "Marmot/MarmotMaterialHypoElastic.h"
 #include "Marmot/MarmotTesting.h"
 #include <Eigen/Dense>
 
@@ -130,9 +133,84 @@ void testB4CoordinateInvariance()
   throwExceptionOnFailure( spinTurbokreisel( solver, 1e-10, 1e-8 ), "Turbokreisel failed!" );
 }
 
+void testB4SectionData()
+{
+  // materials of a section share the quantities of an increment, which are computed by the first material
+  auto materialProperties = getMaterialPropertiesB4();
+  materialProperties[16]  = 0.5; // drying creep and drying shrinkage
+
+  const int             code = MarmotLibrary::MarmotMaterialFactory::getMaterialCodeFromName( "B4" );
+  MarmotMaterialSection section( code, materialProperties.data(), materialProperties.size() );
+
+  std::vector< std::unique_ptr< MarmotMaterialHypoElastic > > materials;
+  for ( int i = 0; i < 3; i++ )
+    materials.emplace_back( dynamic_cast< MarmotMaterialHypoElastic* >(
+      MarmotLibrary::MarmotMaterialFactory::createMaterial( section, i + 1 ) ) );
+
+  throwExceptionOnFailure( section.sectionData && section.sectionData.use_count() == 4, "section data not shared" );
+
+  // a distinct section object with identical code and properties, e.g., of another model, has its own data
+  const auto            equalProperties = materialProperties;
+  MarmotMaterialSection equalSection( code, equalProperties.data(), equalProperties.size() );
+  materials.emplace_back( dynamic_cast< MarmotMaterialHypoElastic* >(
+    MarmotLibrary::MarmotMaterialFactory::createMaterial( equalSection, 5 ) ) );
+  throwExceptionOnFailure( equalSection.sectionData && equalSection.sectionData != section.sectionData,
+                           "section data of equal sections shared without opting in" );
+  materials.pop_back();
+
+  // equal sections opting in share their data
+  MarmotMaterialSection sharingSection( code, materialProperties.data(), materialProperties.size() );
+  MarmotMaterialSection equalSharingSection( code, equalProperties.data(), equalProperties.size() );
+  sharingSection.isSharingDataWithEqualSections      = true;
+  equalSharingSection.isSharingDataWithEqualSections = true;
+  std::unique_ptr< MarmotMaterial > sharingMaterial(
+    MarmotLibrary::MarmotMaterialFactory::createMaterial( sharingSection, 6 ) );
+  std::unique_ptr< MarmotMaterial > equalSharingMaterial(
+    MarmotLibrary::MarmotMaterialFactory::createMaterial( equalSharingSection, 7 ) );
+  throwExceptionOnFailure( sharingSection.sectionData && equalSharingSection.sectionData == sharingSection.sectionData,
+                           "section data of equal sections opting in not shared" );
+
+  // a material created without a section owns its section data, and computes the same quantities
+  materials.emplace_back( dynamic_cast< MarmotMaterialHypoElastic* >(
+    MarmotLibrary::MarmotMaterialFactory::createMaterial( code,
+                                                          materialProperties.data(),
+                                                          materialProperties.size(),
+                                                          4 ) ) );
+
+  const int                            nStateVars = materials[0]->getNumberOfRequiredStateVars();
+  std::vector< std::vector< double > > stateVars( 4, std::vector< double >( nStateVars, 0.0 ) );
+  for ( int i = 0; i < 4; i++ )
+    materials[i]->assignStateVars( stateVars[i].data(), nStateVars );
+
+  std::vector< Marmot::Vector6d > stress( 4, Marmot::Vector6d::Zero() );
+  std::vector< Marmot::Matrix6d > C( 4 );
+  double                          time[2] = { 28.0, 28.0 };
+
+  for ( int increment = 0; increment < 4; increment++ ) {
+    const double dT = 10.0 * ( increment + 1 );
+    time[0] += dT;
+    time[1] += dT;
+
+    // the host may prepare the increment ahead of the computations
+    if ( increment % 2 == 1 )
+      materials[1]->prepareIncrement( time, dT );
+
+    for ( int i = 0; i < 4; i++ ) {
+      Marmot::Vector6d dE;
+      dE << 1e-5 * ( i % 3 + 1 ), -2e-6, 0., 1e-6, 0., 0.;
+      double pNewDT = 1.0;
+      materials[i]->computeStress( stress[i].data(), C[i].data(), dE.data(), time, dT, pNewDT );
+    }
+
+    throwExceptionOnFailure( checkIfEqual< double >( stress[0], stress[3], 1e-12 ), "stresses differ" );
+    throwExceptionOnFailure( checkIfEqual< double >( C[0], C[3], 1e-12 ), "tangents differ" );
+    throwExceptionOnFailure( stateVars[0] == stateVars[3], "state variables differ" );
+  }
+}
+
 int main()
 {
-  std::vector< std::function< void() > > tests = { testB4, testB4CoordinateInvariance };
+  std::vector< std::function< void() > > tests = { testB4, testB4CoordinateInvariance, testB4SectionData };
   executeTestsAndCollectExceptions( tests );
   return 0;
 }
@@ -30,6 +30,9 @@ namespace Marmot::Materials {
                                             const Deformation< 3 >&    deformation,
                                             const TimeIncrement&       timeIncrement )
   {
+    countEvent( PerformanceCounters::ComputeStressCalls );
+    Tracing::ScopedSpan span( "computeStress", "material", materialCode );
+
     const double& K = materialProperties[0];
     const double& G = materialProperties[1];
 
@@ -35,6 +35,12 @@ namespace Marmot::Materials {
                                                 const Deformation< 3 >&    deformation,
                                                 const TimeIncrement&       timeIncrement )
   {
+    countEvent( PerformanceCounters::ComputeStressCalls );
+    Tracing::ScopedSpan span( "computeStress", "material", materialCode );
+
+    // the return mappings update the state variables in place
+    restoreStateVars();
+
     switch ( implementationType ) {
 
     case 0: computeStressWithScalarReturnMapping( response, tangents, deformation, timeIncrement ); break;
@@ -95,18 +101,28 @@ namespace Marmot::Materials {
       VectorXd        R  = VectorXd::Zero( 11 );
       Eigen::MatrixXd dR_dX( 11, 11 );
 
+      // start the elastic deformation gradient, the hardening variable and the plastic multiplier from the solution
+      // of the previous global iteration, if warm starting is enabled
+      warmStartInnerNewton( timeIncrement.time, timeIncrement.dT, X.data(), X.size() );
+
       std::tie( R, dR_dX ) = computeResidualVectorAndTangent( X, FeTrial, alphaPOld );
 
+      Tracing::ScopedSpan innerNewtonSpan( "innerNewton", "material", materialCode );
       while ( R.norm() > 1e-12 || dX.norm() > 1e-12 ) {
 
-        if ( counter > 10 )
-          throw std::runtime_error( "inner newton not converged" );
+        if ( counter > 10 ) {
+          requestCutback( Status::InnerNewtonNotConverged, 0.25 );
+          return;
+        }
 
         dX = -dR_dX.colPivHouseholderQr().solve( R );
         X += dX;
         std::tie( R, dR_dX ) = computeResidualVectorAndTangent( X, FeTrial, alphaPOld );
         counter += 1;
+        countInnerNewtonIteration();
       }
+      innerNewtonSpan.end();
+      storeInnerNewtonSolution( timeIncrement.time, timeIncrement.dT, X.data(), X.size() );
       /* std::cout << "inner newton iters: " << counter << std::endl; */
 
       // update plastic deformation increment
@@ -227,6 +243,10 @@ namespace Marmot::Materials {
       VectorXd        R  = VectorXd::Zero( 11 );
       Eigen::MatrixXd dR_dX( 11, 11 );
 
+      // start the elastic deformation gradient, the hardening variable and the plastic multiplier from the solution
+      // of the previous global iteration, if warm starting is enabled
+      warmStartInnerNewton( timeIncrement.time, timeIncrement.dT, X.data(), X.size() );
+
       /* std::tie( R, dR_dX ) = computeResidualVectorAndTangent( X, FeTrial,
        * alphaPOld ); */
       R     = computeResidualVector( X, FeTrial, alphaP );
@@ -237,10 +257,13 @@ namespace Marmot::Materials {
         },
         X );
       try {
+        Tracing::ScopedSpan innerNewtonSpan( "innerNewton", "material", materialCode );
         while ( R.norm() > 1e-12 || dX.norm() > 1e-12 ) {
 
-          if ( counter > 10 )
-            throw std::runtime_error( "inner newton not converged" );
+          if ( counter > 10 ) {
+            requestCutback( Status::InnerNewtonNotConverged, 0.25 );
+            return;
+          }
 
           dX = -dR_dX.colPivHouseholderQr().solve( R );
           X += dX;
@@ -254,11 +277,13 @@ namespace Marmot::Materials {
             },
             X );
           counter += 1;
+          countInnerNewtonIteration();
         }
       }
       catch ( std::exception& e ) {
         throw std::runtime_error( "return mapping failed: " + std::string( e.what() ) );
       }
+      storeInnerNewtonSolution( timeIncrement.time, timeIncrement.dT, X.data(), X.size() );
       /* std::cout << "inner newton iters: " << counter << std::endl; */
 
       // update plastic deformation increment
@@ -389,6 +414,10 @@ namespace Marmot::Materials {
       VectorXd        R  = VectorXd::Zero( 11 );
       Eigen::MatrixXd dR_dX( 11, 11 );
 
+      // start the elastic deformation gradient, the hardening variable and the plastic multiplier from the solution
+      // of the previous global iteration, if warm starting is enabled
+      warmStartInnerNewton( timeIncrement.time, timeIncrement.dT, X.data(), X.size() );
+
       /* std::tie( R, dR_dX ) = computeResidualVectorAndTangent( X, FeTrial,
        * alphaPOld ); */
       R     = computeResidualVector( X, FeTrial, alphaP );
@@ -399,10 +428,13 @@ namespace Marmot::Materials {
         },
         X );
       try {
+        Tracing::ScopedSpan innerNewtonSpan( "innerNewton", "material", materialCode );
         while ( R.norm() > 1e-12 || dX.norm() > 1e-12 ) {
 
-          if ( counter > 10 )
-            throw std::runtime_error( "inner newton not converged" );
+          if ( counter > 10 ) {
+            requestCutback( Status::InnerNewtonNotConverged, 0.25 );
+            return;
+          }
 
           dX = -dR_dX.colPivHouseholderQr().solve( R );
           X += dX;
@@ -416,11 +448,13 @@ namespace Marmot::Materials {
             },
             X );
           counter += 1;
+          countInnerNewtonIteration();
         }
       }
       catch ( std::exception& e ) {
         throw std::runtime_error( "return mapping failed: " + std::string( e.what() ) );
       }
+      storeInnerNewtonSolution( timeIncrement.time, timeIncrement.dT, X.data(), X.size() );
       /* std::cout << "inner newton iters: " << counter << std::endl; */
 
       // update plastic deformation increment
@@ -552,6 +586,10 @@ namespace Marmot::Materials {
       VectorXd        R  = VectorXd::Zero( 11 );
       Eigen::MatrixXd dR_dX( 11, 11 );
 
+      // start the elastic deformation gradient, the hardening variable and the plastic multiplier from the solution
+      // of the previous global iteration, if warm starting is enabled
+      warmStartInnerNewton( timeIncrement.time, timeIncrement.dT, X.data(), X.size() );
+
       /* std::tie( R, dR_dX ) = computeResidualVectorAndTangent( X, FeTrial,
        * alphaPOld ); */
       /* R     = computeResidualVector( X, FeTrial, alphaP ); */
@@ -563,10 +601,13 @@ namespace Marmot::Materials {
         X );
       R = computeResidualVector( X, FeTrial, alphaP );
       try {
+        Tracing::ScopedSpan innerNewtonSpan( "innerNewton", "material", materialCode );
         while ( R.norm() > 1e-12 || dX.norm() > 1e-12 ) {
 
-          if ( counter > 10 )
-            throw std::runtime_error( "inner newton not converged" );
+          if ( counter > 10 ) {
+            requestCutback( Status::InnerNewtonNotConverged, 0.25 );
+            return;
+          }
 
           dX = -dR_dX.colPivHouseholderQr().solve( R );
           X += dX;
@@ -578,11 +619,13 @@ namespace Marmot::Materials {
             X );
           R = computeResidualVector( X, FeTrial, alphaP );
           counter += 1;
+          countInnerNewtonIteration();
         }
       }
       catch ( std::exception& e ) {
         throw std::runtime_error( "return mapping failed: " + std::string( e.what() ) );
       }
+      storeInnerNewtonSolution( timeIncrement.time, timeIncrement.dT, X.data(), X.size() );
       /* std::cout << "inner newton iters: " << counter << std::endl; */
 
       // update plastic deformation increment
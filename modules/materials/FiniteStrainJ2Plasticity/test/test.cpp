@@ -488,12 +488,77 @@ void testRotation()
   }
 }
 
+// Test I-5: Warm start of the return mapping
+void testWarmStart()
+{
+  // global iterations of an increment recompute the material point from the same state with converging deformations
+  for ( int k = 1; k < 5; k++ ) {
+    std::string algorithmName = getAlgorithmName( k );
+
+    std::array< double, 7 > materialProperties_ = { 175000, 80800, 260, 580, 9, 70, static_cast< double >( k ) };
+
+    FiniteStrainJ2Plasticity cold( &materialProperties_[0], 7, 1 );
+    FiniteStrainJ2Plasticity warm( &materialProperties_[0], 7, 1 );
+    cold.setInnerNewtonWarmStart( false );
+    warm.setInnerNewtonWarmStart( true );
+
+    std::array< double, 10 > stateVarsInitial;
+    std::memcpy( stateVarsInitial.data(), Marmot::FastorStandardTensors::Spatial3D::I.data(), 9 * sizeof( double ) );
+    stateVarsInitial[9] = 0.0;
+
+    std::array< double, 10 > stateVarsCold, stateVarsWarm;
+
+    FiniteStrainJ2Plasticity::Deformation< 3 > def;
+    FiniteStrainJ2Plasticity::TimeIncrement    timeInc = { 0, 0.1 };
+
+    FiniteStrainJ2Plasticity::ConstitutiveResponse< 3 > responseCold, responseWarm;
+    FiniteStrainJ2Plasticity::AlgorithmicModuli< 3 >    tangentCold, tangentWarm;
+
+    int nIterationsCold = 0, nIterationsWarm = 0;
+
+    for ( int iteration = 0; iteration < 5; iteration++ ) {
+      // the full elastic deformation gradient of the previous iteration is the initial guess
+      const double scaling = 1.0 + std::pow( 0.1, iteration + 1 );
+      def.F                = Marmot::FastorStandardTensors::Spatial3D::I;
+      def.F( 0, 0 ) += 0.01 * scaling;
+      def.F( 0, 1 ) += 0.06 * scaling;
+      def.F( 1, 0 ) += 0.02 * scaling;
+      def.F( 2, 2 ) -= 0.03 * scaling;
+
+      stateVarsCold = stateVarsInitial;
+      stateVarsWarm = stateVarsInitial;
+      cold.assignStateVars( stateVarsCold.data(), 10 );
+      warm.assignStateVars( stateVarsWarm.data(), 10 );
+
+      cold.resetStatus();
+      warm.resetStatus();
+      cold.computeStress( responseCold, tangentCold, def, timeInc );
+      warm.computeStress( responseWarm, tangentWarm, def, timeInc );
+
+      nIterationsCold += cold.getNumberOfInnerNewtonIterations();
+      nIterationsWarm += warm.getNumberOfInnerNewtonIterations();
+
+      throwExceptionOnFailure( checkIfEqual( responseCold.tau, responseWarm.tau, 1e-8 ),
+                               "I-5: Kirchhoff stress of the warm start differs for " + algorithmName );
+      throwExceptionOnFailure( checkIfEqual( tangentCold.dTau_dF, tangentWarm.dTau_dF, 1e-6 ),
+                               "I-5: Algorithmic tangent of the warm start differs for " + algorithmName );
+      for ( int i = 0; i < 10; i++ )
+        throwExceptionOnFailure( checkIfEqual( stateVarsCold[i], stateVarsWarm[i], 1e-12 ),
+                                 "I-5: State variables of the warm start differ for " + algorithmName );
+    }
+
+    throwExceptionOnFailure( nIterationsWarm < nIterationsCold,
+                             "I-5: Warm start does not save inner Newton iterations for " + algorithmName );
+  }
+}
+
 int main()
 {
   auto tests = std::vector< std::function< void() > >{ testUndeformedResponse,
                                                        testDeformationResponse,
                                                        testAlgorithmicTangent,
-                                                       testRotation };
+                                                       testRotation,
+                                                       testWarmStart };
 
   executeTestsAndCollectExceptions( tests );
 
@@ -145,13 +145,21 @@ namespace Marmot::Materials {
      */
     const double& G13;
 
-    /// @brief Material stiffness tensor.
-    /** #globalStiffnessTensor represents the materials stiffness tensor in voigt notation
-     * in the global coordinate system.
-     * It is calculated by the functions implemented in *MarmotElasticity.h*.
-     */
+    /// @brief Data shared by all materials of a section.
+    struct SectionData : MarmotMaterialSectionData {
+      /// @brief Material stiffness tensor.
+      /** #globalStiffnessTensor represents the materials stiffness tensor in voigt notation
+       * in the global coordinate system.
+       * It is calculated by the functions implemented in *MarmotElasticity.h*.
+       */
+      Matrix6d globalStiffnessTensor;
+    };
+
+    /// @brief Compute the material stiffness tensor in the global coordinate system.
+    Matrix6d computeGlobalStiffnessTensor();
 
-    Matrix6d globalStiffnessTensor;
+  public:
+    std::shared_ptr< MarmotMaterialSectionData > createSectionData() override;
 
     void computeStress( double* stress,
                         double* dStressDDStrain,
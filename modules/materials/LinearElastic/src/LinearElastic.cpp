@@ -37,6 +37,48 @@ namespace Marmot::Materials {
   {
   }
 
+  Matrix6d LinearElastic::computeGlobalStiffnessTensor()
+  {
+    if ( anisotropicType == Type::Isotropic )
+      return Isotropic::stiffnessTensor( E1, nu12 );
+
+    // set coordinate system for transversly isotropic and orthotropic materials
+    const int i          = nMaterialProperties % 2 == 0 ? nMaterialProperties - 7 : nMaterialProperties - 6;
+    Vector3d  direction1 = { materialProperties[i], materialProperties[i + 1], materialProperties[i + 2] };
+    Vector3d  direction2 = { materialProperties[i + 3], materialProperties[i + 4], materialProperties[i + 5] };
+
+    Matrix3d localCoordinateSystem = Marmot::Math::orthonormalCoordinateSystem( direction1, direction2 );
+    using namespace ContinuumMechanics::VoigtNotation::Transformations;
+    Matrix6d transformStrainToLocalSystem  = transformationMatrixStrainVoigt( localCoordinateSystem );
+    Matrix6d transformStressToGlobalSystem = transformationMatrixStressVoigt( localCoordinateSystem )
+                                               .colPivHouseholderQr()
+                                               .solve( Matrix6d::Identity() );
+
+    Matrix6d localStiffnessTensor;
+    Matrix6d globalStiffnessTensor;
+
+    switch ( anisotropicType ) {
+    case Type::Isotropic: globalStiffnessTensor = Isotropic::stiffnessTensor( E1, nu12 ); break;
+    case Type::TransverseIsotropic:
+      localStiffnessTensor  = TransverseIsotropic::stiffnessTensor( E1, E2, nu12, nu23, G12 );
+      globalStiffnessTensor = transformStressToGlobalSystem * localStiffnessTensor * transformStrainToLocalSystem;
+      break;
+    case Type::Orthotropic:
+      localStiffnessTensor  = Orthotropic::stiffnessTensor( E1, E2, E3, nu12, nu23, nu13, G12, G23, G13 );
+      globalStiffnessTensor = transformStressToGlobalSystem * localStiffnessTensor * transformStrainToLocalSystem;
+      break;
+    };
+
+    return globalStiffnessTensor;
+  }
+
+  std::shared_ptr< MarmotMaterialSectionData > LinearElastic::createSectionData()
+  {
+    auto sectionData                   = std::make_shared< SectionData >();
+    sectionData->globalStiffnessTensor = computeGlobalStiffnessTensor();
+    return sectionData;
+  }
+
   void LinearElastic::computeStress( double*       stress,
                                      double*       dStressDDStrain,
                                      const double* dStrain,
@@ -44,37 +86,11 @@ namespace Marmot::Materials {
                                      const double  dT,
                                      double&       pNewDT )
   {
-    // set global stiffness tensor
-    if ( anisotropicType == Type::Isotropic ) {
-      globalStiffnessTensor = Isotropic::stiffnessTensor( E1, nu12 );
-    }
-    else {
-      // set coordinate system for transversly isotropic and orthotropic materials
-      const int i          = nMaterialProperties % 2 == 0 ? nMaterialProperties - 7 : nMaterialProperties - 6;
-      Vector3d  direction1 = { materialProperties[i], materialProperties[i + 1], materialProperties[i + 2] };
-      Vector3d  direction2 = { materialProperties[i + 3], materialProperties[i + 4], materialProperties[i + 5] };
-
-      Matrix3d localCoordinateSystem = Marmot::Math::orthonormalCoordinateSystem( direction1, direction2 );
-      using namespace ContinuumMechanics::VoigtNotation::Transformations;
-      Matrix6d transformStrainToLocalSystem  = transformationMatrixStrainVoigt( localCoordinateSystem );
-      Matrix6d transformStressToGlobalSystem = transformationMatrixStressVoigt( localCoordinateSystem )
-                                                 .colPivHouseholderQr()
-                                                 .solve( Matrix6d::Identity() );
-
-      Matrix6d localStiffnessTensor;
-
-      switch ( anisotropicType ) {
-      case Type::Isotropic: globalStiffnessTensor = Isotropic::stiffnessTensor( E1, nu12 ); break;
-      case Type::TransverseIsotropic:
-        localStiffnessTensor  = TransverseIsotropic::stiffnessTensor( E1, E2, nu12, nu23, G12 );
-        globalStiffnessTensor = transformStressToGlobalSystem * localStiffnessTensor * transformStrainToLocalSystem;
-        break;
-      case Type::Orthotropic:
-        localStiffnessTensor  = Orthotropic::stiffnessTensor( E1, E2, E3, nu12, nu23, nu13, G12, G23, G13 );
-        globalStiffnessTensor = transformStressToGlobalSystem * localStiffnessTensor * transformStrainToLocalSystem;
-        break;
-      };
-    }
+    countEvent( PerformanceCounters::ComputeStressCalls );
+    Tracing::ScopedSpan span( "computeStress", "material", materialCode );
+
+    // global stiffness tensor, computed once per section
+    const Matrix6d& globalStiffnessTensor = getSectionData< SectionData >().globalStiffnessTensor;
 
     // map stress, strain increment and stiffness tensor
     mVector6d             S( stress );
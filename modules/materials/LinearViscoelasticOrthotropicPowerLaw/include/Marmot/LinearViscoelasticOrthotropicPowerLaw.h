@@ -135,7 +135,18 @@ namespace Marmot::Materials {
 
     StateView getStateView( const std::string& stateName );
 
+    std::shared_ptr< MarmotMaterialSectionData > createSectionData() override;
+
+  protected:
+    void beginIncrement( MarmotMaterialSectionData& sectionData, const double* time, double dT ) override;
+
   private:
+    /// @brief data shared by all materials of a section
+    struct SectionData : MarmotMaterialSectionData {
+      /// @brief factors of the Kelvin units for the current increment
+      KelvinChain::IncrementFactors factors;
+    };
+
     /// @brief Elastic moduli of the Kelvin chain units
     KelvinChain::Properties elasticModuli;
 
@@ -112,6 +112,9 @@ namespace Marmot::Materials {
                                                              double&       pNewDT )
 
   {
+    countEvent( PerformanceCounters::ComputeStressCalls );
+    Tracing::ScopedSpan span( "computeStress", "material", materialCode );
+
     mVector6d nomStress( stress );
     Vector6d  dE( dStrain );
     mMatrix6d C( dStressDDStrain );
@@ -120,22 +123,29 @@ namespace Marmot::Materials {
     Vector6d dELocal = Transformations::transformStrainToLocalSystem( dE, localCoordinateSystem );
 
     if ( ( dE.array() == 0 ).all() && dT == 0 ) {
+      restoreStateVars();
       C = E1 * CelUnitGlobal;
       return;
     }
 
     Eigen::Ref< KelvinChain::mapStateVarMatrix > creepStateVars( stateVarManager->kelvinStateVars );
 
-    const double dTimeDays = dT * timeToDays;
+    // Kelvin chain at the begin of the increment
+    const Map< const KelvinChain::StateVarMatrix > creepStateVarsOld(
+      getStateVarAtBeginOfIncrement( creepStateVars.data() ),
+      6,
+      creepStateVars.cols() );
+
+    // factors of the Kelvin units, computed once per increment for all materials of the section
+    const KelvinChain::IncrementFactors& factors = getSectionData< SectionData >( timeOld, dT ).factors;
 
     Vector6d creepStrainIncrement = Vector6d::Zero();
     double   creepCompliance      = 0;
 
     // evaluate Kelvin-Chain
-    KelvinChain::evaluateKelvinChain( dTimeDays,
+    KelvinChain::evaluateKelvinChain( factors,
                                       elasticModuli,
-                                      retardationTimes,
-                                      creepStateVars,
+                                      creepStateVarsOld,
                                       creepCompliance,
                                       creepStrainIncrement,
                                       1.0 );
@@ -156,21 +166,33 @@ namespace Marmot::Materials {
     C = 1. / effectiveCompliance * CelUnitGlobal;
 
     // update internal state variables
-    KelvinChain::updateStateVarMatrix( dTimeDays,
+    KelvinChain::updateStateVarMatrix( factors,
                                        elasticModuli,
-                                       retardationTimes,
+                                       creepStateVarsOld,
                                        creepStateVars,
                                        deltaStressLocal,
                                        CelUnitInv );
   }
 
+  std::shared_ptr< MarmotMaterialSectionData > LinearViscoelasticOrthotropicPowerLaw::createSectionData()
+  {
+    return std::make_shared< SectionData >();
+  }
+
+  void LinearViscoelasticOrthotropicPowerLaw::beginIncrement( MarmotMaterialSectionData& sectionData_,
+                                                              const double*              time,
+                                                              double                     dT )
+  {
+    auto& sectionData   = static_cast< SectionData& >( sectionData_ );
+    sectionData.factors = KelvinChain::computeIncrementFactors( dT * timeToDays, retardationTimes );
+  }
+
   void LinearViscoelasticOrthotropicPowerLaw::assignStateVars( double* stateVars_, int nStateVars )
   {
     if ( nStateVars < getNumberOfRequiredStateVars() )
       throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << ": Not sufficient stateVars!" );
 
-    this->stateVarManager = std::make_unique< LinearViscoelasticOrthotropicPowerLawStateVarManager >( stateVars_,
-                                                                                                      nKelvin );
+    bindStateVarManager( this->stateVarManager, stateVars_, nKelvin );
 
     MarmotMaterial::assignStateVars( stateVars_, nStateVars );
   }
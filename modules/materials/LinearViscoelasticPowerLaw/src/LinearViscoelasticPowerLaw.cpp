@@ -53,28 +53,38 @@ namespace Marmot::Materials {
                                                   double&       pNewDT )
 
   {
+    countEvent( PerformanceCounters::ComputeStressCalls );
+    Tracing::ScopedSpan span( "computeStress", "material", materialCode );
+
     mVector6d nomStress( stress );
     Vector6d  dE( dStrain );
     mMatrix6d C( dStressDDStrain );
 
     if ( ( dE.array() == 0 ).all() && dT == 0 ) {
+      restoreStateVars();
       C = ContinuumMechanics::Elasticity::Isotropic::stiffnessTensor( E, nu );
       return;
     }
 
     Eigen::Ref< KelvinChain::mapStateVarMatrix > creepStateVars( stateVarManager->kelvinStateVars );
 
-    const double dTimeDays = dT * timeToDays;
+    // creep state at the begin of the increment, the update is written to the working state variables
+    const Map< const KelvinChain::StateVarMatrix > creepStateVarsOld(
+      getStateVarAtBeginOfIncrement( creepStateVars.data() ),
+      6,
+      creepStateVars.cols() );
+
+    // factors of the Kelvin units, computed once per increment for all materials of the section
+    const KelvinChain::IncrementFactors& factors = getSectionData< SectionData >( timeOld, dT ).factors;
 
     Matrix6d CelUnitInv = ContinuumMechanics::Elasticity::Isotropic::complianceTensor( 1.0, nu );
 
     Vector6d creepStrainIncrement = Vector6d::Zero();
     double   creepCompliance      = 0;
 
-    KelvinChain::evaluateKelvinChain( dTimeDays,
+    KelvinChain::evaluateKelvinChain( factors,
                                       elasticModuli,
-                                      retardationTimes,
-                                      creepStateVars,
+                                      creepStateVarsOld,
                                       creepCompliance,
                                       creepStrainIncrement,
                                       1.0 );
@@ -86,9 +96,9 @@ namespace Marmot::Materials {
     Vector6d deltaStress = C * ( dE - creepStrainIncrement );
     nomStress            = nomStress + deltaStress;
 
-    KelvinChain::updateStateVarMatrix( dTimeDays,
+    KelvinChain::updateStateVarMatrix( factors,
                                        elasticModuli,
-                                       retardationTimes,
+                                       creepStateVarsOld,
                                        creepStateVars,
                                        deltaStress,
                                        CelUnitInv );
@@ -96,12 +106,25 @@ namespace Marmot::Materials {
     return;
   }
 
+  std::shared_ptr< MarmotMaterialSectionData > LinearViscoelasticPowerLaw::createSectionData()
+  {
+    return std::make_shared< SectionData >();
+  }
+
+  void LinearViscoelasticPowerLaw::beginIncrement( MarmotMaterialSectionData& sectionData_,
+                                                   const double*              time,
+                                                   double                     dT )
+  {
+    auto& sectionData   = static_cast< SectionData& >( sectionData_ );
+    sectionData.factors = KelvinChain::computeIncrementFactors( dT * timeToDays, retardationTimes );
+  }
+
   void LinearViscoelasticPowerLaw::assignStateVars( double* stateVars_, int nStateVars )
   {
     if ( nStateVars < getNumberOfRequiredStateVars() )
       throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << ": Not sufficient stateVars!" );
 
-    this->stateVarManager = std::make_unique< LinearViscoelasticPowerLawStateVarManager >( stateVars_, nKelvin );
+    bindStateVarManager( this->stateVarManager, stateVars_, nKelvin );
 
     MarmotMaterial::assignStateVars( stateVars_, nStateVars );
   }
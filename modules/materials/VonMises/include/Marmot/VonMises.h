@@ -52,6 +52,16 @@ namespace Marmot::Materials {
      */
     double getDensity() override;
 
+    /// @brief Data shared by all materials of a section.
+    struct SectionData : MarmotMaterialSectionData {
+      /// @brief Elastic stiffness tensor.
+      Matrix6d Cel;
+      /// @brief Shear modulus.
+      double G;
+    };
+
+    std::shared_ptr< MarmotMaterialSectionData > createSectionData() override;
+
     class VonMisesModelStateVarManager : public MarmotStateVarVectorManager {
 
     public:
@@ -19,7 +19,7 @@ namespace Marmot::Materials {
     if ( nStateVars < getNumberOfRequiredStateVars() )
       throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << ": Not sufficient stateVars!" );
 
-    managedStateVars = std::make_unique< VonMisesModelStateVarManager >( stateVars );
+    bindStateVarManager( managedStateVars, stateVars );
     return MarmotMaterialHypoElastic::assignStateVars( stateVars, nStateVars );
   }
 
@@ -35,6 +35,17 @@ namespace Marmot::Materials {
     return this->materialProperties[6];
   }
 
+  std::shared_ptr< MarmotMaterialSectionData > VonMisesModel::createSectionData()
+  {
+    const double& E  = this->materialProperties[0];
+    const double& nu = this->materialProperties[1];
+
+    auto sectionData = std::make_shared< SectionData >();
+    sectionData->Cel = ContinuumMechanics::Elasticity::Isotropic::stiffnessTensor( E, nu );
+    sectionData->G   = E / ( 2. * ( 1. + nu ) );
+    return sectionData;
+  }
+
   void VonMisesModel::computeStress( double*       stress,
                                      double*       dStress_dStrain,
                                      const double* dStrain,
@@ -43,9 +54,12 @@ namespace Marmot::Materials {
                                      double&       pNewDT )
 
   {
-    // elasticity parameters
-    const double& E  = this->materialProperties[0];
-    const double& nu = this->materialProperties[1];
+    countEvent( PerformanceCounters::ComputeStressCalls );
+    Tracing::ScopedSpan span( "computeStress", "material", materialCode );
+
+    // kappa is updated in place, starting from the old state variables if assigned
+    restoreStateVars();
+
     // plasticity parameters
     const double& yieldStress      = this->materialProperties[2];
     const double& HLin             = this->materialProperties[3];
@@ -57,8 +71,10 @@ namespace Marmot::Materials {
     mMatrix6d  dS_dE( dStress_dStrain );
     const auto dE = Map< const Vector6d >( dStrain );
 
-    // compute elastic stiffness
-    const auto Cel = ContinuumMechanics::Elasticity::Isotropic::stiffnessTensor( E, nu );
+    // elastic stiffness and shear modulus, computed once per section
+    const SectionData& sectionData = getSectionData< SectionData >();
+    const Matrix6d&    Cel         = sectionData.Cel;
+    const double&      G           = sectionData.G;
 
     // handle zero strain increment
     if ( dE.isZero( 1e-14 ) ) {
@@ -88,8 +104,6 @@ namespace Marmot::Materials {
 
     if ( f( rhoTrial, kappa ) >= 0.0 ) {
       // plastic step
-      const double G = E / ( 2. * ( 1. + nu ) );
-
       auto g = [&]( double deltaKappa ) {
         return rhoTrial - Constants::sqrt6 * G * deltaKappa - Constants::sqrt2_3 * fy( kappa + deltaKappa );
       };
@@ -103,10 +117,15 @@ namespace Marmot::Materials {
       // compute return mapping direction
       Vector6d n = ContinuumMechanics::VoigtNotation::IDev * trialStress / rhoTrial;
 
+      // start from the solution of the previous global iteration, if warm starting is enabled
+      warmStartInnerNewton( timeOld[1], dT, &dKappa, 1 );
+
+      Tracing::ScopedSpan innerNewtonSpan( "innerNewton", "material", materialCode );
       while ( std::abs( g( dKappa ) ) > VonMisesConstants::innerNewtonTol ) {
 
         if ( counter == VonMisesConstants::nMaxInnerNewtonCycles ) {
           pNewDT = 0.5;
+          requestCutback( Status::InnerNewtonNotConverged, pNewDT );
           return;
         }
         // compute derivative of g wrt kappa
@@ -115,7 +134,10 @@ namespace Marmot::Materials {
         // update dKappa and iteration counter
         dKappa -= g( dKappa ) / dg_ddKappa;
         counter += 1;
+        countInnerNewtonIteration();
       }
+      innerNewtonSpan.end();
+      storeInnerNewtonSolution( timeOld[1], dT, &dKappa, 1 );
 
       dLambda = Constants::sqrt3_2 * dKappa;
 
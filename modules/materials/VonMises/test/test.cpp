@@ -1,5 +1,8 @@
+#include "Marmot/Marmot.h"
+#include "Marmot/MarmotPerformanceCounters.h"
 #include "Marmot/MarmotTesting.h"
 #include "Marmot/MarmotTypedefs.h"
+#include <thread>
 
 using namespace Marmot::Testing;
 
@@ -71,9 +74,172 @@ void testVonMises()
                            "comparison with reference solution failed" );
 }
 
+void testVonMisesPerformanceCounters()
+{
+  using namespace Marmot::PerformanceCounters;
+
+  // counts of several threads are aggregated
+  reset();
+  const int code = MarmotLibrary::MarmotMaterialFactory::getMaterialCodeFromName( "VONMISES" );
+  {
+    auto countEvents = [&]() {
+      for ( int i = 0; i < 1000; i++ )
+        add( Material, code, Cutbacks, 1 );
+    };
+    std::thread first( countEvents ), second( countEvents );
+    first.join();
+    second.join();
+  }
+  throwExceptionOnFailure( get( Material, code, Cutbacks ) == 2000, "counts of threads not aggregated" );
+
+  // events of a plastic material point are counted if counters are enabled at compile time
+  reset();
+
+  std::vector< double > materialProperties = { 210000., 0.3, 200., 2100., 20., 20 };
+  std::unique_ptr< MarmotMaterialHypoElastic >
+    material( dynamic_cast< MarmotMaterialHypoElastic* >( MarmotLibrary::MarmotMaterialFactory::
+                                                             createMaterial( code,
+                                                                             materialProperties.data(),
+                                                                             materialProperties.size(),
+                                                                             1 ) ) );
+  throwExceptionOnFailure( material->materialCode == code, "material code not assigned by the factory" );
+
+  std::vector< double > stateVars( material->getNumberOfRequiredStateVars(), 0.0 );
+  material->assignStateVars( stateVars.data(), stateVars.size() );
+
+  Marmot::Vector6d stress = Marmot::Vector6d::Zero();
+  Marmot::Matrix6d C;
+  Marmot::Vector6d dE;
+  dE << 0.01, 0.0, 0.0, 0.0, 0.0, 0.0;
+  double time[2] = { 0.0, 0.0 };
+  double pNewDT  = 1.0;
+  material->computeStress( stress.data(), C.data(), dE.data(), time, 1.0, pNewDT );
+
+  if constexpr ( enabled ) {
+    throwExceptionOnFailure( get( Material, code, ComputeStressCalls ) == 1, "computeStress calls not counted" );
+    throwExceptionOnFailure( get( Material, code, InnerNewtonIterations ) > 0, "inner Newton iterations not counted" );
+  }
+  else
+    throwExceptionOnFailure( get( Material, code, ComputeStressCalls ) == 0,
+                             "counters are disabled but events were counted" );
+}
+
+void testVonMisesDoubleBufferedStateVars()
+{
+  // plane stress iterates on the state variables, starting from the state at the begin of the increment
+  std::vector< double > materialProperties = { 210000., 0.3, 200., 2100., 20., 20 };
+  const int             code = MarmotLibrary::MarmotMaterialFactory::getMaterialCodeFromName( "VONMISES" );
+
+  auto createMaterial = [&]() {
+    return std::unique_ptr< MarmotMaterialHypoElastic >(
+      dynamic_cast< MarmotMaterialHypoElastic* >( MarmotLibrary::MarmotMaterialFactory::
+                                                     createMaterial( code,
+                                                                     materialProperties.data(),
+                                                                     materialProperties.size(),
+                                                                     1 ) ) );
+  };
+
+  auto single   = createMaterial();
+  auto buffered = createMaterial();
+
+  const int             nStateVars = single->getNumberOfRequiredStateVars();
+  std::vector< double > stateVars( nStateVars, 0.0 ), stateVarsNew( nStateVars, 0.0 ), stateVarsOld( nStateVars, 0.0 );
+  single->assignStateVars( stateVars.data(), nStateVars );
+  buffered->assignStateVarsDoubleBuffered( stateVarsNew.data(), stateVarsOld.data(), nStateVars );
+
+  Eigen::Vector3d stress = Eigen::Vector3d::Zero(), stressBuffered = Eigen::Vector3d::Zero();
+  Eigen::Matrix3d C, CBuffered;
+  Eigen::Vector3d dE( 0.004, -0.001, 0.002 );
+  double          time[2] = { 0.0, 0.0 };
+  double          pNewDT  = 1.0;
+
+  for ( int increment = 0; increment < 3; increment++ ) {
+    single->computePlaneStress( stress.data(), C.data(), dE.data(), time, 1.0, pNewDT );
+
+    // a cutback discards the working state variables, and a repeated computation without restoring them gives the
+    // same result
+    const Eigen::Vector3d       stressOld        = stressBuffered;
+    const std::vector< double > stateVarsOldCopy = stateVarsOld;
+    buffered->computePlaneStress( stressBuffered.data(), CBuffered.data(), dE.data(), time, 1.0, pNewDT );
+    throwExceptionOnFailure( stateVarsOld == stateVarsOldCopy, "old state variables modified" );
+    throwExceptionOnFailure( stateVarsNew != stateVarsOld, "working state variables not updated" );
+    stressBuffered = stressOld;
+    buffered->computePlaneStress( stressBuffered.data(), CBuffered.data(), dE.data(), time, 1.0, pNewDT );
+
+    throwExceptionOnFailure( checkIfEqual< double >( stress, stressBuffered, 1e-12 ), "stresses differ" );
+    throwExceptionOnFailure( checkIfEqual< double >( C, CBuffered, 1e-12 ), "tangents differ" );
+    throwExceptionOnFailure( stateVars == stateVarsNew, "state variables differ" );
+
+    // accept the increment by swapping the buffers
+    stateVarsNew.swap( stateVarsOld );
+    buffered->assignStateVarsDoubleBuffered( stateVarsNew.data(), stateVarsOld.data(), nStateVars );
+  }
+
+  throwExceptionOnFailure( buffered->getAssignedStateVarsOld() == stateVarsOld.data(), "old state not assigned" );
+  throwExceptionOnFailure( stateVars == stateVarsOld, "accepted state variables differ" );
+}
+
+void testVonMisesWarmStart()
+{
+  // global iterations of an increment recompute the material point from the same state with converging strains
+  std::vector< double > materialProperties = { 210000., 0.3, 200., 2100., 20., 20 };
+  const int             code = MarmotLibrary::MarmotMaterialFactory::getMaterialCodeFromName( "VONMISES" );
+
+  auto createMaterial = [&]() {
+    return std::unique_ptr< MarmotMaterialHypoElastic >(
+      dynamic_cast< MarmotMaterialHypoElastic* >( MarmotLibrary::MarmotMaterialFactory::
+                                                     createMaterial( code,
+                                                                     materialProperties.data(),
+                                                                     materialProperties.size(),
+                                                                     1 ) ) );
+  };
+
+  auto cold = createMaterial();
+  auto warm = createMaterial();
+  cold->setInnerNewtonWarmStart( false );
+  warm->setInnerNewtonWarmStart( true );
+
+  const int             nStateVars = cold->getNumberOfRequiredStateVars();
+  std::vector< double > stateVarsOld( nStateVars, 0.0 ), stateVarsCold( nStateVars ), stateVarsWarm( nStateVars );
+  cold->assignStateVarsDoubleBuffered( stateVarsCold.data(), stateVarsOld.data(), nStateVars );
+  warm->assignStateVarsDoubleBuffered( stateVarsWarm.data(), stateVarsOld.data(), nStateVars );
+
+  Marmot::Matrix6d C, CWarm;
+  double           time[2] = { 0.0, 1.0 };
+  double           pNewDT  = 1.0;
+
+  int nIterationsCold = 0, nIterationsWarm = 0;
+
+  for ( int iteration = 0; iteration < 5; iteration++ ) {
+    Marmot::Vector6d dE;
+    dE << 0.004, -0.001, 0.002, 0.001, 0., 0.;
+    dE *= 1.0 + std::pow( 0.1, iteration + 1 );
+
+    Marmot::Vector6d stress = Marmot::Vector6d::Zero(), stressWarm = Marmot::Vector6d::Zero();
+    cold->resetStatus();
+    warm->resetStatus();
+    cold->computeStress( stress.data(), C.data(), dE.data(), time, 1.0, pNewDT );
+    warm->computeStress( stressWarm.data(), CWarm.data(), dE.data(), time, 1.0, pNewDT );
+
+    throwExceptionOnFailure( cold->getNumberOfInnerNewtonIterations() > 0, "inner Newton iterations not reported" );
+    nIterationsCold += cold->getNumberOfInnerNewtonIterations();
+    nIterationsWarm += warm->getNumberOfInnerNewtonIterations();
+
+    throwExceptionOnFailure( checkIfEqual< double >( stress, stressWarm, 1e-8 ), "stresses differ" );
+    throwExceptionOnFailure( checkIfEqual< double >( C, CWarm, 1e-6 ), "tangents differ" );
+    throwExceptionOnFailure( checkIfEqual( stateVarsCold[0], stateVarsWarm[0], 1e-14 ), "state variables differ" );
+  }
+
+  throwExceptionOnFailure( nIterationsWarm < nIterationsCold, "warm start does not save inner Newton iterations" );
+}
+
 int main()
 {
-  std::vector< std::function< void( void ) > > tests = { testVonMises, testVonMisesCoordinateInvariance };
+  std::vector< std::function< void( void ) > > tests = { testVonMises,
+                                                         testVonMisesCoordinateInvariance,
+                                                         testVonMisesPerformanceCounters,
+                                                         testVonMisesDoubleBufferedStateVars,
+                                                         testVonMisesWarmStart };
 
   executeTestsAndCollectExceptions( tests );
   return 0;
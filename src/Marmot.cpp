@@ -2,29 +2,47 @@
 #include "Marmot/MarmotElement.h"
 #include "Marmot/MarmotJournal.h"
 #include "Marmot/MarmotMaterial.h"
+#include <algorithm>
 #include <cassert>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <vector>
 
 namespace MarmotLibrary {
 
   // MaterialFactory
 
-  std::unordered_map< std::string, int > MarmotMaterialFactory::materialNameToCodeAssociation;
-  std::unordered_map< int, MarmotMaterialFactory::materialFactoryFunction >
-    MarmotMaterialFactory::materialFactoryFunctionByCode;
+  std::unordered_map< std::string, int >& MarmotMaterialFactory::materialNameToCodeAssociation()
+  {
+    static std::unordered_map< std::string, int > association;
+    return association;
+  }
+
+  std::unordered_map< int, MarmotMaterialFactory::materialFactoryFunction >& MarmotMaterialFactory::
+    materialFactoryFunctionByCode()
+  {
+    static std::unordered_map< int, materialFactoryFunction > factoryFunctions;
+    return factoryFunctions;
+  }
+
+  std::map< MarmotMaterialFactory::SectionKey, std::weak_ptr< MarmotMaterialSectionData > >
+             MarmotMaterialFactory::sectionDataByCodeAndProperties;
+  std::mutex MarmotMaterialFactory::sectionDataMutex;
 
   bool MarmotMaterialFactory::registerMaterial( int                     materialCode,
                                                 const std::string&      materialName,
                                                 materialFactoryFunction factoryFunction )
   {
-    assert( materialNameToCodeAssociation.find( materialName ) == materialNameToCodeAssociation.end() );
-    assert( materialFactoryFunctionByCode.find( materialCode ) == materialFactoryFunctionByCode.end() );
+    assert( materialNameToCodeAssociation().find( materialName ) == materialNameToCodeAssociation().end() );
+    assert( materialFactoryFunctionByCode().find( materialCode ) == materialFactoryFunctionByCode().end() );
 
-    materialNameToCodeAssociation[materialName] = materialCode;
-    materialFactoryFunctionByCode[materialCode] = factoryFunction;
+    materialNameToCodeAssociation()[materialName] = materialCode;
+    materialFactoryFunctionByCode()[materialCode] = factoryFunction;
 
     return true;
   }
@@ -32,7 +50,7 @@ namespace MarmotLibrary {
   int MarmotMaterialFactory::getMaterialCodeFromName( const std::string& materialName )
   {
     try {
-      return materialNameToCodeAssociation.at( materialName );
+      return materialNameToCodeAssociation().at( materialName );
     }
     catch ( const std::out_of_range& e ) {
       throw std::invalid_argument( MakeString() << "Invalid material " << materialName << " requested!" );
@@ -44,30 +62,86 @@ namespace MarmotLibrary {
                                                          int           nMaterialProperties,
                                                          int           materialNumber )
   {
+    MarmotMaterial* material;
     try {
-      return materialFactoryFunctionByCode.at(
+      material = materialFactoryFunctionByCode().at(
         materialCode )( materialProperties, nMaterialProperties, materialNumber );
     }
     catch ( const std::out_of_range& e ) {
       throw std::invalid_argument( MakeString() << "Invalid material " << materialCode << " requested!" );
     }
+
+    material->materialCode = materialCode;
+    return material;
+  }
+
+  MarmotMaterial* MarmotMaterialFactory::createMaterial( const MarmotMaterialSection& section, int materialNumber )
+  {
+    MarmotMaterial* material = createMaterial( section.materialCode,
+                                               section.materialProperties,
+                                               section.nMaterialProperties,
+                                               materialNumber );
+
+    // the section data of a section object is checked and assigned under the lock, as materials of a section may be
+    // created concurrently
+    std::lock_guard< std::mutex > lock( sectionDataMutex );
+
+    if ( !section.sectionData && section.isSharingDataWithEqualSections ) {
+      // distinct section objects with identical code and properties share their data if they opt in
+      const SectionKey key( section.materialCode,
+                            std::vector< double >( section.materialProperties,
+                                                   section.materialProperties + section.nMaterialProperties ) );
+
+      section.sectionData = sectionDataByCodeAndProperties[key].lock();
+      if ( !section.sectionData ) {
+        std::erase_if( sectionDataByCodeAndProperties, []( const auto& entry ) { return entry.second.expired(); } );
+
+        section.sectionData = material->createSectionData();
+        if ( section.sectionData )
+          sectionDataByCodeAndProperties[key] = section.sectionData;
+      }
+    }
+    else if ( !section.sectionData )
+      section.sectionData = material->createSectionData();
+
+    material->assignSectionData( section.sectionData );
+    return material;
+  }
+
+  std::vector< std::string > MarmotMaterialFactory::getRegisteredMaterialNames()
+  {
+    std::vector< std::string > names;
+    for ( const auto& [name, code] : materialNameToCodeAssociation() )
+      names.push_back( name );
+
+    std::sort( names.begin(), names.end() );
+    return names;
   }
 
   // ElementFactory
 
-  std::unordered_map< std::string, int > MarmotElementFactory::elementNameToCodeAssociation;
-  std::unordered_map< int, MarmotElementFactory::elementFactoryFunction >
-    MarmotElementFactory::elementFactoryFunctionByCode;
+  std::unordered_map< std::string, int >& MarmotElementFactory::elementNameToCodeAssociation()
+  {
+    static std::unordered_map< std::string, int > association;
+    return association;
+  }
+
+  std::unordered_map< int, MarmotElementFactory::elementFactoryFunction >& MarmotElementFactory::
+    elementFactoryFunctionByCode()
+  {
+    static std::unordered_map< int, elementFactoryFunction > factoryFunctions;
+    return factoryFunctions;
+  }
 
   bool MarmotElementFactory::registerElement( const std::string&     elementName,
                                               int                    elementCode,
                                               elementFactoryFunction factoryFunction )
   {
-    assert( elementNameToCodeAssociation.find( elementName ) == elementNameToCodeAssociation.end() );
-    assert( elementFactoryFunctionByCode.find( elementCode ) == elementFactoryFunctionByCode.end() );
+    assert( elementNameToCodeAssociation().find( elementName ) == elementNameToCodeAssociation().end() );
+    assert( elementFactoryFunctionByCode().find( elementCode ) == elementFactoryFunctionByCode().end() );
 
-    elementNameToCodeAssociation[elementName] = elementCode;
-    elementFactoryFunctionByCode[elementCode] = factoryFunction;
+    elementNameToCodeAssociation()[elementName] = elementCode;
+    elementFactoryFunctionByCode()[elementCode] = factoryFunction;
 
     return true;
   }
@@ -75,7 +149,7 @@ namespace MarmotLibrary {
   int MarmotElementFactory::getElementCodeFromName( const std::string& elementName )
   {
     try {
-      return elementNameToCodeAssociation.at( elementName );
+      return elementNameToCodeAssociation().at( elementName );
     }
     catch ( const std::out_of_range& e ) {
       throw std::invalid_argument( MakeString() << "Invalid element " << elementName << " requested!" );
@@ -84,12 +158,26 @@ namespace MarmotLibrary {
 
   MarmotElement* MarmotElementFactory::createElement( int elementCode, int elementNumber )
   {
+    MarmotElement* element;
     try {
-      return elementFactoryFunctionByCode.at( elementCode )( elementNumber );
+      element = elementFactoryFunctionByCode().at( elementCode )( elementNumber );
     }
     catch ( const std::out_of_range& e ) {
       throw std::invalid_argument( MakeString() << "Invalid element " << elementCode << " requested!" );
     }
+
+    element->elementCode = elementCode;
+    return element;
+  }
+
+  std::vector< std::string > MarmotElementFactory::getRegisteredElementNames()
+  {
+    std::vector< std::string > names;
+    for ( const auto& [name, code] : elementNameToCodeAssociation() )
+      names.push_back( name );
+
+    std::sort( names.begin(), names.end() );
+    return names;
   }
 
 } // namespace MarmotLibrary
@@ -0,0 +1,410 @@
+#include "Marmot/MarmotCheckpoint.h"
+#include "Marmot/Marmot.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Marmot::Checkpoint {
+
+  namespace {
+
+    constexpr char         magic[8]    = { 'M', 'A', 'R', 'M', 'O', 'T', 'C', 'P' };
+    constexpr std::int32_t version     = 1;
+    constexpr std::int64_t pageSize    = 4096;
+    constexpr std::int64_t noProperties = -1;
+
+    // flush the contents of a file (or the entries of a directory) to the storage device
+    void synchronize( const std::string& path, bool isDirectory )
+    {
+#ifndef _WIN32
+      const int descriptor = open( path.c_str(), isDirectory ? O_RDONLY | O_DIRECTORY : O_WRONLY );
+      if ( descriptor < 0 )
+        throw std::runtime_error( MakeString() << __PRETTY_FUNCTION__ << ": cannot open " << path );
+      const bool isSynchronized = fsync( descriptor ) == 0;
+      close( descriptor );
+      if ( !isSynchronized )
+        throw std::runtime_error( MakeString() << __PRETTY_FUNCTION__ << ": cannot synchronize " << path );
+#endif
+    }
+
+    std::int64_t alignUp( std::int64_t offset, std::int64_t alignment )
+    {
+      return ( offset + alignment - 1 ) / alignment * alignment;
+    }
+
+    template < typename T >
+    void writeArray( std::ofstream& file, const std::vector< T >& values )
+    {
+      file.write( reinterpret_cast< const char* >( values.data() ), values.size() * sizeof( T ) );
+    }
+
+    void pad( std::ofstream& file, std::int64_t offset )
+    {
+      const std::vector< char > zeros( offset - file.tellp(), 0 );
+      writeArray( file, zeros );
+    }
+
+    /* the layout of the quadrature point state of an element, with all entries found in the element */
+    std::pair< LayoutRecord, std::vector< LayoutEntry > > describeLayout( MarmotElement&                    element,
+                                                                          const std::vector< std::string >& names )
+    {
+      std::vector< LayoutEntry > entries;
+      std::string                firstName;
+
+      for ( const std::string& name : names ) {
+        if ( name.size() >= sizeof( LayoutEntry::name ) )
+          throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << ": state name " << name
+                                                    << " is too long" );
+
+        MarmotElement::StateFieldAccessor accessor;
+        try {
+          accessor = element.resolveStateField( name );
+        }
+        catch ( const std::exception& ) {
+          continue;
+        }
+        if ( accessor.offset < 0 )
+          continue;
+
+        LayoutEntry entry = {};
+        name.copy( entry.name, sizeof( entry.name ) - 1 );
+        entry.offset = accessor.offset;
+        entry.size   = accessor.size;
+        entries.push_back( entry );
+
+        if ( firstName.empty() )
+          firstName = name;
+      }
+
+      LayoutRecord layout = {};
+      layout.nEntries     = entries.size();
+      if ( !firstName.empty() && element.getNumberOfQuadraturePoints() > 1 )
+        layout.quadraturePointStride = element.getStateView( firstName, 1 ).stateLocation -
+                                       element.getStateView( firstName, 0 ).stateLocation;
+
+      return { layout, entries };
+    }
+  } // namespace
+
+  void writeCheckpoint( const std::string&                fileName,
+                        const std::vector< ElementData >& elementData,
+                        const std::vector< std::string >& stateNames )
+  {
+    std::vector< ElementRecord > elements( elementData.size() );
+    std::vector< LayoutRecord >  layouts;
+    std::vector< LayoutEntry >   layoutEntries;
+    std::vector< double >        properties;
+
+    // properties shared by several elements are stored once
+    std::map< std::pair< const double*, int >, std::int64_t > propertyOffsets;
+    auto storeProperties = [&]( const double* values, int n ) -> std::int64_t {
+      if ( n == 0 )
+        return noProperties;
+      const auto [it, isNew] = propertyOffsets.emplace( std::make_pair( values, n ), properties.size() );
+      if ( isNew )
+        properties.insert( properties.end(), values, values + n );
+      return it->second;
+    };
+
+    // the layout is determined once per combination of element, material and number of state variables
+    std::map< std::tuple< int, int, int >, int > layoutIndices;
+
+    std::int64_t nStateVarsTotal = 0;
+
+    for ( size_t i = 0; i < elementData.size(); i++ ) {
+      const ElementData& data    = elementData[i];
+      ElementRecord&     element = elements[i];
+
+      element.elementCode              = data.element->elementCode;
+      element.elementLabel             = data.elementLabel;
+      element.materialCode             = data.materialSection.materialCode;
+      element.elementPropertiesOffset  = storeProperties( data.elementProperties.elementProperties,
+                                                         data.elementProperties.nElementProperties );
+      element.nElementProperties       = data.elementProperties.nElementProperties;
+      element.materialPropertiesOffset = storeProperties( data.materialSection.materialProperties,
+                                                          data.materialSection.nMaterialProperties );
+      element.nMaterialProperties      = data.materialSection.nMaterialProperties;
+      element.stateVarsOffset          = nStateVarsTotal;
+      element.nStateVars               = data.nStateVars;
+      element.nQuadraturePoints        = data.element->getNumberOfQuadraturePoints();
+      nStateVarsTotal += data.nStateVars;
+
+      const auto key      = std::make_tuple( element.elementCode, element.materialCode, element.nStateVars );
+      const auto existing = layoutIndices.find( key );
+      if ( existing != layoutIndices.end() ) {
+        element.layout = existing->second;
+        continue;
+      }
+
+      auto [layout, entries] = describeLayout( *data.element, stateNames );
+      layout.firstEntry      = layoutEntries.size();
+      layoutEntries.insert( layoutEntries.end(), entries.begin(), entries.end() );
+      element.layout = layouts.size();
+      layouts.push_back( layout );
+      layoutIndices[key] = element.layout;
+    }
+
+    FileHeader header = {};
+    std::copy( magic, magic + sizeof( magic ), header.magic );
+    header.version             = version;
+    header.pageSize            = pageSize;
+    header.nElements           = elements.size();
+    header.nLayouts            = layouts.size();
+    header.nLayoutEntries      = layoutEntries.size();
+    header.nProperties         = properties.size();
+    header.elementsOffset      = alignUp( sizeof( FileHeader ), alignof( std::int64_t ) );
+    header.layoutsOffset       = alignUp( header.elementsOffset + elements.size() * sizeof( ElementRecord ), 8 );
+    header.layoutEntriesOffset = alignUp( header.layoutsOffset + layouts.size() * sizeof( LayoutRecord ), 8 );
+    header.propertiesOffset    = alignUp( header.layoutEntriesOffset + layoutEntries.size() * sizeof( LayoutEntry ),
+                                          8 );
+    header.stateVarsOffset = alignUp( header.propertiesOffset + properties.size() * sizeof( double ), pageSize );
+    header.fileSize        = header.stateVarsOffset + nStateVarsTotal * sizeof( double );
+
+    // written to a temporary file first, such that an existing checkpoint is only replaced by a complete one
+    const std::string temporaryFileName = fileName + ".tmp";
+    std::ofstream     file( temporaryFileName, std::ios::binary );
+    if ( !file )
+      throw std::runtime_error( MakeString() << __PRETTY_FUNCTION__ << ": cannot open " << temporaryFileName );
+
+    file.write( reinterpret_cast< const char* >( &header ), sizeof( FileHeader ) );
+    pad( file, header.elementsOffset );
+    writeArray( file, elements );
+    pad( file, header.layoutsOffset );
+    writeArray( file, layouts );
+    pad( file, header.layoutEntriesOffset );
+    writeArray( file, layoutEntries );
+    pad( file, header.propertiesOffset );
+    writeArray( file, properties );
+    pad( file, header.stateVarsOffset );
+
+    for ( const ElementData& data : elementData )
+      file.write( reinterpret_cast< const char* >( data.stateVars ), data.nStateVars * sizeof( double ) );
+
+    file.close();
+    if ( !file ) {
+      std::filesystem::remove( temporaryFileName );
+      throw std::runtime_error( MakeString() << __PRETTY_FUNCTION__ << ": writing " << fileName << " failed" );
+    }
+
+    synchronize( temporaryFileName, false );
+    std::filesystem::rename( temporaryFileName, fileName );
+
+    const std::filesystem::path directory = std::filesystem::path( fileName ).parent_path();
+    synchronize( directory.empty() ? "." : directory.string(), true );
+  }
+
+  CheckpointFile::CheckpointFile( const std::string& fileName_ ) : fileName( fileName_ )
+  {
+#ifdef _WIN32
+    // without POSIX memory mapping, the file is read at once
+    std::ifstream file( fileName, std::ios::binary | std::ios::ate );
+    if ( !file )
+      throw std::runtime_error( MakeString() << __PRETTY_FUNCTION__ << ": cannot open " << fileName );
+    size = file.tellg();
+    data = new char[size];
+    file.seekg( 0 );
+    file.read( data, size );
+#else
+    const int descriptor = open( fileName.c_str(), O_RDONLY );
+    if ( descriptor < 0 )
+      throw std::runtime_error( MakeString() << __PRETTY_FUNCTION__ << ": cannot open " << fileName );
+
+    struct stat status;
+    if ( fstat( descriptor, &status ) != 0 ) {
+      close( descriptor );
+      throw std::runtime_error( MakeString() << __PRETTY_FUNCTION__ << ": cannot access " << fileName );
+    }
+    size = status.st_size;
+
+    // private mapping: pages are loaded on the first access, and modified pages are copied
+    void* mapping = size > 0 ? mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, descriptor, 0 ) : MAP_FAILED;
+    close( descriptor );
+    if ( mapping == MAP_FAILED )
+      throw std::runtime_error( MakeString() << __PRETTY_FUNCTION__ << ": cannot map " << fileName );
+    data = static_cast< char* >( mapping );
+#endif
+
+    header = reinterpret_cast< const FileHeader* >( data );
+    if ( size < sizeof( FileHeader ) || !std::equal( magic, magic + sizeof( magic ), header->magic ) ||
+         header->version != version || header->fileSize != std::int64_t( size ) ) {
+      unmap();
+      throw std::runtime_error( MakeString() << __PRETTY_FUNCTION__ << ": " << fileName
+                                             << " is not a valid checkpoint" );
+    }
+
+    const std::string defect = assignTables();
+    if ( !defect.empty() ) {
+      unmap();
+      throw std::runtime_error( MakeString() << __PRETTY_FUNCTION__ << ": " << fileName
+                                             << " is not a valid checkpoint: " << defect );
+    }
+  }
+
+  std::string CheckpointFile::assignTables()
+  {
+    const std::int64_t fileSize = size;
+
+    // a table of n entries of type T at offset, aligned and within the file
+    auto isTable = [&]( std::int64_t offset, std::int64_t n, std::int64_t entrySize, std::int64_t alignment ) {
+      return offset >= std::int64_t( sizeof( FileHeader ) ) && offset <= fileSize && offset % alignment == 0 &&
+             n >= 0 && n <= ( fileSize - offset ) / entrySize;
+    };
+    // a range [begin, begin + n) within a table of nTotal entries
+    auto isRange = []( std::int64_t begin, std::int64_t n, std::int64_t nTotal ) {
+      return begin >= 0 && n >= 0 && begin <= nTotal && n <= nTotal - begin;
+    };
+
+    if ( !isTable( header->elementsOffset, header->nElements, sizeof( ElementRecord ), alignof( ElementRecord ) ) )
+      return "element table out of range";
+    if ( !isTable( header->layoutsOffset, header->nLayouts, sizeof( LayoutRecord ), alignof( LayoutRecord ) ) )
+      return "layout table out of range";
+    if ( !isTable( header->layoutEntriesOffset,
+                   header->nLayoutEntries,
+                   sizeof( LayoutEntry ),
+                   alignof( LayoutEntry ) ) )
+      return "layout entry table out of range";
+    if ( !isTable( header->propertiesOffset, header->nProperties, sizeof( double ), alignof( double ) ) )
+      return "property table out of range";
+    if ( !isTable( header->stateVarsOffset, 0, sizeof( double ), alignof( double ) ) ||
+         ( fileSize - header->stateVarsOffset ) % sizeof( double ) != 0 )
+      return "state variables out of range";
+
+    const std::int64_t nStateVarsTotal = ( fileSize - header->stateVarsOffset ) / sizeof( double );
+
+    elements      = reinterpret_cast< const ElementRecord* >( data + header->elementsOffset );
+    layouts       = reinterpret_cast< const LayoutRecord* >( data + header->layoutsOffset );
+    layoutEntries = reinterpret_cast< const LayoutEntry* >( data + header->layoutEntriesOffset );
+    properties    = reinterpret_cast< const double* >( data + header->propertiesOffset );
+    stateVars     = reinterpret_cast< double* >( data + header->stateVarsOffset );
+
+    for ( std::int64_t i = 0; i < header->nLayoutEntries; i++ ) {
+      const LayoutEntry& entry = layoutEntries[i];
+      if ( std::find( entry.name, entry.name + sizeof( entry.name ), '\0' ) == entry.name + sizeof( entry.name ) ||
+           entry.offset < 0 || entry.size < 0 )
+        return MakeString() << "invalid layout entry " << i;
+    }
+
+    for ( std::int64_t i = 0; i < header->nLayouts; i++ )
+      if ( !isRange( layouts[i].firstEntry, layouts[i].nEntries, header->nLayoutEntries ) ||
+           layouts[i].quadraturePointStride < 0 )
+        return MakeString() << "invalid layout " << i;
+
+    for ( std::int64_t i = 0; i < header->nElements; i++ ) {
+      const ElementRecord& record = elements[i];
+
+      if ( record.layout < 0 || record.layout >= header->nLayouts || record.nQuadraturePoints < 0 )
+        return MakeString() << "invalid layout of element " << i;
+
+      if ( ( record.nElementProperties > 0 &&
+             !isRange( record.elementPropertiesOffset, record.nElementProperties, header->nProperties ) ) ||
+           ( record.nMaterialProperties > 0 &&
+             !isRange( record.materialPropertiesOffset, record.nMaterialProperties, header->nProperties ) ) ||
+           record.nElementProperties < 0 || record.nMaterialProperties < 0 )
+        return MakeString() << "properties of element " << i << " out of range";
+
+      if ( !isRange( record.stateVarsOffset, record.nStateVars, nStateVarsTotal ) )
+        return MakeString() << "state variables of element " << i << " out of range";
+
+      // all recorded states of all quadrature points lie within the state variables of the element
+      const LayoutRecord& layout = layouts[record.layout];
+      for ( int j = 0; j < layout.nEntries && record.nQuadraturePoints > 0; j++ ) {
+        const LayoutEntry& entry = layoutEntries[layout.firstEntry + j];
+        if ( !isRange( std::int64_t( record.nQuadraturePoints - 1 ) * layout.quadraturePointStride + entry.offset,
+                       entry.size,
+                       record.nStateVars ) )
+          return MakeString() << "state " << entry.name << " of element " << i << " out of range";
+      }
+    }
+
+    return {};
+  }
+
+  CheckpointFile::~CheckpointFile()
+  {
+    unmap();
+  }
+
+  void CheckpointFile::unmap()
+  {
+#ifdef _WIN32
+    delete[] data;
+#else
+    if ( data )
+      munmap( data, size );
+#endif
+    data = nullptr;
+  }
+
+  const ElementRecord& CheckpointFile::getElementRecord( int element ) const
+  {
+    if ( element < 0 || element >= header->nElements )
+      throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << ": element " << element
+                                                << " not in the checkpoint" );
+    return elements[element];
+  }
+
+  ElementProperties CheckpointFile::getElementProperties( int element ) const
+  {
+    const ElementRecord& record = getElementRecord( element );
+    return { record.nElementProperties > 0 ? &properties[record.elementPropertiesOffset] : nullptr,
+             record.nElementProperties };
+  }
+
+  MarmotMaterialSection CheckpointFile::getMaterialSection( int element ) const
+  {
+    const ElementRecord& record = getElementRecord( element );
+    return { record.materialCode,
+             record.nMaterialProperties > 0 ? &properties[record.materialPropertiesOffset] : nullptr,
+             record.nMaterialProperties };
+  }
+
+  double* CheckpointFile::getStateVars( int element ) const
+  {
+    return stateVars + getElementRecord( element ).stateVarsOffset;
+  }
+
+  StateView CheckpointFile::getStateView( int element, const std::string& stateName, int quadraturePoint ) const
+  {
+    const ElementRecord& record = getElementRecord( element );
+    const LayoutRecord&  layout = layouts[record.layout];
+
+    if ( quadraturePoint < 0 || quadraturePoint >= record.nQuadraturePoints )
+      throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << ": element " << record.elementLabel
+                                                << " has no quadrature point " << quadraturePoint );
+
+    for ( int i = 0; i < layout.nEntries; i++ ) {
+      const LayoutEntry& entry = layoutEntries[layout.firstEntry + i];
+      if ( stateName == entry.name )
+        return { getStateVars( element ) + quadraturePoint * layout.quadraturePointStride + entry.offset,
+                 entry.size };
+    }
+
+    throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << ": state " << stateName
+                                              << " not recorded for element " << record.elementLabel );
+  }
+
+  MarmotElement* CheckpointFile::createElement( int element ) const
+  {
+    const ElementRecord& record = getElementRecord( element );
+
+    std::unique_ptr< MarmotElement > newElement(
+      MarmotLibrary::MarmotElementFactory::createElement( record.elementCode, record.elementLabel ) );
+    newElement->assignProperty( getElementProperties( element ) );
+    newElement->assignProperty( getMaterialSection( element ) );
+    newElement->assignStateVars( getStateVars( element ), record.nStateVars );
+
+    return newElement.release();
+  }
+
+} // namespace Marmot::Checkpoint
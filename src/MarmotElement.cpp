@@ -1,7 +1,48 @@
 #include "Marmot/MarmotElement.h"
+#include <algorithm>
 
 MarmotElement::~MarmotElement() {}
 
 void MarmotElement::assignProperty( const ElementProperties& property ) {}
 
 void MarmotElement::assignProperty( const MarmotMaterialSection& property ) {}
+
+MarmotElement::StateFieldAccessor MarmotElement::resolveStateField( const std::string& stateName )
+{
+  return { stateName, -1, getStateView( stateName, 0 ).stateSize };
+}
+
+void MarmotElement::gatherStateField( const StateFieldAccessor& accessor, double* values )
+{
+  for ( int i = 0; i < getNumberOfQuadraturePoints(); i++ ) {
+    const StateView view = getStateView( accessor.name, i );
+    std::copy_n( view.stateLocation, accessor.size, values + i * accessor.size );
+  }
+}
+
+void MarmotElement::gatherCoordinatesAtQuadraturePoints( double* coordinates )
+{
+  for ( const auto& qpCoordinates : getCoordinatesAtQuadraturePoints() )
+    coordinates = std::copy( qpCoordinates.begin(), qpCoordinates.end(), coordinates );
+}
+
+void MarmotElement::gatherStateField( MarmotElement* const*     elements,
+                                      int                       nElements,
+                                      const StateFieldAccessor& accessor,
+                                      double*                   values )
+{
+  for ( int e = 0; e < nElements; e++ ) {
+    elements[e]->gatherStateField( accessor, values );
+    values += elements[e]->getNumberOfQuadraturePoints() * accessor.size;
+  }
+}
+
+void MarmotElement::gatherCoordinatesAtQuadraturePoints( MarmotElement* const* elements,
+                                                         int                   nElements,
+                                                         double*               coordinates )
+{
+  for ( int e = 0; e < nElements; e++ ) {
+    elements[e]->gatherCoordinatesAtQuadraturePoints( coordinates );
+    coordinates += elements[e]->getNumberOfQuadraturePoints() * elements[e]->getNSpatialDimensions();
+  }
+}
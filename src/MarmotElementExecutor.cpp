@@ -0,0 +1,251 @@
+#include "Marmot/MarmotElementExecutor.h"
+#include "Marmot/MarmotJournal.h"
+#include "Marmot/MarmotTracing.h"
+#include "Marmot/MarmotUtils.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace Marmot::Execution {
+
+  ElementExecutor::ElementExecutor( int nThreads_, int grainSize_ )
+    : nThreads( std::max( 1, nThreads_ ) ), grainSize( grainSize_ ), isCancelled( false )
+  {
+    if ( grainSize < 1 )
+      throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << ": grain size must be positive" );
+
+    for ( int i = 0; i < nThreads; i++ )
+      workers.push_back( std::make_unique< Worker >() );
+
+    if constexpr ( Tracing::enabled )
+      Tracing::registerThread();
+
+    threads.reserve( nThreads - 1 );
+    for ( int i = 1; i < nThreads; i++ )
+      threads.emplace_back( &ElementExecutor::runWorker, this, i );
+  }
+
+  ElementExecutor::~ElementExecutor()
+  {
+    {
+      std::lock_guard< std::mutex > lock( poolMutex );
+      isTerminating = true;
+    }
+    jobAvailable.notify_all();
+
+    for ( auto& thread : threads )
+      thread.join();
+  }
+
+  void ElementExecutor::runWorker( int id )
+  {
+    if constexpr ( Tracing::enabled )
+      Tracing::registerThread();
+
+    long int lastGeneration = 0;
+
+    while ( true ) {
+      std::function< void( int ) > currentJob;
+      {
+        std::unique_lock< std::mutex > lock( poolMutex );
+        jobAvailable.wait( lock, [&] { return isTerminating || generation != lastGeneration; } );
+        if ( isTerminating )
+          return;
+        lastGeneration = generation;
+        currentJob     = job;
+      }
+
+      currentJob( id );
+
+      {
+        std::lock_guard< std::mutex > lock( poolMutex );
+        nBusyThreads -= 1;
+      }
+      jobFinished.notify_one();
+    }
+  }
+
+  void ElementExecutor::runOnAllThreads( const std::function< void( int ) >& job_ )
+  {
+    {
+      std::lock_guard< std::mutex > lock( poolMutex );
+      job          = job_;
+      nBusyThreads = nThreads - 1;
+      generation += 1;
+    }
+    jobAvailable.notify_all();
+
+    job_( 0 );
+
+    std::unique_lock< std::mutex > lock( poolMutex );
+    jobFinished.wait( lock, [&] { return nBusyThreads == 0; } );
+  }
+
+  bool ElementExecutor::takeChunk( int id, int& begin, int& end )
+  {
+    Worker& self = *workers[id];
+    {
+      std::lock_guard< std::mutex > lock( self.mutex );
+      if ( self.begin < self.end ) {
+        begin      = self.begin;
+        end        = std::min( self.begin + grainSize, self.end );
+        self.begin = end;
+        return true;
+      }
+    }
+
+    // steal the back half of the remaining range of another thread
+    for ( int i = 1; i < nThreads; i++ ) {
+      Worker& victim = *workers[( id + i ) % nThreads];
+      int     stolenBegin, stolenEnd;
+      {
+        std::lock_guard< std::mutex > lock( victim.mutex );
+        if ( victim.begin >= victim.end )
+          continue;
+        stolenBegin = victim.begin + ( victim.end - victim.begin ) / 2;
+        stolenEnd   = victim.end;
+        victim.end  = stolenBegin;
+      }
+
+      std::lock_guard< std::mutex > lock( self.mutex );
+      begin      = stolenBegin;
+      end        = std::min( stolenBegin + grainSize, stolenEnd );
+      self.begin = end;
+      self.end   = stolenEnd;
+      return true;
+    }
+
+    return false;
+  }
+
+  void ElementExecutor::computeElements( int                   id,
+                                         const ElementBuffers& buffers,
+                                         const double*         time,
+                                         double                dT,
+                                         const Assembly*       assembly )
+  {
+    Worker&    worker       = *workers[id];
+    const bool isAssembling = assembly && !assembly->isDeterministic;
+    int        begin, end;
+
+    try {
+      while ( !isCancelled.load( std::memory_order_relaxed ) && takeChunk( id, begin, end ) ) {
+        for ( int e = begin; e < end; e++ ) {
+          MarmotElement* element = buffers.elements[e];
+          double         pNewDT  = worker.pNewDT;
+          element->computeYourself( buffers.QTotal[e], buffers.dQ[e], buffers.Pe[e], buffers.Ke[e], time, dT, pNewDT );
+
+          worker.pNewDT = std::min( worker.pNewDT, pNewDT );
+          if ( pNewDT < 1.0 ) {
+            isCancelled.store( true, std::memory_order_relaxed );
+            return;
+          }
+
+          if ( isAssembling ) {
+            const int* dofIndices = assembly->dofIndices[e];
+            for ( int i = 0; i < element->getNDofPerElement(); i++ )
+              worker.P[dofIndices[i]] += buffers.Pe[e][i];
+          }
+        }
+      }
+    }
+    catch ( ... ) {
+      std::lock_guard< std::mutex > lock( exceptionMutex );
+      if ( !exception )
+        exception = std::current_exception();
+      isCancelled.store( true );
+    }
+  }
+
+  void ElementExecutor::computeYourself( const ElementBuffers& buffers,
+                                         const double*         time,
+                                         double                dT,
+                                         double&               pNewDT,
+                                         const Assembly*       assembly )
+  {
+    Tracing::ScopedSpan span( "executeElements", "element" );
+
+    isCancelled.store( false );
+    exception = nullptr;
+
+    // initial ranges of equal size
+    for ( int i = 0; i < nThreads; i++ ) {
+      Worker& worker = *workers[i];
+      worker.begin   = static_cast< int >( static_cast< long int >( buffers.nElements ) * i / nThreads );
+      worker.end     = static_cast< int >( static_cast< long int >( buffers.nElements ) * ( i + 1 ) / nThreads );
+      worker.pNewDT  = pNewDT;
+      if ( assembly && !assembly->isDeterministic )
+        worker.P.assign( assembly->nDofs, 0.0 );
+    }
+
+    runOnAllThreads( [&]( int id ) { computeElements( id, buffers, time, dT, assembly ); } );
+
+    // messages of the worker threads are written once per computation rather than left in their buffers
+    MarmotJournal::flush();
+
+    if ( exception )
+      std::rethrow_exception( exception );
+
+    for ( const auto& worker : workers )
+      pNewDT = std::min( pNewDT, worker->pNewDT );
+
+    if ( !assembly || pNewDT < 1.0 )
+      return;
+
+    if ( assembly->isDeterministic &&
+         ( reductionIndex.elements != buffers.elements || reductionIndex.dofIndices != assembly->dofIndices ||
+           reductionIndex.nElements != buffers.nElements || reductionIndex.nDofs != assembly->nDofs ) )
+      prepareAssembly( buffers, *assembly );
+
+    // each thread reduces a range of global dofs
+    runOnAllThreads( [&]( int id ) {
+      const int dofBegin = static_cast< int >( static_cast< long int >( assembly->nDofs ) * id / nThreads );
+      const int dofEnd   = static_cast< int >( static_cast< long int >( assembly->nDofs ) * ( id + 1 ) / nThreads );
+
+      if ( !assembly->isDeterministic ) {
+        for ( const auto& worker : workers )
+          for ( int i = dofBegin; i < dofEnd; i++ )
+            assembly->P[i] += worker->P[i];
+        return;
+      }
+
+      const ReductionIndex& index = reductionIndex;
+      for ( int i = index.threadDofBegin[id]; i < index.threadDofBegin[id + 1]; i++ )
+        for ( int k = index.dofBegin[i]; k < index.dofBegin[i + 1]; k++ )
+          assembly->P[i] += buffers.Pe[index.contributions[k].element][index.contributions[k].index];
+    } );
+  }
+
+  void ElementExecutor::prepareAssembly( const ElementBuffers& buffers, const Assembly& assembly )
+  {
+    ReductionIndex& index = reductionIndex;
+    index.elements        = buffers.elements;
+    index.dofIndices      = assembly.dofIndices;
+    index.nElements       = buffers.nElements;
+    index.nDofs           = assembly.nDofs;
+
+    // count the contributions per dof, and place them in the order of the elements
+    index.dofBegin.assign( assembly.nDofs + 1, 0 );
+    for ( int e = 0; e < buffers.nElements; e++ )
+      for ( int i = 0; i < buffers.elements[e]->getNDofPerElement(); i++ )
+        index.dofBegin[assembly.dofIndices[e][i] + 1] += 1;
+
+    for ( int i = 0; i < assembly.nDofs; i++ )
+      index.dofBegin[i + 1] += index.dofBegin[i];
+
+    index.contributions.resize( index.dofBegin.back() );
+    std::vector< int > next( index.dofBegin.begin(), index.dofBegin.end() - 1 );
+    for ( int e = 0; e < buffers.nElements; e++ )
+      for ( int i = 0; i < buffers.elements[e]->getNDofPerElement(); i++ )
+        index.contributions[next[assembly.dofIndices[e][i]]++] = { e, i };
+
+    // ranges of dofs with about the same number of contributions
+    index.threadDofBegin.resize( nThreads + 1 );
+    for ( int id = 0; id <= nThreads; id++ ) {
+      const long int share     = static_cast< long int >( index.contributions.size() ) * id / nThreads;
+      index.threadDofBegin[id] = static_cast< int >(
+        std::lower_bound( index.dofBegin.begin(), index.dofBegin.end() - 1, share ) - index.dofBegin.begin() );
+    }
+    index.threadDofBegin[nThreads] = assembly.nDofs;
+  }
+
+} // namespace Marmot::Execution
@@ -0,0 +1,376 @@
+#include "Marmot/MarmotEnsightWriter.h"
+#include "Marmot/MarmotTracing.h"
+#include "Marmot/MarmotUtils.h"
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace Marmot::Output {
+
+  namespace {
+
+    // Ensight variable type and number of written components for a number of components
+    std::pair< std::string, int > getVariableType( int nComponents )
+    {
+      switch ( nComponents ) {
+      case 1: return { "scalar", 1 };
+      case 2:
+      case 3: return { "vector", 3 };
+      case 6: return { "tensor symm", 6 };
+      case 9: return { "tensor asym", 9 };
+      default:
+        throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << ": no Ensight variable type with "
+                                                  << nComponents << " components" );
+      }
+    }
+
+    std::ofstream openBinaryFile( const std::string& fileName )
+    {
+      std::ofstream file( fileName, std::ios::binary );
+      if ( !file )
+        throw std::runtime_error( MakeString() << __PRETTY_FUNCTION__ << ": cannot open " << fileName );
+      return file;
+    }
+
+    // Ensight binary files consist of strings of 80 characters, 32 bit integers and 32 bit floats
+    void writeString( std::ofstream& file, const std::string& string )
+    {
+      char buffer[80] = {};
+      string.copy( buffer, 79 );
+      file.write( buffer, 80 );
+    }
+
+    void writeInts( std::ofstream& file, const int* values, size_t n )
+    {
+      file.write( reinterpret_cast< const char* >( values ), n * sizeof( int ) );
+    }
+
+    void writeFloats( std::ofstream& file, const float* values, size_t n )
+    {
+      file.write( reinterpret_cast< const char* >( values ), n * sizeof( float ) );
+    }
+
+    // strains are stored in Voigt notation with engineering shear components
+    bool isVoigtStrain( const std::string& stateName, int nComponents )
+    {
+      std::string name = stateName;
+      std::transform( name.begin(), name.end(), name.begin(), []( unsigned char c ) { return std::tolower( c ); } );
+      return nComponents == 6 && name.find( "strain" ) != std::string::npos;
+    }
+
+    // file and variable names must not contain spaces
+    std::string sanitize( std::string name )
+    {
+      std::replace( name.begin(), name.end(), ' ', '_' );
+      return name;
+    }
+  } // namespace
+
+  EnsightWriter::EnsightWriter( const std::string& directory, const std::string& caseName, const Mesh& mesh )
+    : directory( directory ), caseName( sanitize( caseName ) ), mesh( mesh )
+  {
+    if ( mesh.nDim < 1 || mesh.nDim > 3 )
+      throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << ": invalid dimension " << mesh.nDim );
+
+    std::filesystem::create_directories( directory );
+
+    // group the elements by shape, keeping the order of the elements within each group
+    std::map< std::string, std::vector< int > > groups;
+    for ( int e = 0; e < mesh.nElements; e++ )
+      groups[mesh.elements[e]->getElementShape()].push_back( e );
+
+    for ( const auto& [shape, elements] : groups ) {
+      groupShapes.push_back( shape );
+      groupBegin.push_back( elementOrder.size() );
+      elementOrder.insert( elementOrder.end(), elements.begin(), elements.end() );
+    }
+    groupBegin.push_back( elementOrder.size() );
+
+    writeGeometry();
+
+    thread = std::thread( &EnsightWriter::run, this );
+  }
+
+  EnsightWriter::~EnsightWriter()
+  {
+    {
+      std::unique_lock< std::mutex > lock( mutex );
+      snapshotWritten.wait( lock, [&] { return !hasPendingSnapshot; } );
+      isTerminating = true;
+    }
+    snapshotSubmitted.notify_one();
+
+    thread.join();
+  }
+
+  void EnsightWriter::checkNoIncrementWritten( const char* function ) const
+  {
+    if ( hasWrittenIncrement )
+      throw std::logic_error( MakeString() << function << ": fields must be registered before the first increment" );
+  }
+
+  void EnsightWriter::addNodeField( const std::string& name, int nComponents )
+  {
+    checkNoIncrementWritten( __PRETTY_FUNCTION__ );
+
+    if ( nComponents == 2 && mesh.nDim != 2 )
+      throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << ": planar vectors require a 2D mesh" );
+
+    const auto [type, nComponentsWritten] = getVariableType( nComponents );
+    nodeFields.push_back( { sanitize( name ), type, nComponents, nComponentsWritten } );
+  }
+
+  void EnsightWriter::addElementField( const std::string& name, const std::string& stateName )
+  {
+    checkNoIncrementWritten( __PRETTY_FUNCTION__ );
+
+    ElementField field;
+    field.accessors.reserve( mesh.nElements );
+    for ( int e = 0; e < mesh.nElements; e++ )
+      field.accessors.push_back( mesh.elements[e]->resolveStateField( stateName ) );
+
+    const int nComponents = mesh.nElements > 0 ? field.accessors[0].size : 1;
+    for ( const auto& accessor : field.accessors )
+      if ( accessor.size != nComponents )
+        throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << ": state " << stateName
+                                                  << " has different sizes in the elements" );
+
+    const auto [type, nComponentsWritten] = getVariableType( nComponents );
+    field.name                            = sanitize( name );
+    field.type                            = type;
+    field.nComponents                     = nComponents;
+    field.nComponentsWritten              = nComponentsWritten;
+    field.hasEngineeringShear             = isVoigtStrain( stateName, nComponents );
+
+    elementFields.push_back( std::move( field ) );
+  }
+
+  void EnsightWriter::writeIncrement( double time, const double* const* nodeFieldValues )
+  {
+    Tracing::ScopedSpan span( "writeIncrement", "output" );
+
+    rethrowException();
+
+    if ( !nodeFields.empty() && !nodeFieldValues )
+      throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << ": values of the nodal fields missing" );
+
+    hasWrittenIncrement = true;
+    next.time           = time;
+
+    // nodal fields, component by component
+    next.nodeFields.resize( nodeFields.size() );
+    for ( size_t i = 0; i < nodeFields.size(); i++ ) {
+      const Field&          field  = nodeFields[i];
+      std::vector< float >& values = next.nodeFields[i];
+      values.assign( size_t( mesh.nNodes ) * field.nComponentsWritten, 0.0f );
+
+      for ( int c = 0; c < field.nComponents; c++ )
+        for ( int n = 0; n < mesh.nNodes; n++ )
+          values[size_t( c ) * mesh.nNodes + n] = nodeFieldValues[i][size_t( n ) * field.nComponents + c];
+    }
+
+    // element fields, averaged over the quadrature points, component by component for each group of elements
+    next.elementFields.resize( elementFields.size() );
+    for ( size_t i = 0; i < elementFields.size(); i++ ) {
+      const ElementField&   field  = elementFields[i];
+      std::vector< float >& values = next.elementFields[i];
+      values.assign( size_t( mesh.nElements ) * field.nComponentsWritten, 0.0f );
+
+      for ( size_t g = 0; g < groupShapes.size(); g++ ) {
+        const int nGroupElements = groupBegin[g + 1] - groupBegin[g];
+        float*    groupValues    = &values[size_t( groupBegin[g] ) * field.nComponentsWritten];
+
+        for ( int k = 0; k < nGroupElements; k++ ) {
+          const int      e       = elementOrder[groupBegin[g] + k];
+          MarmotElement& element = *mesh.elements[e];
+          const int      nQps    = element.getNumberOfQuadraturePoints();
+
+          stateBuffer.resize( size_t( nQps ) * field.nComponents );
+          element.gatherStateField( field.accessors[e], stateBuffer.data() );
+
+          for ( int c = 0; c < field.nComponents; c++ ) {
+            double mean = 0;
+            for ( int qp = 0; qp < nQps; qp++ )
+              mean += stateBuffer[qp * field.nComponents + c];
+            const double scale                            = field.hasEngineeringShear && c >= 3 ? 0.5 : 1.0;
+            groupValues[size_t( c ) * nGroupElements + k] = scale * mean / nQps;
+          }
+        }
+      }
+    }
+
+    // hand the snapshot over as soon as the previous one is written
+    {
+      std::unique_lock< std::mutex > lock( mutex );
+      snapshotWritten.wait( lock, [&] { return !hasPendingSnapshot; } );
+      std::swap( next, current );
+      hasPendingSnapshot = true;
+    }
+    snapshotSubmitted.notify_one();
+  }
+
+  void EnsightWriter::finish()
+  {
+    {
+      std::unique_lock< std::mutex > lock( mutex );
+      snapshotWritten.wait( lock, [&] { return !hasPendingSnapshot; } );
+    }
+
+    rethrowException();
+  }
+
+  void EnsightWriter::run()
+  {
+    while ( true ) {
+      {
+        std::unique_lock< std::mutex > lock( mutex );
+        snapshotSubmitted.wait( lock, [&] { return isTerminating || hasPendingSnapshot; } );
+        if ( !hasPendingSnapshot )
+          return;
+      }
+
+      try {
+        Tracing::ScopedSpan span( "writeSnapshot", "output" );
+        writeSnapshot( current, times.size() );
+        times.push_back( current.time );
+        writeCaseFile();
+      }
+      catch ( ... ) {
+        std::lock_guard< std::mutex > lock( mutex );
+        exception = std::current_exception();
+      }
+
+      {
+        std::lock_guard< std::mutex > lock( mutex );
+        hasPendingSnapshot = false;
+      }
+      snapshotWritten.notify_all();
+    }
+  }
+
+  void EnsightWriter::rethrowException()
+  {
+    std::lock_guard< std::mutex > lock( mutex );
+    if ( exception )
+      std::rethrow_exception( std::exchange( exception, nullptr ) );
+  }
+
+  std::string EnsightWriter::getFileName( const std::string& suffix ) const
+  {
+    return ( std::filesystem::path( directory ) / ( caseName + "." + suffix ) ).string();
+  }
+
+  void EnsightWriter::writeGeometry()
+  {
+    std::ofstream file = openBinaryFile( getFileName( "geo" ) );
+
+    writeString( file, "C Binary" );
+    writeString( file, "Marmot" );
+    writeString( file, caseName );
+    writeString( file, "node id off" );
+    writeString( file, "element id off" );
+    writeString( file, "part" );
+    const int part = 1;
+    writeInts( file, &part, 1 );
+    writeString( file, "mesh" );
+    writeString( file, "coordinates" );
+    writeInts( file, &mesh.nNodes, 1 );
+
+    std::vector< float > coordinates( mesh.nNodes );
+    for ( int d = 0; d < 3; d++ ) {
+      for ( int n = 0; n < mesh.nNodes; n++ )
+        coordinates[n] = d < mesh.nDim ? mesh.nodeCoordinates[size_t( n ) * mesh.nDim + d] : 0.0f;
+      writeFloats( file, coordinates.data(), coordinates.size() );
+    }
+
+    std::vector< int > connectivity;
+    for ( size_t g = 0; g < groupShapes.size(); g++ ) {
+      const int nGroupElements = groupBegin[g + 1] - groupBegin[g];
+      const int nElementNodes  = mesh.elements[elementOrder[groupBegin[g]]]->getNNodes();
+
+      connectivity.clear();
+      for ( int k = groupBegin[g]; k < groupBegin[g + 1]; k++ )
+        for ( int a = 0; a < nElementNodes; a++ )
+          connectivity.push_back( mesh.connectivity[elementOrder[k]][a] + 1 );
+
+      writeString( file, groupShapes[g] );
+      writeInts( file, &nGroupElements, 1 );
+      writeInts( file, connectivity.data(), connectivity.size() );
+    }
+
+    if ( !file )
+      throw std::runtime_error( MakeString() << __PRETTY_FUNCTION__ << ": writing the geometry failed" );
+  }
+
+  void EnsightWriter::writeSnapshot( const Snapshot& snapshot, int step )
+  {
+    std::ostringstream stepSuffix;
+    stepSuffix << std::setfill( '0' ) << std::setw( 5 ) << step;
+    const int part = 1;
+
+    for ( size_t i = 0; i < nodeFields.size(); i++ ) {
+      std::ofstream file = openBinaryFile( getFileName( nodeFields[i].name + "." + stepSuffix.str() ) );
+      writeString( file, nodeFields[i].name );
+      writeString( file, "part" );
+      writeInts( file, &part, 1 );
+      writeString( file, "coordinates" );
+      writeFloats( file, snapshot.nodeFields[i].data(), snapshot.nodeFields[i].size() );
+
+      if ( !file )
+        throw std::runtime_error( MakeString() << __PRETTY_FUNCTION__ << ": writing " << nodeFields[i].name
+                                               << " failed" );
+    }
+
+    for ( size_t i = 0; i < elementFields.size(); i++ ) {
+      const ElementField& field = elementFields[i];
+
+      std::ofstream file = openBinaryFile( getFileName( field.name + "." + stepSuffix.str() ) );
+      writeString( file, field.name );
+      writeString( file, "part" );
+      writeInts( file, &part, 1 );
+
+      for ( size_t g = 0; g < groupShapes.size(); g++ ) {
+        const size_t begin = size_t( groupBegin[g] ) * field.nComponentsWritten;
+        const size_t n     = size_t( groupBegin[g + 1] - groupBegin[g] ) * field.nComponentsWritten;
+        writeString( file, groupShapes[g] );
+        writeFloats( file, &snapshot.elementFields[i][begin], n );
+      }
+
+      if ( !file )
+        throw std::runtime_error( MakeString() << __PRETTY_FUNCTION__ << ": writing " << field.name << " failed" );
+    }
+  }
+
+  void EnsightWriter::writeCaseFile()
+  {
+    // written to a temporary file first, such that readers never see an incomplete case file
+    const std::string fileName = getFileName( "case" );
+    {
+      std::ofstream file( fileName + ".tmp" );
+      if ( !file )
+        throw std::runtime_error( MakeString() << __PRETTY_FUNCTION__ << ": cannot open " << fileName );
+
+      file << "FORMAT\ntype: ensight gold\n\nGEOMETRY\nmodel: " << caseName << ".geo\n\nVARIABLE\n";
+      for ( const auto& field : nodeFields )
+        file << field.type << " per node: 1 " << field.name << " " << caseName << "." << field.name << ".*****\n";
+      for ( const auto& field : elementFields )
+        file << field.type << " per element: 1 " << field.name << " " << caseName << "." << field.name
+             << ".*****\n";
+
+      file << "\nTIME\ntime set: 1\nnumber of steps: " << times.size()
+           << "\nfilename start number: 0\nfilename increment: 1\ntime values:\n"
+           << std::setprecision( 12 );
+      for ( double time : times )
+        file << time << "\n";
+    }
+
+    std::filesystem::rename( fileName + ".tmp", fileName );
+  }
+
+} // namespace Marmot::Output
@@ -1,5 +1,12 @@
 #include "Marmot/MarmotJournal.h"
 
+struct MarmotJournal::ThreadBuffer {
+  // written only by the owning thread, and collected by flush() while the owning thread does not write
+  std::string                           content;
+  MessageCounts                         messageCounts;
+  std::chrono::steady_clock::time_point lastFlush = std::chrono::steady_clock::now();
+};
+
 MarmotJournal& MarmotJournal::getInstance()
 {
   static MarmotJournal instance;
@@ -7,21 +14,180 @@ MarmotJournal& MarmotJournal::getInstance()
   return instance;
 }
 
+MarmotJournal::ThreadBuffer& MarmotJournal::getThreadBuffer()
+{
+  thread_local std::shared_ptr< ThreadBuffer > threadBuffer = [] {
+    auto                          newBuffer = std::make_shared< ThreadBuffer >();
+    auto&                         journal   = getInstance();
+    std::lock_guard< std::mutex > lock( journal.registryMutex );
+    journal.threadBuffers.push_back( newBuffer );
+    return newBuffer;
+  }();
+
+  return *threadBuffer;
+}
+
 MarmotJournal::MarmotJournal() : output( nullptr ) {}
 
+MarmotJournal::~MarmotJournal()
+{
+  flush();
+}
+
 void MarmotJournal::setMSGOutputDirection( std::ostream& newOutputStream )
 {
-  getInstance().output.rdbuf( newOutputStream.rdbuf() );
+  auto&                         journal = getInstance();
+  std::lock_guard< std::mutex > lock( journal.outputMutex );
+  journal.output.rdbuf( newOutputStream.rdbuf() );
+}
+
+void MarmotJournal::setOptions( const Options& newOptions )
+{
+  flush();
+  getInstance().options = newOptions;
+}
+
+void MarmotJournal::setMinimumSeverity( Severity severity )
+{
+  minimumSeverity.store( static_cast< int >( severity ), std::memory_order_relaxed );
+}
+
+void MarmotJournal::writeToOutput( std::string_view content )
+{
+  if ( content.empty() )
+    return;
+
+  auto&                         journal = getInstance();
+  std::lock_guard< std::mutex > lock( journal.outputMutex );
+  journal.output << content;
+}
+
+std::string MarmotJournal::takeContent( ThreadBuffer& threadBuffer, MessageCounts& suppressedMessages )
+{
+  std::string content;
+  content.swap( threadBuffer.content );
+
+  const int maxRepetitions = getInstance().options.maxRepetitions;
+  for ( const auto& [message, count] : threadBuffer.messageCounts )
+    if ( maxRepetitions >= 0 && count > maxRepetitions )
+      suppressedMessages[message] += count - maxRepetitions;
+
+  threadBuffer.messageCounts.clear();
+  threadBuffer.lastFlush = std::chrono::steady_clock::now();
+
+  return content;
+}
+
+std::string MarmotJournal::summarizeSuppressedMessages( const MessageCounts& suppressedMessages )
+{
+  std::string summary;
+  for ( const auto& [message, count] : suppressedMessages ) {
+    std::string_view trimmedMessage( message );
+    while ( !trimmedMessage.empty() && trimmedMessage.back() == '\n' )
+      trimmedMessage.remove_suffix( 1 );
+
+    summary += std::string( MakeString() << "MarmotJournal: suppressed " << count
+                                         << " repetitions of message: " << trimmedMessage << "\n" );
+  }
+  return summary;
+}
+
+void MarmotJournal::write( Severity severity, std::string_view message )
+{
+  if ( !isEnabled( severity ) )
+    return;
+
+  const auto& options = getInstance().options;
+
+  if ( !options.bufferPerThread && options.maxRepetitions < 0 ) {
+    writeToOutput( message );
+    return;
+  }
+
+  auto&       threadBuffer = getThreadBuffer();
+  std::string contentToWrite;
+
+  const bool isFlushDue   = std::chrono::steady_clock::now() - threadBuffer.lastFlush >= options.flushInterval;
+  const bool isCountsFull = threadBuffer.messageCounts.size() >= options.maxTrackedMessages &&
+                            !threadBuffer.messageCounts.contains( message );
+
+  // a flush starts a new period for the rate limiting, hence the counts are bounded in time and size
+  if ( isFlushDue || isCountsFull ) {
+    MessageCounts suppressedMessages;
+    contentToWrite = takeContent( threadBuffer, suppressedMessages );
+    contentToWrite += summarizeSuppressedMessages( suppressedMessages );
+  }
+
+  bool isSuppressed = false;
+  if ( options.maxRepetitions >= 0 ) {
+    auto it = threadBuffer.messageCounts.find( message );
+    if ( it == threadBuffer.messageCounts.end() )
+      it = threadBuffer.messageCounts.emplace( message, 0 ).first;
+
+    isSuppressed = ++it->second > options.maxRepetitions;
+  }
+
+  if ( !isSuppressed ) {
+    if ( !options.bufferPerThread )
+      contentToWrite += message;
+    else {
+      threadBuffer.content += message;
+
+      if ( threadBuffer.content.size() >= options.flushThreshold ) {
+        MessageCounts suppressedMessages;
+        contentToWrite += takeContent( threadBuffer, suppressedMessages );
+        contentToWrite += summarizeSuppressedMessages( suppressedMessages );
+      }
+    }
+  }
+
+  writeToOutput( contentToWrite );
+}
+
+void MarmotJournal::flush()
+{
+  auto& journal = getInstance();
+
+  std::vector< std::shared_ptr< ThreadBuffer > > threadBuffers;
+  {
+    std::lock_guard< std::mutex > lock( journal.registryMutex );
+    for ( auto& threadBuffer : journal.threadBuffers ) {
+      // buffers of terminated threads are only referenced by the registry, they are flushed a last time and released
+      if ( threadBuffer.use_count() == 1 )
+        threadBuffers.push_back( std::move( threadBuffer ) );
+      else
+        threadBuffers.push_back( threadBuffer );
+    }
+    std::erase( journal.threadBuffers, nullptr );
+  }
+
+  MessageCounts suppressedMessages;
+  for ( auto& threadBuffer : threadBuffers )
+    writeToOutput( takeContent( *threadBuffer, suppressedMessages ) );
+
+  writeToOutput( summarizeSuppressedMessages( suppressedMessages ) );
 }
 
 bool MarmotJournal::warningToMSG( const std::string& message )
 {
-  getInstance().output << message;
+  write( Severity::Warning, message );
+  return false;
+}
+
+bool MarmotJournal::warningToMSG( const char* message )
+{
+  write( Severity::Warning, message );
   return false;
 }
 
 bool MarmotJournal::notificationToMSG( const std::string& message )
 {
-  getInstance().output << message;
+  write( Severity::Notification, message );
+  return true;
+}
+
+bool MarmotJournal::notificationToMSG( const char* message )
+{
+  write( Severity::Notification, message );
   return true;
 }
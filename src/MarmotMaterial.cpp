@@ -1,5 +1,6 @@
 #include "Marmot/MarmotMaterial.h"
 #include "Marmot/MarmotJournal.h"
+#include <algorithm>
 #include <stdexcept>
 
 MarmotMaterial::MarmotMaterial( const double* materialProperties_, int nMaterialProperties_, int materialNumber_ )
@@ -7,14 +8,29 @@ MarmotMaterial::MarmotMaterial( const double* materialProperties_, int nMaterial
     nMaterialProperties( nMaterialProperties_ ),
     stateVars( nullptr ),
     nStateVars( 0 ),
+    stateVarsOld( nullptr ),
     materialNumber( materialNumber_ )
 {
 }
 
 void MarmotMaterial::assignStateVars( double* stateVars, int nStateVars )
 {
-  this->stateVars  = stateVars;
-  this->nStateVars = nStateVars;
+  this->stateVars    = stateVars;
+  this->nStateVars   = nStateVars;
+  this->stateVarsOld = nullptr;
+}
+
+void MarmotMaterial::assignStateVarsDoubleBuffered( double* stateVars, const double* stateVarsOld, int nStateVars )
+{
+  // the virtual assignment sets up the state managers of the material for the working state
+  assignStateVars( stateVars, nStateVars );
+  this->stateVarsOld = stateVarsOld;
+}
+
+void MarmotMaterial::restoreStateVars()
+{
+  if ( stateVarsOld )
+    std::copy_n( stateVarsOld, nStateVars, stateVars );
 }
 
 double* MarmotMaterial::getAssignedStateVars()
@@ -22,6 +38,142 @@ double* MarmotMaterial::getAssignedStateVars()
   return stateVars;
 }
 
+const double* MarmotMaterial::getStateVarsAtBeginOfIncrement( std::vector< double >& backup )
+{
+  if ( stateVarsOld )
+    return stateVarsOld;
+
+  backup.assign( stateVars, stateVars + nStateVars );
+  return backup.data();
+}
+
+const double* MarmotMaterial::getStateVarAtBeginOfIncrement( const double* stateVar ) const
+{
+  return stateVarsOld ? stateVarsOld + ( stateVar - stateVars ) : stateVar;
+}
+
+void MarmotMaterial::backupStateVars( std::vector< double >& backup ) const
+{
+  if ( !stateVarsOld )
+    backup.assign( stateVars, stateVars + nStateVars );
+}
+
+void MarmotMaterial::restoreStateVarsFromBackup( const std::vector< double >& backup )
+{
+  if ( !stateVarsOld )
+    std::copy( backup.begin(), backup.end(), stateVars );
+}
+
+const double* MarmotMaterial::getAssignedStateVarsOld()
+{
+  return stateVarsOld;
+}
+
+const Marmot::Status& MarmotMaterial::getStatus() const
+{
+  return status;
+}
+
+void MarmotMaterial::resetStatus()
+{
+  status                         = {};
+  innerNewtonScratch.nIterations = 0;
+}
+
+void MarmotMaterial::requestCutback( Marmot::Status::Reason reason, double suggestedDTFactor )
+{
+  status.merge( Marmot::Status::cutback( reason, suggestedDTFactor ) );
+  countEvent( Marmot::PerformanceCounters::Cutbacks );
+}
+
+void MarmotMaterial::setInnerNewtonWarmStart( bool enable )
+{
+  innerNewtonScratch.isWarmStartEnabled = enable;
+  innerNewtonScratch.solution.clear();
+}
+
+int MarmotMaterial::getNumberOfInnerNewtonIterations() const
+{
+  return innerNewtonScratch.nIterations;
+}
+
+bool MarmotMaterial::warmStartInnerNewton( double time, double dT, double* x, int n ) const
+{
+  const InnerNewtonScratch& scratch = innerNewtonScratch;
+
+  // only a solution of the same increment, computed from the same state at the begin of the increment
+  if ( !scratch.isWarmStartEnabled || scratch.time != time || scratch.dT != dT ||
+       static_cast< int >( scratch.solution.size() ) != n )
+    return false;
+
+  std::copy_n( scratch.solution.data(), n, x );
+  return true;
+}
+
+void MarmotMaterial::storeInnerNewtonSolution( double time, double dT, const double* x, int n )
+{
+  if ( !innerNewtonScratch.isWarmStartEnabled )
+    return;
+
+  innerNewtonScratch.time = time;
+  innerNewtonScratch.dT   = dT;
+  innerNewtonScratch.solution.assign( x, x + n );
+}
+
+std::shared_ptr< MarmotMaterialSectionData > MarmotMaterial::createSectionData()
+{
+  return nullptr;
+}
+
+void MarmotMaterial::assignSectionData( std::shared_ptr< MarmotMaterialSectionData > sectionData_ )
+{
+  sectionData = std::move( sectionData_ );
+}
+
+void MarmotMaterial::beginIncrement( MarmotMaterialSectionData& sectionData, const double* time, double dT ) {}
+
+MarmotMaterialSectionData& MarmotMaterial::prepareSectionData()
+{
+  // materials created without a section own their data
+  if ( !sectionData )
+    sectionData = createSectionData();
+
+  if ( !sectionData )
+    throw std::logic_error( MakeString() << __PRETTY_FUNCTION__ << ": material does not provide section data" );
+
+  return *sectionData;
+}
+
+MarmotMaterialSectionData& MarmotMaterial::prepareSectionData( const double* time, double dT )
+{
+  MarmotMaterialSectionData& data = prepareSectionData();
+
+  if ( data.isPreparedFor( time, dT ) )
+    return data;
+
+  std::lock_guard< std::mutex > lock( data.mutex );
+  if ( !data.isPreparedFor( time, dT ) ) {
+    // publish the increment only after its quantities are complete
+    data.dT.store( std::numeric_limits< double >::quiet_NaN(), std::memory_order_relaxed );
+    beginIncrement( data, time, dT );
+    data.time[0].store( time[0], std::memory_order_release );
+    data.time[1].store( time[1], std::memory_order_release );
+    data.dT.store( dT, std::memory_order_release );
+    countEvent( Marmot::PerformanceCounters::BeginIncrementCalls );
+  }
+
+  return data;
+}
+
+void MarmotMaterial::prepareIncrement( const double* time, double dT )
+{
+  if ( !sectionData )
+    sectionData = createSectionData();
+
+  if ( sectionData )
+    prepareSectionData( time, dT );
+}
+
 int MarmotMaterial::getNumberOfAssignedStateVars()
 {
   return nStateVars;
@@ -0,0 +1,163 @@
+#include "Marmot/MarmotPerformanceCounters.h"
+#include "Marmot/MarmotJournal.h"
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+namespace Marmot::PerformanceCounters {
+
+  namespace {
+
+    struct Entry {
+      const Owner                                      owner;
+      const int                                        code;
+      std::array< std::atomic< long int >, nCounters > values{};
+
+      Entry( Owner owner, int code ) : owner( owner ), code( code ) {}
+    };
+
+    /* Each thread writes only to its own table. Values are atomics with relaxed ordering, so that collect() may read
+     * them concurrently without a data race; the mutex guards only the growth of the table. */
+    struct ThreadTable {
+      std::mutex          mutex;
+      std::deque< Entry > entries;
+      Entry*              lastEntry = nullptr;
+    };
+
+    std::mutex                                    registryMutex;
+    std::vector< std::shared_ptr< ThreadTable > > threadTables;
+
+    ThreadTable& getThreadTable()
+    {
+      // tables are kept alive by the registry after a thread terminates, so that its counts are not lost
+      thread_local std::shared_ptr< ThreadTable > table = [] {
+        auto                          newTable = std::make_shared< ThreadTable >();
+        std::lock_guard< std::mutex > lock( registryMutex );
+        threadTables.push_back( newTable );
+        return newTable;
+      }();
+
+      return *table;
+    }
+
+    Entry& findEntry( ThreadTable& table, Owner owner, int code )
+    {
+      if ( table.lastEntry && table.lastEntry->owner == owner && table.lastEntry->code == code )
+        return *table.lastEntry;
+
+      // only the owning thread modifies the table, hence lookup does not require the lock
+      auto it = std::find_if( table.entries.begin(), table.entries.end(), [&]( const Entry& entry ) {
+        return entry.owner == owner && entry.code == code;
+      } );
+
+      if ( it != table.entries.end() )
+        table.lastEntry = &*it;
+      else {
+        std::lock_guard< std::mutex > lock( table.mutex );
+        table.lastEntry = &table.entries.emplace_back( owner, code );
+      }
+
+      return *table.lastEntry;
+    }
+  } // namespace
+
+  void add( Owner owner, int code, Counter counter, long int value )
+  {
+    auto& entryValue = findEntry( getThreadTable(), owner, code ).values[counter];
+    entryValue.store( entryValue.load( std::memory_order_relaxed ) + value, std::memory_order_relaxed );
+  }
+
+  std::vector< Record > collect()
+  {
+    std::map< std::pair< Owner, int >, std::array< long int, nCounters > > aggregated;
+
+    std::lock_guard< std::mutex > registryLock( registryMutex );
+    for ( const auto& table : threadTables ) {
+      std::lock_guard< std::mutex > lock( table->mutex );
+      for ( const Entry& entry : table->entries ) {
+        auto [it, isNew] = aggregated.try_emplace( { entry.owner, entry.code } );
+        if ( isNew )
+          it->second.fill( 0 );
+        for ( int i = 0; i < nCounters; i++ )
+          it->second[i] += entry.values[i].load( std::memory_order_relaxed );
+      }
+    }
+
+    std::vector< Record > records;
+    records.reserve( aggregated.size() );
+    for ( const auto& [key, values] : aggregated )
+      records.push_back( { key.first, key.second, values } );
+
+    return records;
+  }
+
+  long int get( Owner owner, int code, Counter counter )
+  {
+    long int result = 0;
+
+    std::lock_guard< std::mutex > registryLock( registryMutex );
+    for ( const auto& table : threadTables ) {
+      std::lock_guard< std::mutex > lock( table->mutex );
+      for ( const Entry& entry : table->entries )
+        if ( entry.owner == owner && entry.code == code )
+          result += entry.values[counter].load( std::memory_order_relaxed );
+    }
+
+    return result;
+  }
+
+  void reset()
+  {
+    std::lock_guard< std::mutex > registryLock( registryMutex );
+
+    // tables of terminated threads are only referenced by the registry and can be released
+    std::erase_if( threadTables, []( const auto& table ) { return table.use_count() == 1; } );
+
+    for ( const auto& table : threadTables ) {
+      std::lock_guard< std::mutex > lock( table->mutex );
+      for ( Entry& entry : table->entries )
+        for ( auto& value : entry.values )
+          value.store( 0, std::memory_order_relaxed );
+    }
+  }
+
+  std::string getCounterName( Counter counter )
+  {
+    switch ( counter ) {
+    case ComputeStressCalls: return "computeStress";
+    case ComputeYourselfCalls: return "computeYourself";
+    case InnerNewtonIterations: return "innerNewton";
+    case PlaneStressIterations: return "planeStress";
+    case UniaxialStressIterations: return "uniaxialStress";
+    case Cutbacks: return "cutbacks";
+    case BeginIncrementCalls: return "beginIncrement";
+    default: throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << ": invalid counter " << counter );
+    }
+  }
+
+  std::string summary()
+  {
+    MakeString table;
+
+    table << std::setw( 10 ) << "owner" << std::setw( 8 ) << "code";
+    for ( int i = 0; i < nCounters; i++ )
+      table << std::setw( 16 ) << getCounterName( static_cast< Counter >( i ) );
+    table << "\n";
+
+    for ( const Record& record : collect() ) {
+      table << std::setw( 10 ) << ( record.owner == Material ? "material" : "element" ) << std::setw( 8 )
+            << record.code;
+      for ( long int value : record.values )
+        table << std::setw( 16 ) << value;
+      table << "\n";
+    }
+
+    return table;
+  }
+
+} // namespace Marmot::PerformanceCounters
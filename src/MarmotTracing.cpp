@@ -0,0 +1,269 @@
+#include "Marmot/MarmotTracing.h"
+#include "Marmot/MarmotJournal.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace Marmot::Tracing {
+
+  namespace {
+
+    struct Event {
+      const char* name;
+      const char* category;
+      long long   begin;
+      long long   end;
+      long int    argument;
+    };
+
+    std::atomic< long int > generation      = 0;
+    std::atomic< size_t >   eventsPerThread = 1 << 16;
+    long long               epoch           = 0;
+  } // namespace
+
+  /* The ring buffer of a thread. The mutex is only contended while the events are written out or stop() is called. */
+  struct ThreadBuffer {
+    std::mutex           mutex;
+    std::vector< Event > events;
+    size_t               next       = 0;
+    bool                 isWrapped  = false;
+    long int             generation = -1;
+    int                  threadId;
+    SpanSequence*        openSequences = nullptr;
+
+    // (re)allocate the buffer for the current recording; must be called under the lock
+    void prepare( long int currentGeneration, size_t capacity )
+    {
+      if ( generation == currentGeneration )
+        return;
+
+      events.resize( capacity );
+      next       = 0;
+      isWrapped  = false;
+      generation = currentGeneration;
+    }
+
+    // must be called under the lock
+    void push( const Event& event )
+    {
+      const long int currentGeneration = Tracing::generation.load();
+      if ( generation != currentGeneration )
+        prepare( currentGeneration, eventsPerThread.load() );
+
+      events[next] = event;
+      next += 1;
+      if ( next == events.size() ) {
+        next      = 0;
+        isWrapped = true;
+      }
+    }
+
+    // end the open spans of all sequences of the thread; must be called under the lock
+    void closeOpenSequences( long long end )
+    {
+      for ( SpanSequence* sequence = openSequences; sequence; sequence = sequence->nextOpen ) {
+        if ( sequence->begin >= 0 ) {
+          push( { sequence->name, sequence->category, sequence->begin, end, sequence->argument } );
+          sequence->begin = -1;
+        }
+      }
+    }
+  };
+
+  namespace {
+
+    std::mutex                                     registryMutex;
+    std::vector< std::unique_ptr< ThreadBuffer > > threadBuffers;
+    std::vector< ThreadBuffer* >                   freeBuffers;
+    int                                            nextThreadId = 1;
+
+    /* Assigns a buffer to a thread, and returns it to the free list when the thread exits. */
+    struct ThreadBufferHandle {
+      ThreadBuffer* buffer;
+
+      ThreadBufferHandle()
+      {
+        std::lock_guard< std::mutex > lock( registryMutex );
+
+        // buffers with events of the current recording are kept for writing
+        auto isEmpty = []( const ThreadBuffer* buffer ) {
+          return buffer->generation != generation.load() || ( buffer->next == 0 && !buffer->isWrapped );
+        };
+
+        if ( auto it = std::find_if( freeBuffers.begin(), freeBuffers.end(), isEmpty ); it != freeBuffers.end() ) {
+          buffer = *it;
+          freeBuffers.erase( it );
+          return;
+        }
+
+        threadBuffers.push_back( std::make_unique< ThreadBuffer >() );
+        buffer           = threadBuffers.back().get();
+        buffer->threadId = nextThreadId++;
+      }
+
+      ~ThreadBufferHandle()
+      {
+        std::lock_guard< std::mutex > lock( registryMutex );
+        freeBuffers.push_back( buffer );
+      }
+    };
+
+    ThreadBuffer& getThreadBuffer()
+    {
+      thread_local ThreadBufferHandle handle;
+
+      return *handle.buffer;
+    }
+  } // namespace
+
+  void start( size_t eventsPerThread_ )
+  {
+    if ( eventsPerThread_ == 0 )
+      throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << ": ring buffer capacity must be positive" );
+
+    std::lock_guard< std::mutex > registryLock( registryMutex );
+
+    // the capacity is published before the generation, see ThreadBuffer::push()
+    eventsPerThread.store( eventsPerThread_ );
+    epoch                        = now();
+    const long int newGeneration = generation.fetch_add( 1 ) + 1;
+
+    // preallocate the buffers of the running threads; the events of exited threads are discarded
+    for ( const auto& buffer : threadBuffers ) {
+      std::lock_guard< std::mutex > lock( buffer->mutex );
+      if ( std::find( freeBuffers.begin(), freeBuffers.end(), buffer.get() ) == freeBuffers.end() )
+        buffer->prepare( newGeneration, eventsPerThread_ );
+      else
+        buffer->events = std::vector< Event >();
+    }
+
+    recording.store( true );
+  }
+
+  void stop()
+  {
+    recording.store( false );
+    const long long end = now();
+
+    std::lock_guard< std::mutex > registryLock( registryMutex );
+    for ( const auto& buffer : threadBuffers ) {
+      std::lock_guard< std::mutex > lock( buffer->mutex );
+      buffer->closeOpenSequences( end );
+    }
+  }
+
+  void registerThread()
+  {
+    ThreadBuffer& buffer = getThreadBuffer();
+
+    std::lock_guard< std::mutex > lock( buffer.mutex );
+    if ( isRecording() )
+      buffer.prepare( generation.load(), eventsPerThread.load() );
+  }
+
+  void record( const char* name, const char* category, long long begin, long long end, long int argument )
+  {
+    ThreadBuffer& buffer = getThreadBuffer();
+
+    std::lock_guard< std::mutex > lock( buffer.mutex );
+    buffer.push( { name, category, begin, end, argument } );
+  }
+
+  void SpanSequence::open( const char* name_, const char* category_, long int argument_ )
+  {
+    buffer = &getThreadBuffer();
+
+    std::lock_guard< std::mutex > lock( buffer->mutex );
+    name         = name_;
+    category     = category_;
+    argument     = argument_;
+    begin        = now();
+    previousOpen = nullptr;
+    nextOpen     = buffer->openSequences;
+    if ( nextOpen )
+      nextOpen->previousOpen = this;
+    buffer->openSequences = this;
+  }
+
+  void SpanSequence::closeOpenSpan()
+  {
+    std::lock_guard< std::mutex > lock( buffer->mutex );
+
+    // the span may have been ended by stop() already
+    if ( begin >= 0 ) {
+      buffer->push( { name, category, begin, now(), argument } );
+      begin = -1;
+    }
+
+    if ( previousOpen )
+      previousOpen->nextOpen = nextOpen;
+    else
+      buffer->openSequences = nextOpen;
+    if ( nextOpen )
+      nextOpen->previousOpen = previousOpen;
+
+    buffer = nullptr;
+  }
+
+  void writeChromeTrace( std::ostream& output )
+  {
+    std::lock_guard< std::mutex > registryLock( registryMutex );
+
+    const long int currentGeneration = generation.load();
+    bool           isFirst           = true;
+
+    auto separator = [&]() -> std::ostream& {
+      output << ( isFirst ? "\n" : ",\n" );
+      isFirst = false;
+      return output;
+    };
+
+    const auto flags     = output.flags();
+    const auto precision = output.precision();
+
+    output << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[" << std::fixed << std::setprecision( 3 );
+
+    for ( const auto& buffer : threadBuffers ) {
+      std::lock_guard< std::mutex > lock( buffer->mutex );
+      if ( buffer->generation != currentGeneration )
+        continue;
+
+      separator() << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId
+                  << ",\"args\":{\"name\":\"Marmot thread " << buffer->threadId << "\"}}";
+
+      // oldest events first
+      const size_t first   = buffer->isWrapped ? buffer->next : 0;
+      const size_t nEvents = buffer->isWrapped ? buffer->events.size() : buffer->next;
+      for ( size_t i = 0; i < nEvents; i++ ) {
+        const Event& event = buffer->events[( first + i ) % buffer->events.size()];
+
+        separator() << "{\"name\":\"" << event.name << "\",\"cat\":\"" << event.category
+                    << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadId
+                    << ",\"ts\":" << ( event.begin - epoch ) * 1e-3
+                    << ",\"dur\":" << ( event.end - event.begin ) * 1e-3;
+        if ( event.argument >= 0 )
+          output << ",\"args\":{\"code\":" << event.argument << "}";
+        output << "}";
+      }
+    }
+
+    output << "\n]}\n";
+
+    output.flags( flags );
+    output.precision( precision );
+  }
+
+  void writeChromeTrace( const std::string& fileName )
+  {
+    std::ofstream file( fileName );
+    if ( !file )
+      throw std::runtime_error( MakeString() << __PRETTY_FUNCTION__ << ": cannot open " << fileName );
+
+    writeChromeTrace( file );
+  }
+
+} // namespace Marmot::Tracing